@@ -22,6 +22,8 @@
  * 2013-04-10: Created (Liviu)
  */
 
+#include <limits.h>
+
 #include "bin_interface.h"
 #include "config.h"
 #include "daemonize.h"
@@ -34,6 +36,48 @@ struct socket_info *bin;
 
 static struct packet_cb_list *reg_cbs;
 
+/* per process cache of default sized (BIN_MAX_BUF_LEN) buffers, so that
+ * building a packet does not cost a large pkg allocation each time */
+static struct {
+	char *buf;
+	int in_use;
+} bin_buf_pool[BIN_BUF_POOL_SIZE];
+
+static char *bin_buf_get(void)
+{
+	int i;
+
+	for (i = 0; i < BIN_BUF_POOL_SIZE; i++) {
+		if (bin_buf_pool[i].in_use)
+			continue;
+
+		if (!bin_buf_pool[i].buf) {
+			bin_buf_pool[i].buf = pkg_malloc(BIN_MAX_BUF_LEN);
+			if (!bin_buf_pool[i].buf)
+				return NULL;
+		}
+
+		bin_buf_pool[i].in_use = 1;
+		return bin_buf_pool[i].buf;
+	}
+
+	/* all of them are taken by the packets currently being built */
+	return pkg_malloc(BIN_MAX_BUF_LEN);
+}
+
+static int bin_buf_put(char *buf)
+{
+	int i;
+
+	for (i = 0; i < BIN_BUF_POOL_SIZE; i++)
+		if (bin_buf_pool[i].buf == buf) {
+			bin_buf_pool[i].in_use = 0;
+			return 1;
+		}
+
+	return 0;
+}
+
 
 short get_bin_pkg_version(bin_packet_t *packet)
 {
@@ -54,7 +98,8 @@ void set_len(bin_packet_t *packet) {
  * +-------------------+-----------------------------------------------------------------+
  *
  * @param: { LEN, CAP } + CMD + VERSION
- * @length: initial packet size. specify 0 to use the default size (BIN_MAX_BUF_LEN)
+ * @length: initial packet size. specify 0 to use the default size (BIN_MAX_BUF_LEN),
+ *          in which case the buffer is taken from a per process pool
  */
 int bin_init(bin_packet_t *packet, str *capability, int packet_type,
              short version, int length)
@@ -65,12 +110,14 @@ int bin_init(bin_packet_t *packet, str *capability, int packet_type,
 		return -1;
 	}
 
-	if (!length) 
-		length = BIN_MAX_BUF_LEN;
-
 	packet->type = packet_type;
 
-	packet->buffer.s = pkg_malloc(length);
+	if (!length) {
+		length = BIN_MAX_BUF_LEN;
+		packet->buffer.s = bin_buf_get();
+	} else {
+		packet->buffer.s = pkg_malloc(length);
+	}
 	if (!packet->buffer.s) {
 		LM_ERR("No more pkg memory!\n");
 		return -1;
@@ -125,7 +172,7 @@ void bin_init_buffer(bin_packet_t *packet, char *buffer, int length)
 
 	packet->type = *(int *)(capability.s + capability.len);
 	packet->front_pointer = capability.s + capability.len + CMD_FIELD_SIZE;
-	LM_INFO("init buffer length %d\n", length);
+	LM_DBG("init buffer length %d\n", length);
 }
 
 /*
@@ -165,6 +212,54 @@ int bin_push_str(bin_packet_t *packet, const str *info)
 	return packet->buffer.len;
 }
 
+/*
+ * adds a new string value to the packet, gathered from several buffers,
+ * without the need of first assembling it somewhere else
+ *
+ * @return:
+ *		> 0: success, the size of the packet
+ *		< 0: internal buffer limit reached
+ */
+int bin_push_iov(bin_packet_t *packet, const struct iovec *iov, int iovcnt)
+{
+	unsigned short len;
+	int i, total;
+
+	if (!packet->buffer.s || !packet->size) {
+		LM_ERR("not initialized yet, call bin_init before altering buffer\n");
+		return -1;
+	}
+
+	for (i = 0, total = 0; i < iovcnt; i++)
+		total += iov[i].iov_len;
+
+	if (total > USHRT_MAX) {
+		LM_ERR("string too large: %d\n", total);
+		return -1;
+	}
+
+	if (packet->buffer.len + LEN_FIELD_SIZE + total > packet->size) {
+		if (bin_extend(packet, LEN_FIELD_SIZE + total) < 0)
+			return -1;
+	}
+
+	len = total;
+	memcpy(packet->buffer.s + packet->buffer.len, &len, LEN_FIELD_SIZE);
+	packet->buffer.len += LEN_FIELD_SIZE;
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].iov_len)
+			continue;
+
+		memcpy(packet->buffer.s + packet->buffer.len, iov[i].iov_base,
+		       iov[i].iov_len);
+		packet->buffer.len += iov[i].iov_len;
+	}
+
+	set_len(packet);
+	return packet->buffer.len;
+}
+
 /*
  * adds a new integer value at the end position in the packet          
  *
@@ -354,6 +449,66 @@ int bin_pop_int(bin_packet_t *packet, void *info)
 	return 0;
 }
 
+/*
+ * pops several values at once, as described by @schema: 's' for a str and
+ * 'i' for an integer. The whole schema is checked against the packet before
+ * consuming anything, so either all the available fields are retrieved or,
+ * in case of error, none of them.
+ *
+ * @return:
+ *		>= 0: the number of fields retrieved; this is less than the length of
+ *		      the schema only if all the data has been consumed, so trailing
+ *		      fields may be treated as optional
+ *		< 0: error
+ *
+ * Note: The str fields point inside the packet, same as with bin_pop_str()
+ */
+int bin_pop_fields(bin_packet_t *packet, const char *schema, bin_field_t *fields)
+{
+	char *p, *end;
+	int n, len;
+
+	p = packet->front_pointer;
+	end = packet->buffer.s + packet->buffer.len;
+
+	for (n = 0; schema[n] && p < end; n++) {
+		switch (schema[n]) {
+		case 's':
+			if (p + LEN_FIELD_SIZE > end)
+				goto overflow;
+
+			len = 0;
+			memcpy(&len, p, LEN_FIELD_SIZE);
+			p += LEN_FIELD_SIZE;
+
+			if (p + len > end)
+				goto overflow;
+
+			fields[n].s.len = len;
+			fields[n].s.s = len ? p : NULL;
+			p += len;
+			break;
+		case 'i':
+			if (p + sizeof(int) > end)
+				goto overflow;
+
+			memcpy(&fields[n].i, p, sizeof(int));
+			p += sizeof(int);
+			break;
+		default:
+			LM_BUG("bad schema character '%c' in \"%s\"\n", schema[n], schema);
+			return -1;
+		}
+	}
+
+	packet->front_pointer = p;
+	return n;
+
+overflow:
+	LM_ERR("Receive binary packet buffer overflow\n");
+	return -1;
+}
+
 /*
  * pops an integer value from the end of the packet
  * @info:   pointer to store the result
@@ -480,7 +635,8 @@ static int bin_extend(bin_packet_t *packet, int size)
 void bin_free_packet(bin_packet_t *packet)
 {
 	if (packet->buffer.s) {
-		pkg_free(packet->buffer.s);
+		if (!bin_buf_put(packet->buffer.s))
+			pkg_free(packet->buffer.s);
 		packet->buffer.s = NULL;
 	} else {
 		LM_INFO("atempting to free uninitialized binary packet\n");
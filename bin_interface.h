@@ -25,6 +25,8 @@
 #ifndef __BINARY_INTERFACE__
 #define __BINARY_INTERFACE__
 
+#include <sys/uio.h>
+
 #include "ip_addr.h"
 #include "crc.h"
 #include "net/proto_tcp/tcp_common_defs.h"
@@ -42,6 +44,9 @@
 			(HEADER_SIZE + LEN_FIELD_SIZE + 1 + CMD_FIELD_SIZE)
                                          /* ^ capability */
 
+/* how many default sized buffers are kept for reuse by each process */
+#define BIN_BUF_POOL_SIZE      4
+
 #define is_valid_bin_packet(_p) \
 	(memcmp(_p, BIN_PACKET_MARKER, BIN_PACKET_MARKER_SIZE) == 0)
 
@@ -56,6 +61,12 @@ typedef struct bin_packet {
 	int src_id;
 } bin_packet_t;
 
+/* a value retrieved by bin_pop_fields() */
+typedef union bin_field {
+	int i;
+	str s;
+} bin_field_t;
+
 struct packet_cb_list {
 	str capability;									 /* registered capability */
 	void (*cbf)(bin_packet_t *, int packet_type,	 /* callback */
@@ -97,6 +108,8 @@ int bin_register_cb(str *cap, void (*cb)(bin_packet_t *, int,
  *
  * @capability:   capability string
  * @packet_type:  capability specific identifier for this new packet
+ * @length:       hint for the size of the packet, 0 for the default
+ *                (and pooled) BIN_MAX_BUF_LEN buffer
  *
  * @return: 0 on success
  */
@@ -122,6 +135,16 @@ void bin_init_buffer(bin_packet_t *packet, char *buffer, int length);
  */
 int bin_push_str(bin_packet_t *packet, const str *info);
 
+/*
+ * adds a new string value to the packet being currently built, made of
+ * the concatenation of the @iovcnt buffers in @iov
+ *
+ * @return:
+ *		> 0: success, the size of the buffer
+ *		< 0: internal buffer limit reached
+ */
+int bin_push_iov(bin_packet_t *packet, const struct iovec *iov, int iovcnt);
+
 /*
  * adds a new integer value to the packet being currently built
  *
@@ -178,6 +201,20 @@ int bin_pop_str(bin_packet_t *packet, str *info);
  */
 int bin_pop_int(bin_packet_t *packet, void *info);
 
+/*
+ * pops several values at once, after validating them against the packet
+ * @schema: one character for each field - 's' (str) or 'i' (integer)
+ * @fields: array to store the results, at least as long as @schema
+ *
+ * @return:
+ *		>= 0: number of fields retrieved, less than the schema length only
+ *		      if all data has been consumed
+ *		< 0: error, nothing was consumed
+ *
+ * Note: Same as with bin_pop_str(), the strings point inside the packet!
+ */
+int bin_pop_fields(bin_packet_t *packet, const char *schema, bin_field_t *fields);
+
 /*
  * pops an integer from the end of binary packet
  * @info:   pointer to store the result
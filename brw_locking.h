@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Project
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301 USA
+ */
+
+/*
+ * "Big reader" reader-writers lock, built on top of the Linux futexes.
+ *
+ * The reader count is split into BRW_SHARDS cache line sized counters,
+ * each process updating only the one picked by its process_no, so readers
+ * running in different processes do not fight over the same cache line.
+ * Writers (assumed rare) take a futex based mutex and then wait for all
+ * the shards to drain. Nobody busy-waits with sleeps: readers blocked by
+ * a writer and writers waiting for readers are put to sleep on a futex
+ * and are woken up by whoever releases the lock.
+ *
+ * When compiled with SHARDED_RW_LOCKS (requires USE_FUTEX), rw_locking.h
+ * maps the rw_lock_t API onto this lock.
+ */
+
+#ifndef _brw_locking_h
+#define _brw_locking_h
+
+#include <limits.h>
+#include "locking.h"
+
+#ifndef USE_FUTEX
+#error "the sharded reader-writers lock requires USE_FUTEX"
+#endif
+
+#define BRW_SHARDS      32
+#define BRW_CACHE_LINE  64
+
+extern int process_no;
+
+struct brw_shard {
+	volatile int readers;
+	char _pad[BRW_CACHE_LINE - sizeof(int)];
+};
+
+typedef struct brw_lock_t {
+	/* kept for the users of the rw_lock_t inner lock */
+	gen_lock_t *lock;
+
+	/* futex mutexes: 0 - free, 1 - taken, 2 - taken and with sleepers */
+	volatile int writer;
+	volatile int sw_reader;
+	char _pad[BRW_CACHE_LINE - sizeof(gen_lock_t *) - 2 * sizeof(int)];
+
+	struct brw_shard shards[BRW_SHARDS];
+} brw_lock_t;
+
+#define brw_my_shard(_l) (&(_l)->shards[process_no % BRW_SHARDS])
+
+inline static brw_lock_t *lock_init_brw(void)
+{
+	brw_lock_t *new_lock;
+
+	new_lock = (brw_lock_t *)shm_malloc(sizeof(brw_lock_t));
+	if (!new_lock)
+		goto error;
+	memset(new_lock, 0, sizeof(brw_lock_t));
+
+	new_lock->lock = lock_alloc();
+	if (!new_lock->lock)
+		goto error;
+	if (!lock_init(new_lock->lock))
+		goto error;
+
+	return new_lock;
+error:
+	if (new_lock!=NULL && new_lock->lock)
+		lock_dealloc(new_lock->lock);
+	if (new_lock)
+		shm_free(new_lock);
+	return NULL;
+}
+
+inline static void lock_destroy_brw(brw_lock_t *_lock)
+{
+	if (!_lock)
+		return;
+
+	if (_lock->lock) {
+		lock_destroy(_lock->lock);
+		lock_dealloc(_lock->lock);
+	}
+	shm_free(_lock);
+}
+
+/* sleep until the given futex mutex is no longer taken */
+inline static void _brw_wait_free(volatile int *m)
+{
+	int c;
+
+	while ((c = *m) != 0) {
+		/* make sure we get woken up on release */
+		if (c == 2 || atomic_cmpxchg(m, 1, 2) != 0)
+			futex_wait(m, 2);
+	}
+}
+
+inline static void _brw_mutex_get(volatile int *m)
+{
+	int c;
+
+	if ((c = atomic_cmpxchg(m, 0, 1)) == 0)
+		return;
+
+	do {
+		if (c == 2 || atomic_cmpxchg(m, 1, 2) != 0)
+			futex_wait(m, 2);
+	} while ((c = atomic_cmpxchg(m, 0, 2)) != 0);
+}
+
+inline static void _brw_mutex_release(volatile int *m)
+{
+	__sync_synchronize();
+	if (atomic_xchg(m, 0) == 2)
+		futex_wake(m, INT_MAX);
+}
+
+/* wait until the shards hold no other readers but our own "mine" ones */
+inline static void _brw_wait_readers(brw_lock_t *l, int mine)
+{
+	struct brw_shard *s, *my_shard = brw_my_shard(l);
+	int n, allowed;
+
+	for (s = l->shards; s < l->shards + BRW_SHARDS; s++) {
+		allowed = (s == my_shard) ? mine : 0;
+		while ((n = s->readers) > allowed)
+			futex_wait(&s->readers, n);
+	}
+}
+
+inline static void _brw_reader_exit(brw_lock_t *l, struct brw_shard *s)
+{
+	/* a writer may be sleeping until the shard drains */
+	if (__sync_sub_and_fetch(&s->readers, 1) <= 1 && l->writer)
+		futex_wake(&s->readers, INT_MAX);
+}
+
+inline static void brw_start_read(brw_lock_t *l)
+{
+	struct brw_shard *s = brw_my_shard(l);
+
+	for (;;) {
+		__sync_fetch_and_add(&s->readers, 1);
+		if (!l->writer)
+			return;
+
+		/* a writer is in or waiting for us - step back and let it pass */
+		_brw_reader_exit(l, s);
+		_brw_wait_free(&l->writer);
+	}
+}
+
+inline static void brw_stop_read(brw_lock_t *l)
+{
+	_brw_reader_exit(l, brw_my_shard(l));
+}
+
+inline static void brw_start_write(brw_lock_t *l)
+{
+	_brw_mutex_get(&l->writer);
+	_brw_wait_readers(l, 0);
+}
+
+inline static void brw_stop_write(brw_lock_t *l)
+{
+	_brw_mutex_release(&l->writer);
+}
+
+/* only one switchable reader at a time, any number of regular readers */
+inline static void brw_start_sw_read(brw_lock_t *l)
+{
+	_brw_mutex_get(&l->sw_reader);
+	brw_start_read(l);
+}
+
+inline static void brw_stop_sw_read(brw_lock_t *l)
+{
+	brw_stop_read(l);
+	_brw_mutex_release(&l->sw_reader);
+}
+
+/* switch to writing access with lock previously acquired for switchable
+ * reading; the previous writer state is saved in "old" */
+inline static int brw_switch_write(brw_lock_t *l)
+{
+	int old;
+
+	/* a writer holding the mutex is still waiting for us to leave */
+	old = atomic_cmpxchg(&l->writer, 0, 1);
+
+	_brw_wait_readers(l, 1);
+
+	return old;
+}
+
+inline static void brw_switch_read(brw_lock_t *l, int old)
+{
+	if (!old)
+		_brw_mutex_release(&l->writer);
+}
+
+#endif /* _brw_locking_h */
@@ -145,6 +145,9 @@ typedef struct cachedb_engines {
 #include "cachedb_cap.h"
 
 int register_cachedb(cachedb_engine* cde_entry);
+cachedb_engine* lookup_cachedb(str *name);
+/* NULL/empty group name returns the default connection of the engine */
+cachedb_con *cachedb_get_connection(cachedb_engine *cde,str *group_name);
 
 /* functions to be used from script */
 int cachedb_store(str* cachedb_engine, str* attr, str* val,int expires);
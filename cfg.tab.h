@@ -0,0 +1,317 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_CFG_TAB_H_INCLUDED
+# define YY_YY_CFG_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    FORWARD = 258,                 /* FORWARD  */
+    SEND = 259,                    /* SEND  */
+    DROP = 260,                    /* DROP  */
+    ASSERT = 261,                  /* ASSERT  */
+    EXIT = 262,                    /* EXIT  */
+    RETURN = 263,                  /* RETURN  */
+    LOG_TOK = 264,                 /* LOG_TOK  */
+    ERROR = 265,                   /* ERROR  */
+    ROUTE = 266,                   /* ROUTE  */
+    ROUTE_FAILURE = 267,           /* ROUTE_FAILURE  */
+    ROUTE_ONREPLY = 268,           /* ROUTE_ONREPLY  */
+    ROUTE_BRANCH = 269,            /* ROUTE_BRANCH  */
+    ROUTE_ERROR = 270,             /* ROUTE_ERROR  */
+    ROUTE_LOCAL = 271,             /* ROUTE_LOCAL  */
+    ROUTE_STARTUP = 272,           /* ROUTE_STARTUP  */
+    ROUTE_TIMER = 273,             /* ROUTE_TIMER  */
+    ROUTE_EVENT = 274,             /* ROUTE_EVENT  */
+    SET_HOST = 275,                /* SET_HOST  */
+    SET_HOSTPORT = 276,            /* SET_HOSTPORT  */
+    PREFIX = 277,                  /* PREFIX  */
+    STRIP = 278,                   /* STRIP  */
+    STRIP_TAIL = 279,              /* STRIP_TAIL  */
+    APPEND_BRANCH = 280,           /* APPEND_BRANCH  */
+    REMOVE_BRANCH = 281,           /* REMOVE_BRANCH  */
+    PV_PRINTF = 282,               /* PV_PRINTF  */
+    SET_USER = 283,                /* SET_USER  */
+    SET_USERPASS = 284,            /* SET_USERPASS  */
+    SET_PORT = 285,                /* SET_PORT  */
+    SET_URI = 286,                 /* SET_URI  */
+    REVERT_URI = 287,              /* REVERT_URI  */
+    SET_DSTURI = 288,              /* SET_DSTURI  */
+    RESET_DSTURI = 289,            /* RESET_DSTURI  */
+    ISDSTURISET = 290,             /* ISDSTURISET  */
+    FORCE_RPORT = 291,             /* FORCE_RPORT  */
+    FORCE_LOCAL_RPORT = 292,       /* FORCE_LOCAL_RPORT  */
+    FORCE_TCP_ALIAS = 293,         /* FORCE_TCP_ALIAS  */
+    IF = 294,                      /* IF  */
+    ELSE = 295,                    /* ELSE  */
+    SWITCH = 296,                  /* SWITCH  */
+    CASE = 297,                    /* CASE  */
+    DEFAULT = 298,                 /* DEFAULT  */
+    SBREAK = 299,                  /* SBREAK  */
+    WHILE = 300,                   /* WHILE  */
+    FOR = 301,                     /* FOR  */
+    IN = 302,                      /* IN  */
+    SET_ADV_ADDRESS = 303,         /* SET_ADV_ADDRESS  */
+    SET_ADV_PORT = 304,            /* SET_ADV_PORT  */
+    FORCE_SEND_SOCKET = 305,       /* FORCE_SEND_SOCKET  */
+    SERIALIZE_BRANCHES = 306,      /* SERIALIZE_BRANCHES  */
+    NEXT_BRANCHES = 307,           /* NEXT_BRANCHES  */
+    USE_BLACKLIST = 308,           /* USE_BLACKLIST  */
+    UNUSE_BLACKLIST = 309,         /* UNUSE_BLACKLIST  */
+    SETFLAG = 310,                 /* SETFLAG  */
+    RESETFLAG = 311,               /* RESETFLAG  */
+    ISFLAGSET = 312,               /* ISFLAGSET  */
+    SETBFLAG = 313,                /* SETBFLAG  */
+    RESETBFLAG = 314,              /* RESETBFLAG  */
+    ISBFLAGSET = 315,              /* ISBFLAGSET  */
+    METHOD = 316,                  /* METHOD  */
+    PROTO = 317,                   /* PROTO  */
+    AF = 318,                      /* AF  */
+    IS_MYSELF = 319,               /* IS_MYSELF  */
+    MSGLEN = 320,                  /* MSGLEN  */
+    NULLV = 321,                   /* NULLV  */
+    CACHE_STORE = 322,             /* CACHE_STORE  */
+    CACHE_FETCH = 323,             /* CACHE_FETCH  */
+    CACHE_COUNTER_FETCH = 324,     /* CACHE_COUNTER_FETCH  */
+    CACHE_REMOVE = 325,            /* CACHE_REMOVE  */
+    CACHE_ADD = 326,               /* CACHE_ADD  */
+    CACHE_SUB = 327,               /* CACHE_SUB  */
+    CACHE_RAW_QUERY = 328,         /* CACHE_RAW_QUERY  */
+    XDBG = 329,                    /* XDBG  */
+    XLOG = 330,                    /* XLOG  */
+    XLOG_BUF_SIZE = 331,           /* XLOG_BUF_SIZE  */
+    XLOG_FORCE_COLOR = 332,        /* XLOG_FORCE_COLOR  */
+    XLOG_DEFAULT_LEVEL = 333,      /* XLOG_DEFAULT_LEVEL  */
+    RAISE_EVENT = 334,             /* RAISE_EVENT  */
+    SUBSCRIBE_EVENT = 335,         /* SUBSCRIBE_EVENT  */
+    CONSTRUCT_URI = 336,           /* CONSTRUCT_URI  */
+    GET_TIMESTAMP = 337,           /* GET_TIMESTAMP  */
+    SCRIPT_TRACE = 338,            /* SCRIPT_TRACE  */
+    FORK = 339,                    /* FORK  */
+    DEBUG_MODE = 340,              /* DEBUG_MODE  */
+    DEBUG = 341,                   /* DEBUG  */
+    ENABLE_ASSERTS = 342,          /* ENABLE_ASSERTS  */
+    ABORT_ON_ASSERT = 343,         /* ABORT_ON_ASSERT  */
+    LOGLEVEL = 344,                /* LOGLEVEL  */
+    LOGSTDERROR = 345,             /* LOGSTDERROR  */
+    LOGFACILITY = 346,             /* LOGFACILITY  */
+    LOGNAME = 347,                 /* LOGNAME  */
+    AVP_ALIASES = 348,             /* AVP_ALIASES  */
+    LISTEN = 349,                  /* LISTEN  */
+    MEMGROUP = 350,                /* MEMGROUP  */
+    ALIAS = 351,                   /* ALIAS  */
+    AUTO_ALIASES = 352,            /* AUTO_ALIASES  */
+    DNS = 353,                     /* DNS  */
+    REV_DNS = 354,                 /* REV_DNS  */
+    DNS_TRY_IPV6 = 355,            /* DNS_TRY_IPV6  */
+    DNS_TRY_NAPTR = 356,           /* DNS_TRY_NAPTR  */
+    DNS_RETR_TIME = 357,           /* DNS_RETR_TIME  */
+    DNS_RETR_NO = 358,             /* DNS_RETR_NO  */
+    DNS_SERVERS_NO = 359,          /* DNS_SERVERS_NO  */
+    DNS_USE_SEARCH = 360,          /* DNS_USE_SEARCH  */
+    MAX_WHILE_LOOPS = 361,         /* MAX_WHILE_LOOPS  */
+    CHILDREN = 362,                /* CHILDREN  */
+    CHECK_VIA = 363,               /* CHECK_VIA  */
+    SHM_HASH_SPLIT_PERCENTAGE = 364, /* SHM_HASH_SPLIT_PERCENTAGE  */
+    SHM_SECONDARY_HASH_SIZE = 365, /* SHM_SECONDARY_HASH_SIZE  */
+    MEM_WARMING_ENABLED = 366,     /* MEM_WARMING_ENABLED  */
+    MEM_WARMING_PATTERN_FILE = 367, /* MEM_WARMING_PATTERN_FILE  */
+    MEM_WARMING_PERCENTAGE = 368,  /* MEM_WARMING_PERCENTAGE  */
+    MEMLOG = 369,                  /* MEMLOG  */
+    MEMDUMP = 370,                 /* MEMDUMP  */
+    EXECMSGTHRESHOLD = 371,        /* EXECMSGTHRESHOLD  */
+    EXECDNSTHRESHOLD = 372,        /* EXECDNSTHRESHOLD  */
+    TCPTHRESHOLD = 373,            /* TCPTHRESHOLD  */
+    EVENT_SHM_THRESHOLD = 374,     /* EVENT_SHM_THRESHOLD  */
+    EVENT_PKG_THRESHOLD = 375,     /* EVENT_PKG_THRESHOLD  */
+    QUERYBUFFERSIZE = 376,         /* QUERYBUFFERSIZE  */
+    QUERYFLUSHTIME = 377,          /* QUERYFLUSHTIME  */
+    SIP_WARNING = 378,             /* SIP_WARNING  */
+    SOCK_MODE = 379,               /* SOCK_MODE  */
+    SOCK_USER = 380,               /* SOCK_USER  */
+    SOCK_GROUP = 381,              /* SOCK_GROUP  */
+    UNIX_SOCK = 382,               /* UNIX_SOCK  */
+    UNIX_SOCK_CHILDREN = 383,      /* UNIX_SOCK_CHILDREN  */
+    UNIX_TX_TIMEOUT = 384,         /* UNIX_TX_TIMEOUT  */
+    SERVER_SIGNATURE = 385,        /* SERVER_SIGNATURE  */
+    SERVER_HEADER = 386,           /* SERVER_HEADER  */
+    USER_AGENT_HEADER = 387,       /* USER_AGENT_HEADER  */
+    LOADMODULE = 388,              /* LOADMODULE  */
+    MPATH = 389,                   /* MPATH  */
+    MODPARAM = 390,                /* MODPARAM  */
+    MAXBUFFER = 391,               /* MAXBUFFER  */
+    CHROOT = 392,                  /* CHROOT  */
+    WDIR = 393,                    /* WDIR  */
+    MHOMED = 394,                  /* MHOMED  */
+    POLL_METHOD = 395,             /* POLL_METHOD  */
+    TCP_ACCEPT_ALIASES = 396,      /* TCP_ACCEPT_ALIASES  */
+    TCP_CHILDREN = 397,            /* TCP_CHILDREN  */
+    TCP_CONNECT_TIMEOUT = 398,     /* TCP_CONNECT_TIMEOUT  */
+    TCP_CON_LIFETIME = 399,        /* TCP_CON_LIFETIME  */
+    TCP_LISTEN_BACKLOG = 400,      /* TCP_LISTEN_BACKLOG  */
+    TCP_MAX_CONNECTIONS = 401,     /* TCP_MAX_CONNECTIONS  */
+    TCP_NO_NEW_CONN_BFLAG = 402,   /* TCP_NO_NEW_CONN_BFLAG  */
+    TCP_KEEPALIVE = 403,           /* TCP_KEEPALIVE  */
+    TCP_KEEPCOUNT = 404,           /* TCP_KEEPCOUNT  */
+    TCP_KEEPIDLE = 405,            /* TCP_KEEPIDLE  */
+    TCP_KEEPINTERVAL = 406,        /* TCP_KEEPINTERVAL  */
+    TCP_MAX_MSG_TIME = 407,        /* TCP_MAX_MSG_TIME  */
+    ADVERTISED_ADDRESS = 408,      /* ADVERTISED_ADDRESS  */
+    ADVERTISED_PORT = 409,         /* ADVERTISED_PORT  */
+    DISABLE_CORE = 410,            /* DISABLE_CORE  */
+    OPEN_FD_LIMIT = 411,           /* OPEN_FD_LIMIT  */
+    MCAST_LOOPBACK = 412,          /* MCAST_LOOPBACK  */
+    MCAST_TTL = 413,               /* MCAST_TTL  */
+    TOS = 414,                     /* TOS  */
+    DISABLE_DNS_FAILOVER = 415,    /* DISABLE_DNS_FAILOVER  */
+    DISABLE_DNS_BLACKLIST = 416,   /* DISABLE_DNS_BLACKLIST  */
+    DST_BLACKLIST = 417,           /* DST_BLACKLIST  */
+    DISABLE_STATELESS_FWD = 418,   /* DISABLE_STATELESS_FWD  */
+    DB_VERSION_TABLE = 419,        /* DB_VERSION_TABLE  */
+    DB_DEFAULT_URL = 420,          /* DB_DEFAULT_URL  */
+    DB_MAX_ASYNC_CONNECTIONS = 421, /* DB_MAX_ASYNC_CONNECTIONS  */
+    DISABLE_503_TRANSLATION = 422, /* DISABLE_503_TRANSLATION  */
+    SYNC_TOKEN = 423,              /* SYNC_TOKEN  */
+    ASYNC_TOKEN = 424,             /* ASYNC_TOKEN  */
+    LAUNCH_TOKEN = 425,            /* LAUNCH_TOKEN  */
+    EQUAL = 426,                   /* EQUAL  */
+    EQUAL_T = 427,                 /* EQUAL_T  */
+    GT = 428,                      /* GT  */
+    LT = 429,                      /* LT  */
+    GTE = 430,                     /* GTE  */
+    LTE = 431,                     /* LTE  */
+    DIFF = 432,                    /* DIFF  */
+    MATCH = 433,                   /* MATCH  */
+    NOTMATCH = 434,                /* NOTMATCH  */
+    COLONEQ = 435,                 /* COLONEQ  */
+    PLUSEQ = 436,                  /* PLUSEQ  */
+    MINUSEQ = 437,                 /* MINUSEQ  */
+    SLASHEQ = 438,                 /* SLASHEQ  */
+    MULTEQ = 439,                  /* MULTEQ  */
+    MODULOEQ = 440,                /* MODULOEQ  */
+    BANDEQ = 441,                  /* BANDEQ  */
+    BOREQ = 442,                   /* BOREQ  */
+    BXOREQ = 443,                  /* BXOREQ  */
+    OR = 444,                      /* OR  */
+    AND = 445,                     /* AND  */
+    BOR = 446,                     /* BOR  */
+    BAND = 447,                    /* BAND  */
+    BXOR = 448,                    /* BXOR  */
+    BLSHIFT = 449,                 /* BLSHIFT  */
+    BRSHIFT = 450,                 /* BRSHIFT  */
+    PLUS = 451,                    /* PLUS  */
+    MINUS = 452,                   /* MINUS  */
+    MULT = 453,                    /* MULT  */
+    MODULO = 454,                  /* MODULO  */
+    NOT = 455,                     /* NOT  */
+    BNOT = 456,                    /* BNOT  */
+    NUMBER = 457,                  /* NUMBER  */
+    ZERO = 458,                    /* ZERO  */
+    ID = 459,                      /* ID  */
+    STRING = 460,                  /* STRING  */
+    SCRIPTVAR = 461,               /* SCRIPTVAR  */
+    IPV6ADDR = 462,                /* IPV6ADDR  */
+    IPV4ADDR = 463,                /* IPV4ADDR  */
+    IPNET = 464,                   /* IPNET  */
+    COMMA = 465,                   /* COMMA  */
+    SEMICOLON = 466,               /* SEMICOLON  */
+    RPAREN = 467,                  /* RPAREN  */
+    LPAREN = 468,                  /* LPAREN  */
+    LBRACE = 469,                  /* LBRACE  */
+    RBRACE = 470,                  /* RBRACE  */
+    LBRACK = 471,                  /* LBRACK  */
+    RBRACK = 472,                  /* RBRACK  */
+    SLASH = 473,                   /* SLASH  */
+    AS = 474,                      /* AS  */
+    USE_CHILDREN = 475,            /* USE_CHILDREN  */
+    DOT = 476,                     /* DOT  */
+    CR = 477,                      /* CR  */
+    COLON = 478,                   /* COLON  */
+    ANY = 479,                     /* ANY  */
+    ANYCAST = 480,                 /* ANYCAST  */
+    SCRIPTVARERR = 481             /* SCRIPTVARERR  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 205 "cfg.y"
+
+	long intval;
+	unsigned long uval;
+	char* strval;
+	struct expr* expr;
+	struct action* action;
+	struct net* ipnet;
+	struct ip_addr* ipaddr;
+	struct socket_id* sockid;
+	struct _pv_spec *specval;
+	struct multi_str* multistr;
+
+#line 303 "cfg.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_CFG_TAB_H_INCLUDED  */
@@ -50,6 +50,7 @@
 #include "db_id.h"
 #include "db_pool.h"
 #include "db.h"
+#include "db_ps_cache.h"
 
 char *db_version_table = VERSION_TABLE;
 char *db_default_url = NULL;
@@ -352,6 +353,9 @@ void db_do_close(db_con_t* _h, void (*free_connection)())
 		return;
 	}
 
+	/* the statements live on the (possibly shared) pooled connection */
+	db_ps_cache_destroy(_h);
+
 	con = (struct pool_con*)_h->tail;
 	if (pool_remove(con) == 1) {
 		free_connection(con);
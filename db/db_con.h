@@ -39,6 +39,7 @@ typedef struct {
 	const str* table;     /**< Default table that should be used */
 	db_ps_t* curr_ps;     /**< Prepared statement to be used for next query */
 	struct query_list *ins_list; /**< Insert list to be used for the next insert */
+	struct db_ps_cache *ps_cache; /**< Cached prepared statements, if enabled */
 	unsigned long tail;   /**< Hook to implementation-specific database state */
 	str url;              /**< URL that this connection is bound on */
 	int flags;
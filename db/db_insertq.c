@@ -135,8 +135,11 @@ void flush_query_list(void)
 			/* and let's insert the rows */
 			for (i=0;i<it->no_rows;i++)
 			{
-				if (it->dbf.insert(it->conn[process_no],it->cols,it->rows[i],
-							it->col_no) < 0)
+				if ((it->upsert ?
+				it->dbf.insert_update(it->conn[process_no],it->cols,
+					it->rows[i],it->col_no) :
+				it->dbf.insert(it->conn[process_no],it->cols,it->rows[i],
+					it->col_no)) < 0)
 					LM_ERR("failed to insert into DB\n");
 
 				shm_free(it->rows[i]);
@@ -326,7 +329,7 @@ int ql_row_add(query_list_t *entry,const db_val_t *row,db_val_t ***ins_rows)
 }
 
 /* initializez a new query entry */
-query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
+query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no,int upsert)
 {
 	int key_size,row_q_size,size,i;
 	char *pos;
@@ -376,6 +379,7 @@ query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
 	entry->cols = (db_key_t *)((char *)entry+sizeof(query_list_t)+
 								con->table->len);
 	entry->col_no = col_no;
+	entry->upsert = upsert;
 
 	pos = (char *)(entry->cols + col_no) + col_no * sizeof(str);
 	for (i=0;i<col_no;i++)
@@ -411,7 +415,8 @@ query_list_t *ql_init(db_con_t *con,db_key_t *cols,int col_no)
  * else, return NULL
  * assumes ql_lock is acquired
  */
-query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,int col_no)
+query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,
+															int col_no,int upsert)
 {
 	query_list_t *it,*entry=NULL;
 	int i;
@@ -429,6 +434,10 @@ query_list_t *find_query_list_unsafe(const str *table,db_key_t *cols,int col_no)
 			continue;
 		}
 
+		/* plain inserts and upserts of the same row never share a list */
+		if (it->upsert != upsert)
+			continue;
+
 		/* match table name */
 		if (it->table.len != table->len ||
 				memcmp(it->table.s,table->s,table->len) != 0)
@@ -463,13 +472,8 @@ next_query:
 	return entry;
 }
 
-/* set's the query_list that will be used for inserts
- * on the provided db connection
- *
- * also takes care of initialisation of this is the first process
- * attempting to execute this type of query */
-int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
-							db_key_t *cols,int col_no)
+static int _con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no,int upsert)
 {
 	query_list_t *entry;
 
@@ -491,14 +495,14 @@ int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
 	{
 		LM_DBG("first inslist call. searching for query list \n");
 		lock_get(ql_lock);
-		entry = find_query_list_unsafe(con->table,cols,col_no);
+		entry = find_query_list_unsafe(con->table,cols,col_no,upsert);
 		if (entry == NULL)
 		{
 			LM_DBG("couldn't find entry for this query\n");
 			/* first query of this type is done from this process,
 			 * it's my job to initialize the query list
 			 * and save for later use */
-			entry = ql_init(con,cols,col_no);
+			entry = ql_init(con,cols,col_no,upsert);
 			if (entry == NULL)
 			{
 				LM_ERR("failed to initialize ins queue\n");
@@ -533,6 +537,32 @@ int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
 	return 0;
 }
 
+/* set's the query_list that will be used for inserts
+ * on the provided db connection
+ *
+ * also takes care of initialisation of this is the first process
+ * attempting to execute this type of query */
+int con_set_inslist(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no)
+{
+	return _con_set_inslist(dbf,con,list,cols,col_no,0);
+}
+
+/* same as con_set_inslist(), but the queued rows are written with a
+ * multi-row "insert ... on duplicate key update", so the list may also
+ * carry updates of existing rows (given the key columns are part of it)
+ *
+ * the list is not set (and the insert is done right away) if the
+ * DB engine cannot insert multiple rows or update on duplicate key */
+int con_set_upsert_list(db_func_t *dbf,db_con_t *con,query_list_t **list,
+							db_key_t *cols,int col_no)
+{
+	if (!DB_CAPABILITY(*dbf,DB_CAP_INSERT_UPDATE))
+		return 0;
+
+	return _con_set_inslist(dbf,con,list,cols,col_no,1);
+}
+
 /* clean shm memory used by the rows */
 void cleanup_rows(db_val_t **rows)
 {
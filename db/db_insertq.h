@@ -53,6 +53,7 @@ typedef struct query_list {
 	gen_lock_t* lock;	/* lock for adding rows */
 	int no_rows;		/* number of rows in queue */
 	time_t oldest_query;	/* timestamp of oldest query in queue */
+	int upsert;			/* rows update the existing ones on duplicate key */
 	struct query_list *next;
 	struct query_list *prev;
 } query_list_t;
@@ -65,6 +66,8 @@ int ql_row_add(query_list_t *entry,const db_val_t *row,db_val_t ***ins_rows);
 int ql_detach_rows_unsafe(query_list_t *entry,db_val_t ***ins_rows);
 int con_set_inslist(db_func_t *dbf,db_con_t *con,
 							query_list_t **list,db_key_t *cols,int col_no);
+int con_set_upsert_list(db_func_t *dbf,db_con_t *con,
+							query_list_t **list,db_key_t *cols,int col_no);
 void ql_timer_routine(unsigned int ticks,void *param);
 int ql_flush_rows(db_func_t *dbf, db_con_t *conn,query_list_t *entry);
 
@@ -0,0 +1,257 @@
+/*
+ * Per-connection cache of prepared statements
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+#include <string.h>
+
+#include "../mem/mem.h"
+#include "../dprint.h"
+#include "../hash_func.h"
+#include "db_ps_cache.h"
+
+struct db_ps_entry {
+	unsigned int hash;
+	str shape;
+	db_ps_t ps;
+	struct db_ps_entry *prev;
+	struct db_ps_entry *next;
+};
+
+/* entries are kept in most recently used order */
+struct db_ps_cache {
+	int size;
+	int used;
+	db_ps_free_f free_f;
+	struct db_ps_entry *head;
+	struct db_ps_entry *tail;
+};
+
+/* scratch buffer for building the shape of the current query */
+static char *shape_buf;
+static int shape_size;
+static int shape_len;
+
+
+int db_ps_cache_init(db_con_t *_h, int size, db_ps_free_f free_f)
+{
+	struct db_ps_cache *cache;
+
+	if (!_h || size <= 0 || !free_f) {
+		LM_ERR("invalid parameters\n");
+		return -1;
+	}
+
+	cache = pkg_malloc(sizeof *cache);
+	if (!cache) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+	memset(cache, 0, sizeof *cache);
+
+	cache->size = size;
+	cache->free_f = free_f;
+	_h->ps_cache = cache;
+
+	return 0;
+}
+
+
+void db_ps_cache_destroy(db_con_t *_h)
+{
+	struct db_ps_cache *cache = _h->ps_cache;
+	struct db_ps_entry *e, *next;
+
+	if (!cache)
+		return;
+
+	for (e = cache->head; e; e = next) {
+		next = e->next;
+		if (e->ps)
+			cache->free_f(_h, e->ps);
+		pkg_free(e);
+	}
+
+	pkg_free(cache);
+	_h->ps_cache = NULL;
+}
+
+
+static int shape_add(const void *p, int len)
+{
+	char *buf;
+	int size;
+
+	if (shape_len + len > shape_size) {
+		size = shape_size ? 2 * shape_size : 256;
+		while (size < shape_len + len)
+			size *= 2;
+
+		buf = pkg_realloc(shape_buf, size);
+		if (!buf) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+
+		shape_buf = buf;
+		shape_size = size;
+	}
+
+	memcpy(shape_buf + shape_len, p, len);
+	shape_len += len;
+	return 0;
+}
+
+static inline int shape_add_str(const str *s)
+{
+	/* the length goes first, so that no separators are needed */
+	if (shape_add(&s->len, sizeof s->len) < 0)
+		return -1;
+
+	return s->len ? shape_add(s->s, s->len) : 0;
+}
+
+static inline int shape_add_keys(const db_key_t *_k, const db_op_t *_o,
+		const db_val_t *_v, int _n)
+{
+	str op;
+	char t[2];
+	int i;
+
+	if (shape_add(&_n, sizeof _n) < 0)
+		return -1;
+
+	for (i = 0; i < _n; i++) {
+		if (shape_add_str(_k[i]) < 0)
+			return -1;
+
+		if (_o) {
+			op.s = (char *)(_o[i] ? _o[i] : OP_EQ);
+			op.len = strlen(op.s);
+			if (shape_add_str(&op) < 0)
+				return -1;
+		}
+
+		if (_v) {
+			t[0] = (char)VAL_TYPE(_v + i);
+			t[1] = (char)VAL_NULL(_v + i);
+			if (shape_add(t, sizeof t) < 0)
+				return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void ps_entry_unlink(struct db_ps_cache *cache, struct db_ps_entry *e)
+{
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		cache->head = e->next;
+
+	if (e->next)
+		e->next->prev = e->prev;
+	else
+		cache->tail = e->prev;
+}
+
+static void ps_entry_push(struct db_ps_cache *cache, struct db_ps_entry *e)
+{
+	e->prev = NULL;
+	e->next = cache->head;
+	if (cache->head)
+		cache->head->prev = e;
+	else
+		cache->tail = e;
+	cache->head = e;
+}
+
+
+int db_ps_cache_set(const db_con_t *_h, enum db_ps_op op,
+		const db_key_t *_k, const db_op_t *_o, const db_val_t *_v, int _n,
+		const db_key_t *_uk, const db_val_t *_uv, int _un)
+{
+	struct db_ps_cache *cache = _h->ps_cache;
+	struct db_ps_entry *e;
+	unsigned char hdr[2];
+	unsigned int hash;
+	str shape;
+
+	if (!cache || !CON_TABLE(_h))
+		return -1;
+
+	shape_len = 0;
+
+	hdr[0] = (unsigned char)op;
+	hdr[1] = (unsigned char)(_h->flags & CON_OR_OPERATOR);
+	if (shape_add(hdr, sizeof hdr) < 0 ||
+	        shape_add_str(CON_TABLE(_h)) < 0 ||
+	        shape_add_keys(_k, _o, _v, _n) < 0 ||
+	        shape_add_keys(_uk, NULL, _uv, _un) < 0)
+		return -1;
+
+	shape.s = shape_buf;
+	shape.len = shape_len;
+	hash = core_hash(&shape, NULL, 0);
+
+	for (e = cache->head; e; e = e->next)
+		if (e->hash == hash && e->shape.len == shape.len &&
+		        !memcmp(e->shape.s, shape.s, shape.len))
+			break;
+
+	if (e) {
+		if (e != cache->head) {
+			ps_entry_unlink(cache, e);
+			ps_entry_push(cache, e);
+		}
+
+		CON_SET_CURR_PS(_h, &e->ps);
+		return 1;
+	}
+
+	if (cache->used == cache->size) {
+		/* evict the least recently used statement */
+		e = cache->tail;
+		ps_entry_unlink(cache, e);
+		if (e->ps)
+			cache->free_f(_h, e->ps);
+		pkg_free(e);
+		cache->used--;
+	}
+
+	e = pkg_malloc(sizeof *e + shape.len);
+	if (!e) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+
+	e->hash = hash;
+	e->ps = NULL;
+	e->shape.s = (char *)(e + 1);
+	e->shape.len = shape.len;
+	memcpy(e->shape.s, shape.s, shape.len);
+
+	ps_entry_push(cache, e);
+	cache->used++;
+
+	CON_SET_CURR_PS(_h, &e->ps);
+	return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Per-connection cache of prepared statements
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+/**
+ * \file db/db_ps_cache.h
+ * \brief Per-connection LRU cache of prepared statements
+ *
+ * Modules may hold their own db_ps_t slots and set them with
+ * CON_SET_CURR_PS() before each query. For the queries issued without
+ * such a slot, a driver supporting prepared statements may instead ask the
+ * cache for one: the slot is picked by the "shape" of the query (operation,
+ * table, column names, operators and value types), so every query sharing
+ * the same SQL text ends up reusing the same prepared statement.
+ *
+ * Only the statements returning no result set are cached - the rows of a
+ * result may point into the buffers of its statement, which would be
+ * shared by all the callers and released on eviction.
+ */
+
+#ifndef DB_PS_CACHE_H
+#define DB_PS_CACHE_H
+
+#include "db_con.h"
+#include "db_key.h"
+#include "db_op.h"
+#include "db_val.h"
+
+enum db_ps_op {
+	DB_PS_INSERT=0,
+	DB_PS_DELETE,
+	DB_PS_UPDATE,
+	DB_PS_REPLACE,
+};
+
+/**
+ * Called by the cache when a slot holding a statement gets evicted or when
+ * the cache is destroyed - the driver must release the statement.
+ */
+typedef void (*db_ps_free_f)(const db_con_t *_h, db_ps_t ps);
+
+/**
+ * Attach a cache of up to "size" statements to the connection.
+ * \return 0 on success, -1 on error
+ */
+int db_ps_cache_init(db_con_t *_h, int size, db_ps_free_f free_f);
+
+/**
+ * Release all the cached statements and the cache itself.
+ * Called by db_do_close(), drivers should not need it.
+ */
+void db_ps_cache_destroy(db_con_t *_h);
+
+/**
+ * Look up the slot matching the shape of the statement and set it as the
+ * current prepared statement of the connection. Any of the key arrays
+ * may be NULL if not used by the operation.
+ * \return 1 on hit, 0 on miss (a new, uninitialized slot was set) and -1 if
+ *         the connection has no cache or the query is not cacheable
+ */
+int db_ps_cache_set(const db_con_t *_h, enum db_ps_op op,
+		const db_key_t *_k, const db_op_t *_o, const db_val_t *_v, int _n,
+		const db_key_t *_uk, const db_val_t *_uv, int _un);
+
+#endif /* DB_PS_CACHE_H */
@@ -149,6 +149,30 @@ int db_do_raw_query(const db_con_t* _h, const str* _s, db_res_t** _r,
 }
 
 
+/* the update part of a multi-row upsert - every column takes the new value */
+static int db_print_upsert(char *_b, const int _l, const db_key_t *_k,
+																const int _n)
+{
+	int i, ret, len;
+
+	ret = snprintf(_b, _l, " on duplicate key update ");
+	if (ret < 0 || ret >= _l) goto error;
+	len = ret;
+
+	for (i = 0; i < _n; i++) {
+		ret = snprintf(_b + len, _l - len, "%.*s=values(%.*s)%s",
+			_k[i]->len, _k[i]->s, _k[i]->len, _k[i]->s, i==_n-1 ? "" : ",");
+		if (ret < 0 || ret >= (_l - len)) goto error;
+		len += ret;
+	}
+
+	return len;
+error:
+	LM_ERR("Error in snprintf\n");
+	return -1;
+}
+
+
 int db_do_insert(const db_con_t* _h, const db_key_t* _k, const db_val_t* _v,
 	const int _n, int (*val2str) (const db_con_t*, const db_val_t*, char*, int*),
 	int (*submit_query)(const db_con_t* _h, const str* _c))
@@ -253,6 +277,12 @@ build_query:
 				}
 			}
 
+			if (_h->ins_list->upsert) {
+				ret = db_print_upsert(sql_buf + off, SQL_BUF_LEN - off, _k, _n);
+				if (ret < 0) goto error0;
+				off += ret;
+			}
+
 			if (off + 1 > SQL_BUF_LEN) goto error0;
 			sql_buf[off] = '\0';
 			sql_str.s = sql_buf;
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <time.h>
+
+#include "../../str.h"
+#include "../db_con.h"
+#include "../db_ps_cache.h"
+
+#include "test_ps_cache.h"
+
+#define BENCH_QUERIES	1000000
+
+static int freed;
+static db_ps_t last_freed;
+
+static void fake_free_ps(const db_con_t *_h, db_ps_t ps)
+{
+	freed++;
+	last_freed = ps;
+}
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* runs an insert of @n columns into @table through the cache, the way
+ * a driver does, "preparing" the statement on a miss */
+static int cached_insert(db_con_t *con, const str *table, int n, int type,
+		long tag)
+{
+	static str names[] = {str_init("a"), str_init("b"), str_init("c"),
+		str_init("d"), str_init("e")};
+	static db_key_t keys[] = {&names[0], &names[1], &names[2], &names[3],
+		&names[4]};
+	db_val_t vals[5];
+	int i, ret;
+
+	memset(vals, 0, sizeof vals);
+	for (i = 0; i < n; i++)
+		VAL_TYPE(vals + i) = type;
+
+	CON_TABLE(con) = table;
+	ret = db_ps_cache_set(con, DB_PS_INSERT, keys, NULL, vals, n,
+		NULL, NULL, 0);
+	if (ret == 0)
+		*con->curr_ps = (db_ps_t)tag;
+	CON_RESET_CURR_PS(con);
+
+	return ret;
+}
+
+static void test_ps_cache_lru(db_con_t *con)
+{
+	str t1 = str_init("location"), t2 = str_init("dialog");
+
+	ok(cached_insert(con, &t1, 3, DB_INT, 1) == 0, "ps_cache: first is a miss");
+	ok(cached_insert(con, &t1, 3, DB_INT, 0) == 1, "ps_cache: same shape hits");
+	ok(cached_insert(con, &t1, 3, DB_STR, 2) == 0,
+		"ps_cache: other value types miss");
+	ok(cached_insert(con, &t1, 2, DB_INT, 3) == 0,
+		"ps_cache: other columns miss");
+	ok(cached_insert(con, &t2, 3, DB_INT, 4) == 0,
+		"ps_cache: other table misses");
+	ok(freed == 0, "ps_cache: nothing evicted while not full");
+
+	/* refresh the first statement, so the second one is the oldest */
+	ok(cached_insert(con, &t1, 3, DB_INT, 0) == 1, "ps_cache: hit again");
+	ok(cached_insert(con, &t2, 4, DB_INT, 5) == 0, "ps_cache: miss when full");
+	ok(freed == 1 && last_freed == (db_ps_t)2,
+		"ps_cache: the least recently used statement is released");
+	ok(cached_insert(con, &t1, 3, DB_INT, 0) == 1,
+		"ps_cache: the recently used statement is kept");
+
+	db_ps_cache_destroy(con);
+	ok(freed == 5 && con->ps_cache == NULL,
+		"ps_cache: all the statements are released on destroy");
+}
+
+static void bench_ps_cache(db_con_t *con)
+{
+	str tables[16];
+	char names[16][16];
+	unsigned long long start;
+	int i, hits = 0;
+
+	for (i = 0; i < 16; i++) {
+		tables[i].s = names[i];
+		tables[i].len = sprintf(names[i], "table_%d", i);
+		cached_insert(con, &tables[i], 5, DB_STR, i + 1);
+	}
+
+	start = now_ns();
+	for (i = 0; i < BENCH_QUERIES; i++)
+		if (cached_insert(con, &tables[i % 16], 5, DB_STR, 0) == 1)
+			hits++;
+
+	ok(hits == BENCH_QUERIES, "ps_cache: %d lookups over 16 statements, "
+		"%llu ns per hit", BENCH_QUERIES,
+		(now_ns() - start) / BENCH_QUERIES);
+
+	db_ps_cache_destroy(con);
+}
+
+void test_db_ps_cache(void)
+{
+	db_con_t con;
+
+	memset(&con, 0, sizeof con);
+	if (!ok(db_ps_cache_init(&con, 4, fake_free_ps) == 0,
+	        "ps_cache: init a 4 statements cache"))
+		return;
+	test_ps_cache_lru(&con);
+
+	if (!ok(db_ps_cache_init(&con, 16, fake_free_ps) == 0,
+	        "ps_cache: init a 16 statements cache"))
+		return;
+	bench_ps_cache(&con);
+}
@@ -124,6 +124,7 @@
 #include "ipc.h"
 
 #include "pt.h"
+#include "rcu.h"
 #include "ut.h"
 #include "serialize.h"
 #include "statistics.h"
@@ -334,6 +335,7 @@ void cleanup(int show_status)
 	udp_destroy();
 	tcp_destroy();
 	destroy_timer();
+	destroy_rcu();
 	destroy_stats_collector();
 	destroy_script_cb();
 	pv_free_extra_list();
@@ -1368,6 +1370,12 @@ try_again:
 		goto error;
 	}
 
+	/* init the lockless readers support - needs the process table */
+	if (init_rcu()!=0) {
+		LM_ERR("failed to init RCU support\n");
+		goto error;
+	}
+
 	#ifdef PKG_MALLOC
 	/* init stats support for pkg mem */
 	if (init_pkg_stats(counted_processes)!=0) {
@@ -29,6 +29,7 @@
 #include <string.h>
 #include "str.h"
 #include "map.h"
+#include "hash_func.h"
 
 #include "mem/mem.h"
 #include "mem/shm_mem.h"
@@ -67,6 +68,168 @@ static int str_cmp(str s1, str s2)
 }
 
 
+/* MAP_HASHED backend: linear probing over a power of 2 sized slot array.
+   The nodes are allocated one by one, same as for the AVL tree, so the
+   value pointers handed out stay valid across resizes. Removals only
+   mark the slot as deleted - iterating while removing is safe. */
+
+#define MAP_HDELETED	((struct avl_node *)-1)
+#define MAP_HMIN_SIZE	8
+
+#define hslot_live(_hs) \
+	((_hs)->node != NULL && (_hs)->node != MAP_HDELETED)
+
+static inline unsigned int map_hash(str *key)
+{
+	return core_hash(key, NULL, 0);
+}
+
+/* the maps are often picked out of an array by the low bits of the same
+   core_hash() (usrloc slots, dialog profile entries), so all the keys of a
+   map would share them - start probing from the high bits of a Fibonacci
+   multiply instead */
+static inline unsigned int hmap_idx(unsigned int hash, unsigned int size)
+{
+	return (hash * 2654435769U) >> (32 - __builtin_ctz(size));
+}
+
+/* returns the slot holding the key, or NULL if not found */
+static struct map_hslot *hmap_lookup(map_t map, str *key, unsigned int hash)
+{
+	struct map_hslot *hs;
+	unsigned int i, mask;
+
+	if (!map->ht)
+		return NULL;
+
+	mask = map->ht_size - 1;
+	for (i = hmap_idx(hash, map->ht_size); ; i = (i + 1) & mask) {
+		hs = &map->ht[i];
+		if (hs->node == NULL)
+			return NULL;
+
+		if (hs->node != MAP_HDELETED && hs->hash == hash &&
+			hs->node->key.len == key->len &&
+			memcmp(hs->node->key.s, key->s, key->len) == 0)
+			return hs;
+	}
+}
+
+static int hmap_resize(map_t map, unsigned int size)
+{
+	struct map_hslot *ht, *hs;
+	unsigned int i, j, mask;
+
+	avl_malloc(ht, size * sizeof *ht, map->flags);
+	if (ht == NULL)
+		return -1;
+	memset(ht, 0, size * sizeof *ht);
+
+	mask = size - 1;
+	for (i = 0; i < map->ht_size; i++) {
+		hs = &map->ht[i];
+		if (!hslot_live(hs))
+			continue;
+
+		for (j = hmap_idx(hs->hash, size); ht[j].node; j = (j + 1) & mask) ;
+		ht[j] = *hs;
+	}
+
+	if (map->ht)
+		avl_free(map->ht, map->flags);
+
+	map->ht = ht;
+	map->ht_size = size;
+	map->ht_used = map->avl_count;
+
+	return 0;
+}
+
+static void ** hmap_get(map_t map, str key)
+{
+	struct map_hslot *hs;
+	struct avl_node *n;
+	unsigned int hash, i, mask, size;
+	str key_copy;
+
+	hash = map_hash(&key);
+
+	hs = hmap_lookup(map, &key, hash);
+	if (hs)
+		return &hs->node->val;
+
+	/* keep the load (deleted slots included) under 3/4 */
+	if ((map->ht_used + 1) * 4 > map->ht_size * 3) {
+		for (size = MAP_HMIN_SIZE; size < (map->avl_count + 1) * 2; size <<= 1) ;
+		if (hmap_resize(map, size) < 0)
+			return NULL;
+	}
+
+	avl_malloc(n, sizeof *n, map->flags);
+	if (n == NULL)
+		return NULL;
+	memset(n, 0, sizeof *n);
+
+	if( !( map->flags & AVLMAP_NO_DUPLICATE ) )
+	{
+		avl_malloc(key_copy.s, key.len, map->flags );
+		if (key_copy.s == NULL) {
+			avl_free(n, map->flags);
+			return NULL;
+		}
+
+		memcpy(key_copy.s,key.s,key.len);
+		key_copy.len = key.len;
+		n->key = key_copy;
+	}
+	else
+		n->key = key;
+
+	/* reuse the first deleted slot on the probing path, if any */
+	mask = map->ht_size - 1;
+	for (i = hmap_idx(hash, map->ht_size); hslot_live(&map->ht[i]);
+		i = (i + 1) & mask) ;
+
+	if (map->ht[i].node == NULL)
+		map->ht_used++;
+	map->ht[i].hash = hash;
+	map->ht[i].node = n;
+	map->avl_count++;
+
+	return &n->val;
+}
+
+static void * hmap_delete(map_t map, struct map_hslot *hs)
+{
+	void *val = hs->node->val;
+
+	if( !( map->flags & AVLMAP_NO_DUPLICATE ) )
+		avl_free(hs->node->key.s, map->flags);
+	avl_free(hs->node, map->flags);
+
+	hs->node = MAP_HDELETED;
+	map->avl_count--;
+
+	return val;
+}
+
+/* positions the iterator on the first live slot starting from "idx",
+   walking in the "dir" direction */
+static void hmap_seek(map_iterator_t *it, unsigned int idx, int dir)
+{
+	map_t map = it->map;
+
+	for (; idx < map->ht_size; idx += dir)
+		if (hslot_live(&map->ht[idx])) {
+			it->idx = idx;
+			it->node = map->ht[idx].node;
+			return;
+		}
+
+	it->node = NULL;
+}
+
+
 /* Creates and returns a new table
    with comparison function |compare| using parameter |param|
    and memory allocator |allocator|.
@@ -85,6 +248,9 @@ map_t map_create(enum map_flags flags)
 	tree->flags = flags;
 	tree->avl_count = 0;
 
+	tree->ht = NULL;
+	tree->ht_size = tree->ht_used = 0;
+
 
 	return tree;
 }
@@ -94,6 +260,12 @@ map_t map_create(enum map_flags flags)
 void ** map_find( map_t tree, str key)
 {
 	struct avl_node *p;
+	struct map_hslot *hs;
+
+	if (tree->flags & MAP_HASHED) {
+		hs = hmap_lookup(tree, &key, map_hash(&key));
+		return hs ? &hs->node->val : NULL;
+	}
 
 	for (p = tree->avl_root; p != NULL;) {
 		int cmp = str_cmp(key, p->key);
@@ -124,6 +296,9 @@ void ** map_get( map_t tree, str key)
 	int dir;		/* Direction to descend. */
 	str key_copy;
 
+	if (tree->flags & MAP_HASHED)
+		return hmap_get(tree, key);
+
 	y = tree->avl_root;
 	dir = 0;
 	for (q = NULL, p = tree->avl_root; p != NULL; q = p, p = p->avl_link[dir]) {
@@ -447,6 +622,12 @@ void * map_remove( map_t tree, str key)
 {
 	struct avl_node *p; /* Traverses tree to find node to delete. */
 	int dir; /* Side of |q| on which |p| is linked. */
+	struct map_hslot *hs;
+
+	if (tree->flags & MAP_HASHED) {
+		hs = hmap_lookup(tree, &key, map_hash(&key));
+		return hs ? hmap_delete(tree, hs) : NULL;
+	}
 
 	if (tree->avl_root == NULL)
 		return NULL;
@@ -475,6 +656,26 @@ void * map_remove( map_t tree, str key)
 void map_destroy( map_t tree, value_destroy_func destroy)
 {
 	struct avl_node *p, *q;
+	unsigned int i;
+
+	if (tree->flags & MAP_HASHED) {
+		for (i = 0; i < tree->ht_size; i++) {
+			if (!hslot_live(&tree->ht[i]))
+				continue;
+			p = tree->ht[i].node;
+
+			if (destroy != NULL && p->val != NULL)
+				destroy(p->val);
+			if( !(tree->flags & AVLMAP_NO_DUPLICATE ) )
+				avl_free( p->key.s,tree->flags);
+			avl_free( p, tree->flags );
+		}
+
+		if (tree->ht)
+			avl_free( tree->ht, tree->flags );
+		avl_free( tree, tree->flags );
+		return;
+	}
 
 	for (p = tree->avl_root; p != NULL; p = q)
 		if (p->avl_link[0] == NULL) {
@@ -517,8 +718,19 @@ void process_all( map_t tree,  struct avl_node *p, process_each_func f, void * p
 
 int map_for_each( map_t tree, process_each_func f, void * param)
 {
+	unsigned int i;
+
 	tree->ret_code = 0;
 
+	if (tree->flags & MAP_HASHED) {
+		for (i = 0; i < tree->ht_size && !tree->ret_code; i++)
+			if (hslot_live(&tree->ht[i]))
+				tree->ret_code |= f( param, tree->ht[i].node->key,
+					tree->ht[i].node->val);
+
+		return tree->ret_code;
+	}
+
 	if( tree->avl_root )
 		process_all( tree, tree->avl_root, f, param);
 
@@ -534,6 +746,11 @@ int map_first( map_t map, map_iterator_t * it)
 
 	it->map = map;
 
+	if (map->flags & MAP_HASHED) {
+		hmap_seek(it, 0, 1);
+		return 0;
+	}
+
 	it->node = map->avl_root;
 
 	if( it->node )
@@ -553,6 +770,12 @@ int map_last( map_t map, map_iterator_t * it)
 
 	it->map = map;
 
+	if (map->flags & MAP_HASHED) {
+		/* unsigned - walks down until wrapping around */
+		hmap_seek(it, map->ht_size - 1, -1);
+		return 0;
+	}
+
 	it->node = map->avl_root;
 
 	if( it->node )
@@ -596,6 +819,11 @@ int iterator_next( map_iterator_t * it  )
 	if( it == NULL || it->map ==NULL || it->node == NULL)
 		return -1;
 
+	if (it->map->flags & MAP_HASHED) {
+		hmap_seek(it, it->idx + 1, 1);
+		return 0;
+	}
+
 	if( it->node->avl_link[1] )
 	{
 		it->node = it->node->avl_link[1];
@@ -626,6 +854,11 @@ int iterator_prev( map_iterator_t * it  )
 	if( it == NULL || it->map ==NULL || it->node == NULL)
 		return -1;
 
+	if (it->map->flags & MAP_HASHED) {
+		hmap_seek(it, it->idx - 1, -1);
+		return 0;
+	}
+
 	if( it->node->avl_link[0] )
 	{
 		it->node = it->node->avl_link[0];
@@ -654,6 +887,17 @@ void * iterator_delete( map_iterator_t * it  )
 	if( it == NULL || it->map ==NULL || it->node == NULL)
 		return NULL;
 
+	if (it->map->flags & MAP_HASHED) {
+		/* the slot may have been reused if the map changed meanwhile */
+		if (it->idx >= it->map->ht_size ||
+			it->map->ht[it->idx].node != it->node)
+			return NULL;
+
+		ret = hmap_delete( it->map, &it->map->ht[it->idx] );
+		it->node = NULL;
+		return ret;
+	}
+
 	ret = delete_node( it->map, it->node );
 
 	it->node = NULL;
@@ -41,8 +41,16 @@ enum map_flags
 {
 	AVLMAP_SHARED = 1,		/* determines if the map is to be allocated in
 				shared or private memory */
-	AVLMAP_NO_DUPLICATE = 2	/* determines if the map will duplicate added keys*/
+	AVLMAP_NO_DUPLICATE = 2,	/* determines if the map will duplicate added keys*/
+	MAP_HASHED = 4		/* use an open addressing hash table instead of the
+				AVL tree - O(1) lookups, but no key ordering */
+};
 
+/* Hash table slot - the key hash is kept next to the node, so a probe
+ * rarely needs to look at the node (and compare the keys) at all */
+struct map_hslot {
+	unsigned int hash;
+	struct avl_node *node;	/* NULL - free, MAP_HDELETED - deleted */
 };
 
 /* Tree data structure. */
@@ -52,12 +60,17 @@ typedef struct avl_table {
 	size_t avl_count;		/* Number of items in tree. */
 	int ret_code;
 
+	/* MAP_HASHED only */
+	struct map_hslot *ht;		/* Slots, power of 2 sized */
+	unsigned int ht_size;
+	unsigned int ht_used;		/* Used slots, including deleted ones */
 } *map_t;
 
 /* Iterator data structure. */
 typedef struct avl_iterator {
 	struct avl_node * node;		/* Current node. */
 	map_t map;			/* The map that this iterator points to*/
+	unsigned int idx;		/* Current slot, for MAP_HASHED maps */
 } map_iterator_t;
 
 
@@ -98,6 +111,9 @@ typedef  int (* process_each_func )(void * param, str key, void * value);
  *
  * AVLMAP_SHARED -> flag for shared memory
  * AVLMAP_NO_DUPLICATE -> flag for key duplication
+ * MAP_HASHED -> flag for the hash table backend. The API is the same,
+ *   but the iteration order is arbitrary and inserting into the map
+ *   invalidates the iterators (not the value pointers, though)
  *
  */
 
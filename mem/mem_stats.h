@@ -0,0 +1,163 @@
+/* This file is auto-generated by running "make generate-mem-stats" */
+/* You should NOT edit this file manually */
+#ifdef SHM_EXTRA_STATS
+#ifndef __MEM_STAT_H_
+#define __MEM_STAT_H_
+extern unsigned long core_mem_stat; /* core statistic */
+extern unsigned long exec_mem_stat;
+extern unsigned long cachedb_redis_mem_stat;
+extern unsigned long registrar_mem_stat;
+extern unsigned long cachedb_local_mem_stat;
+extern unsigned long identity_mem_stat;
+extern unsigned long presence_xcapdiff_mem_stat;
+extern unsigned long json_mem_stat;
+extern unsigned long stun_mem_stat;
+extern unsigned long mediaproxy_mem_stat;
+extern unsigned long cfgutils_mem_stat;
+extern unsigned long permissions_mem_stat;
+extern unsigned long event_route_mem_stat;
+extern unsigned long b2b_entities_mem_stat;
+extern unsigned long options_mem_stat;
+extern unsigned long db_postgres_mem_stat;
+extern unsigned long dialog_mem_stat;
+extern unsigned long uri_mem_stat;
+extern unsigned long cachedb_mongodb_mem_stat;
+extern unsigned long xml_mem_stat;
+extern unsigned long lua_mem_stat;
+extern unsigned long rtpengine_mem_stat;
+extern unsigned long ratelimit_mem_stat;
+extern unsigned long proto_bin_mem_stat;
+extern unsigned long peering_mem_stat;
+extern unsigned long event_jsonrpc_mem_stat;
+extern unsigned long pua_usrloc_mem_stat;
+extern unsigned long rls_mem_stat;
+extern unsigned long event_virtual_mem_stat;
+extern unsigned long cachedb_couchbase_mem_stat;
+extern unsigned long nat_traversal_mem_stat;
+extern unsigned long perl_mem_stat;
+extern unsigned long db_cachedb_mem_stat;
+extern unsigned long auth_mem_stat;
+extern unsigned long enum_mem_stat;
+extern unsigned long mi_fifo_mem_stat;
+extern unsigned long mi_http_mem_stat;
+extern unsigned long presence_mwi_mem_stat;
+extern unsigned long pua_xmpp_mem_stat;
+extern unsigned long db_text_mem_stat;
+extern unsigned long jsonrpc_mem_stat;
+extern unsigned long call_center_mem_stat;
+extern unsigned long db_virtual_mem_stat;
+extern unsigned long sql_cacher_mem_stat;
+extern unsigned long carrierroute_mem_stat;
+extern unsigned long nathelper_mem_stat;
+extern unsigned long acc_mem_stat;
+extern unsigned long db_oracle_mem_stat;
+extern unsigned long aaa_radius_mem_stat;
+extern unsigned long mi_datagram_mem_stat;
+extern unsigned long clusterer_mem_stat;
+extern unsigned long dialplan_mem_stat;
+extern unsigned long b2b_sca_mem_stat;
+extern unsigned long speeddial_mem_stat;
+extern unsigned long auth_db_mem_stat;
+extern unsigned long mid_registrar_mem_stat;
+extern unsigned long group_mem_stat;
+extern unsigned long event_flatstore_mem_stat;
+extern unsigned long db_unixodbc_mem_stat;
+extern unsigned long statistics_mem_stat;
+extern unsigned long proto_hep_mem_stat;
+extern unsigned long diversion_mem_stat;
+extern unsigned long sms_mem_stat;
+extern unsigned long jabber_mem_stat;
+extern unsigned long cgrates_mem_stat;
+extern unsigned long emergency_mem_stat;
+extern unsigned long seas_mem_stat;
+extern unsigned long db_http_mem_stat;
+extern unsigned long presence_mem_stat;
+extern unsigned long ldap_mem_stat;
+extern unsigned long pua_mem_stat;
+extern unsigned long siprec_mem_stat;
+extern unsigned long siptrace_mem_stat;
+extern unsigned long pua_mi_mem_stat;
+extern unsigned long benchmark_mem_stat;
+extern unsigned long maxfwd_mem_stat;
+extern unsigned long python_mem_stat;
+extern unsigned long xcap_mem_stat;
+extern unsigned long sl_mem_stat;
+extern unsigned long uac_registrant_mem_stat;
+extern unsigned long event_rabbitmq_mem_stat;
+extern unsigned long sipcapture_mem_stat;
+extern unsigned long db_berkeley_mem_stat;
+extern unsigned long presence_xml_mem_stat;
+extern unsigned long compression_mem_stat;
+extern unsigned long cachedb_sql_mem_stat;
+extern unsigned long xmpp_mem_stat;
+extern unsigned long call_control_mem_stat;
+extern unsigned long sst_mem_stat;
+extern unsigned long pua_dialoginfo_mem_stat;
+extern unsigned long freeswitch_scripting_mem_stat;
+extern unsigned long dispatcher_mem_stat;
+extern unsigned long auth_aaa_mem_stat;
+extern unsigned long b2b_logic_mem_stat;
+extern unsigned long uac_auth_mem_stat;
+extern unsigned long drouting_mem_stat;
+extern unsigned long mi_json_mem_stat;
+extern unsigned long db_flatstore_mem_stat;
+extern unsigned long pi_http_mem_stat;
+extern unsigned long uac_redirect_mem_stat;
+extern unsigned long event_datagram_mem_stat;
+extern unsigned long usrloc_mem_stat;
+extern unsigned long tls_mgm_mem_stat;
+extern unsigned long mmgeoip_mem_stat;
+extern unsigned long mathops_mem_stat;
+extern unsigned long presence_callinfo_mem_stat;
+extern unsigned long userblacklist_mem_stat;
+extern unsigned long osp_mem_stat;
+extern unsigned long textops_mem_stat;
+extern unsigned long cachedb_cassandra_mem_stat;
+extern unsigned long freeswitch_mem_stat;
+extern unsigned long sipmsgops_mem_stat;
+extern unsigned long imc_mem_stat;
+extern unsigned long mangler_mem_stat;
+extern unsigned long script_helper_mem_stat;
+extern unsigned long snmpstats_mem_stat;
+extern unsigned long avpops_mem_stat;
+extern unsigned long event_xmlrpc_mem_stat;
+extern unsigned long tm_mem_stat;
+extern unsigned long proto_ws_mem_stat;
+extern unsigned long db_perlvdb_mem_stat;
+extern unsigned long presence_dialoginfo_mem_stat;
+extern unsigned long proto_sctp_mem_stat;
+extern unsigned long domainpolicy_mem_stat;
+extern unsigned long path_mem_stat;
+extern unsigned long uac_mem_stat;
+extern unsigned long dns_cache_mem_stat;
+extern unsigned long gflags_mem_stat;
+extern unsigned long qos_mem_stat;
+extern unsigned long rabbitmq_mem_stat;
+extern unsigned long rtpproxy_mem_stat;
+extern unsigned long db_sqlite_mem_stat;
+extern unsigned long cachedb_memcached_mem_stat;
+extern unsigned long msilo_mem_stat;
+extern unsigned long proto_tls_mem_stat;
+extern unsigned long load_balancer_mem_stat;
+extern unsigned long h350_mem_stat;
+extern unsigned long pike_mem_stat;
+extern unsigned long signaling_mem_stat;
+extern unsigned long cpl_c_mem_stat;
+extern unsigned long regex_mem_stat;
+extern unsigned long alias_db_mem_stat;
+extern unsigned long rest_client_mem_stat;
+extern unsigned long db_mysql_mem_stat;
+extern unsigned long domain_mem_stat;
+extern unsigned long topology_hiding_mem_stat;
+extern unsigned long sip_i_mem_stat;
+extern unsigned long rr_mem_stat;
+extern unsigned long event_routing_mem_stat;
+extern unsigned long mi_xmlrpc_ng_mem_stat;
+extern unsigned long fraud_detection_mem_stat;
+extern unsigned long proto_wss_mem_stat;
+extern unsigned long xcap_client_mem_stat;
+extern unsigned long httpd_mem_stat;
+extern unsigned long pua_bla_mem_stat;
+#endif /* __MEM_STAT_H_ */
+#endif /* SHM_EXTRA_STATS */
+/* modules MD5: 25f01dd25569f683a00475dfe2ef855d */
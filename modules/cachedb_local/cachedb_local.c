@@ -39,6 +39,7 @@
 #include "../../mi/tree.h"
 
 #include "cachedb_local.h"
+#include "lcache_replication.h"
 #include "hash.h"
 
 #include <fnmatch.h>
@@ -51,6 +52,12 @@ static void destroy(void);
 
 int cache_clean_period = 600;
 int local_exec_threshold = 0;
+int cache_max_memory = 0;
+int lcache_repl_cluster = 0;
+
+stat_var *lcache_hits;
+stat_var *lcache_misses;
+stat_var *lcache_evictions;
 
 lcache_col_t* lcache_collection = NULL;
 url_lst_t* url_list=NULL;
@@ -63,9 +70,12 @@ struct mi_root * mi_cache_remove_chunk(struct mi_root *cmd_tree,void *param);
 void localcache_clean(unsigned int ticks,void *param);
 static int parse_collections(unsigned int type, void *val);
 static int store_urls(unsigned int type, void *val);
+static unsigned long lcache_get_memory(void *foo);
 
 static param_export_t params[]={
 	{ "cache_clean_period", INT_PARAM, &cache_clean_period },
+	{ "cache_max_memory",   INT_PARAM, &cache_max_memory },
+	{ "cluster_id",         INT_PARAM, &lcache_repl_cluster },
 	{ "exec_threshold",     INT_PARAM, &local_exec_threshold },
 	{ "cache_collections",  STR_PARAM|USE_FUNC_PARAM, (void *)parse_collections },
 	{ "cachedb_url",        STR_PARAM|USE_FUNC_PARAM, (void *)store_urls },
@@ -82,22 +92,40 @@ static cmd_export_t cmds[]= {
 	{0,0,0,0,0,0}
 };
 
+static stat_export_t mod_stats[] = {
+	{"cache_hits",      0,             &lcache_hits      },
+	{"cache_misses",    0,             &lcache_misses    },
+	{"cache_evictions", 0,             &lcache_evictions },
+	{"cache_memory",    STAT_IS_FUNC,  (stat_var**)lcache_get_memory },
+	{0,0,0}
+};
+
 static mi_export_t mi_cmds[] = {
 	{ "cache_remove_chunk",           0, mi_cache_remove_chunk,         0,  0,  0},
 	{ 0, 0, 0, 0, 0, 0}
 };
 
+static dep_export_t deps = {
+	{ /* OpenSIPS module dependencies */
+		{ MOD_TYPE_NULL, NULL, 0 },
+	},
+	{ /* modparam dependencies */
+		{ "cluster_id", get_deps_clusterer },
+		{ NULL, NULL },
+	},
+};
+
 /** module exports */
 struct module_exports exports= {
 	"cachedb_local",               /* module name */
 	MOD_TYPE_CACHEDB,/* class of this module */
 	MODULE_VERSION,
 	DEFAULT_DLFLAGS,            /* dlopen flags */
-	NULL,            /* OpenSIPS module dependencies */
+	&deps,           /* OpenSIPS module dependencies */
 	cmds,                       /* exported functions */
 	0,                          /* exported async functions */
 	params,                     /* exported parameters */
-	0,                          /* exported statistics */
+	mod_stats,                  /* exported statistics */
 	mi_cmds,                    /* exported MI functions */
 	0,                          /* exported pseudo-variables */
 	0,							/* exported transformations */
@@ -171,10 +199,10 @@ static int remove_chunk_f(struct sip_msg* msg, char* collection, char* glob)
 
 	for(i = 0; i< col->size; i++) {
 		lock_get(&cache_htable[i].lock);
-		me1 = cache_htable[i].entries;
-		me2 = NULL;
 
-		while(me1) {
+		for (me1 = cache_htable[i].entries; me1; me1 = me2) {
+			me2 = me1->next;
+
 			if (me1->attr.len + 1 > key_buff_size) {
 				key_buff = pkg_realloc(key_buff,me1->attr.len+1);
 				if (key_buff == NULL) {
@@ -196,18 +224,7 @@ static int remove_chunk_f(struct sip_msg* msg, char* collection, char* glob)
 				LM_DBG("[%.*s] matches glob [%.*s] - removing from bucket %d\n",
 						me1->attr.len, me1->attr.s,pat_buff_size,pat_buff,i);
 
-				if(me2) {
-					me2->next = me1->next;
-					shm_free(me1);
-					me1 = me2->next;
-				} else{
-					cache_htable[i].entries = me1->next;
-					shm_free(me1);
-					me1 = cache_htable[i].entries;
-				}
-			} else {
-				me2 = me1;
-				me1 = me1->next;
+				lcache_htable_drop(col, &cache_htable[i], me1);
 			}
 		}
 		lock_release(&cache_htable[i].lock);
@@ -326,6 +343,7 @@ static int mod_init(void)
 
 	url_lst_t *it=url_list, *foo=NULL;
 	lcache_col_t *default_col, *col_it;
+	int replicated_cols = 0;
 
 	memset(&cde, 0, sizeof cde);
 
@@ -349,6 +367,11 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if (cache_max_memory < 0) {
+		LM_ERR("Wrong parameter cache_max_memory - need a positive value\n");
+		return -1;
+	}
+
 	if( register_cachedb(&cde)< 0)
 	{
 		LM_ERR("failed to register to core memory store interface\n");
@@ -369,6 +392,7 @@ static int mod_init(void)
 			LM_ERR("no more shared memory!\n");
 			return -1;
 		}
+		memset(default_col, 0, sizeof(lcache_col_t));
 
 		default_col->col_name.s = DEFAULT_COLLECTION_NAME;
 		default_col->col_name.len = sizeof(DEFAULT_COLLECTION_NAME) - 1;
@@ -428,9 +452,47 @@ static int mod_init(void)
 		}
 	}
 
-	/* register timer to delete the expired entries */
+	if (lcache_repl_cluster < 0) {
+		LM_ERR("Invalid cluster_id, must be 0 or a positive cluster id\n");
+		return -1;
+	}
+
+	for ( col_it=lcache_collection; col_it; col_it=col_it->next )
+		if ( col_it->replicated ) {
+			if ( !lcache_repl_cluster ) {
+				LM_WARN("no cluster_id defined, collection <%.*s> will not "
+					"be replicated!\n", col_it->col_name.len, col_it->col_name.s);
+				col_it->replicated = 0;
+			} else {
+				replicated_cols++;
+			}
+		}
+
+	if ( replicated_cols ) {
+		if (load_clusterer_api(&clusterer_api) < 0) {
+			LM_DBG("failed to load clusterer API - is clusterer module loaded?\n");
+			return -1;
+		}
+
+		if (clusterer_api.register_capability(&lcache_repl_cap,
+		receive_lcache_repl, receive_lcache_cluster_event,
+		lcache_repl_cluster, 1) < 0) {
+			LM_ERR("cannot register clusterer callback for replication!\n");
+			return -1;
+		}
+
+		if (clusterer_api.request_sync(&lcache_repl_cap, lcache_repl_cluster) < 0)
+			LM_ERR("sync request failed\n");
+	} else if ( lcache_repl_cluster ) {
+		LM_WARN("cluster_id defined, but no collection is marked as "
+			"replicated!\n");
+	}
+
+	/* register timer to delete the expired entries; each run only goes
+	 * through a slice of the buckets, so that every bucket gets checked
+	 * once per cache_clean_period */
 	register_timer("localcache-expire",localcache_clean, 0,
-		cache_clean_period, TIMER_FLAG_DELAY_ON_DELAY);
+		1, TIMER_FLAG_DELAY_ON_DELAY);
 
 	return 0;
 }
@@ -457,58 +519,30 @@ static void destroy(void)
 
 void localcache_clean(unsigned int ticks,void *param)
 {
-	int i;
-	lcache_entry_t* me1, *me2;
 	lcache_col_t* it;
-	lcache_t* cache_htable;
 
-	for ( it=lcache_collection; it; it=it->next ) {
-		LM_DBG("start\n");
-		cache_htable = it->col_htable;
-
-		for(i = 0; i< it->size; i++)
-		{
-			lock_get(&cache_htable[i].lock);
-			me1 = cache_htable[i].entries;
-			me2 = NULL;
-
-			while(me1)
-			{
-				if((me1->expires > 0) && (me1->expires < get_ticks()))
-				{
-					LM_DBG("deleted entry attr= [%.*s]\n",
-							me1->attr.len, me1->attr.s);
-
-					if(me2)
-					{
-						me2->next = me1->next;
-						shm_free(me1);
-						me1 = me2->next;
-					}
-					else
-					{
-						cache_htable[i].entries = me1->next;
-						shm_free(me1);
-						me1 = cache_htable[i].entries;
-					}
-				}
-				else
-				{
-					me2 = me1;
-					me1 = me1->next;
-				}
-			}
+	for ( it=lcache_collection; it; it=it->next )
+		lcache_htable_clean(it,
+			(it->size + cache_clean_period - 1) / cache_clean_period);
+}
 
-			lock_release(&cache_htable[i].lock);
-		}
-	}
+static unsigned long lcache_get_memory(void *foo)
+{
+	lcache_col_t* it;
+	unsigned long mem = 0;
+
+	for ( it=lcache_collection; it; it=it->next )
+		mem += it->mem;
+
+	return mem;
 }
 
 /* !!!WARNNG!!! unsafe function
  * input and output strings must be allocated
  * input string will be modified
  * returns 0 if no element in list,*/
-static inline int get_next_collection(str* lst, str* cname, unsigned int* csize)
+static inline int get_next_collection(str* lst, str* cname, unsigned int* csize,
+		int *replicated)
 {
 	char* tok_end;
 
@@ -567,12 +601,22 @@ static inline int get_next_collection(str* lst, str* cname, unsigned int* csize)
 		*csize = HASH_SIZE_DEFAULT;
 	}
 
+	/* "/r" after the name marks a replicated collection */
+	str_trim_spaces_lr(*cname);
+	*replicated = 0;
+	if (cname->len > 2 && cname->s[cname->len - 2] == '/' &&
+	(cname->s[cname->len - 1] == 'r' || cname->s[cname->len - 1] == 'R')) {
+		cname->len -= 2;
+		str_trim_spaces_lr(*cname);
+		*replicated = 1;
+	}
+
 	return 1;
 }
 
 static int parse_collections(unsigned int type, void* val)
 {
-	int rc;
+	int rc, replicated;
 	unsigned coll_size;
 	str collection_list, coll;
 
@@ -588,7 +632,8 @@ static int parse_collections(unsigned int type, void* val)
 
 	str_trim_spaces_lr(collection_list);
 
-	while ((rc=get_next_collection(&collection_list, &coll, &coll_size)) != 0) {
+	while ((rc=get_next_collection(&collection_list, &coll, &coll_size,
+	&replicated)) != 0) {
 		if ( rc < 0 ) {
 			LM_ERR("error occurred!\n");
 			return -1;
@@ -612,6 +657,7 @@ static int parse_collections(unsigned int type, void* val)
 		memset(new_col, 0, sizeof(lcache_col_t));
 
 		new_col->col_name = coll;
+		new_col->replicated = replicated;
 		new_col->size = (1 << coll_size);
 		if (lcache_htable_init(&new_col->col_htable, new_col->size) < 0) {
 			LM_ERR("failed to initialize htable for collection <%.*s>!\n",
@@ -29,6 +29,7 @@
 
 #include "../../cachedb/cachedb.h"
 #include "../../cachedb/cachedb_cap.h"
+#include "../../statistics.h"
 #include "hash.h"
 
 #define HASH_SIZE_DEFAULT 9 /* power of two */
@@ -36,6 +37,11 @@
 
 extern int cache_htable_size;
 extern int local_exec_threshold;
+extern int cache_max_memory;
+
+extern stat_var *lcache_hits;
+extern stat_var *lcache_misses;
+extern stat_var *lcache_evictions;
 
 typedef struct {
 	struct cachedb_id *id;
@@ -56,6 +62,16 @@ typedef struct lcache_col {
 	 * if not used we'll need to throw an error */
 	int is_used;
 
+	/* writes are replicated to the other nodes of the cluster */
+	int replicated;
+
+	/* memory used by the entries, checked against cache_max_memory;
+	 * updated with atomic ops, as the writers only hold a bucket lock */
+	unsigned long mem;
+	/* next bucket to evict from (atomic) / to clean up */
+	unsigned int evict_idx;
+	unsigned int clean_idx;
+
 	struct lcache_col* next;
 } lcache_col_t;
 
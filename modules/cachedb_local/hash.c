@@ -26,17 +26,18 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/time.h>
 
 #include "../../dprint.h"
 #include "../../ut.h"
 #include "../../timer.h"
+#include "../../hash_func.h"
 #include "../../mem/mem.h"
 #include "../../mem/shm_mem.h"
 #include "cachedb_local.h"
+#include "lcache_replication.h"
 #include "hash.h"
 
-void lcache_htable_remove_safe(str attr, lcache_entry_t** it);
-
 int lcache_htable_init(lcache_t** cache_htable_p, int size)
 {
 	int i = 0, j;
@@ -102,240 +103,530 @@ void lcache_htable_destroy(lcache_t** cache_htable_p, int size)
 	*cache_htable_p = NULL;
 }
 
-int lcache_htable_insert(cachedb_con *con,str* attr, str* value, int expires)
+static inline lcache_col_t* get_con_col(cachedb_con *con)
 {
-	lcache_entry_t* me, *it;
-	int hash_code;
-	int size;
-	struct timeval start;
-
-	lcache_t* cache_htable;
 	lcache_col_t* cache_col;
 
 	cache_col = ((lcache_con*)con->data)->col;
-	if ( !cache_col ) {
-		LM_ERR("url <%.*s> does not have any collection associated with!",
+	if ( !cache_col )
+		LM_ERR("url <%.*s> does not have any collection associated with!\n",
 				con->url.len, con->url.s);
-		return -1;
-	}
 
-	cache_htable = cache_col->col_htable;
+	return cache_col;
+}
 
-	size= sizeof(lcache_entry_t) + attr->len + value->len;
+static inline void update_col_mem(lcache_col_t *col, long diff)
+{
+	__sync_add_and_fetch(&col->mem, (unsigned long)diff);
+}
 
-	me = (lcache_entry_t*)shm_malloc(size);
+static inline void entry_unlink(lcache_t *bucket, lcache_entry_t *me)
+{
+	if (me->prev)
+		me->prev->next = me->next;
+	else
+		bucket->entries = me->next;
+
+	if (me->next)
+		me->next->prev = me->prev;
+	else
+		bucket->last = me->prev;
+}
+
+/* links the entry as the most recently used one of the bucket */
+static inline void entry_push(lcache_t *bucket, lcache_entry_t *me)
+{
+	me->prev = NULL;
+	me->next = bucket->entries;
+	if (bucket->entries)
+		bucket->entries->prev = me;
+	else
+		bucket->last = me;
+	bucket->entries = me;
+
+	if (me->expires &&
+	(bucket->next_expire == 0 || me->expires < bucket->next_expire))
+		bucket->next_expire = me->expires;
+}
+
+static lcache_entry_t* entry_new(str *attr, unsigned int hash, str *value,
+		unsigned int expires, int cnt_no)
+{
+	lcache_entry_t* me;
+
+	me = (lcache_entry_t*)shm_malloc(sizeof(lcache_entry_t) +
+			cnt_no * sizeof(lcache_cnt_t) + attr->len + value->len);
 	if(me == NULL)
 	{
 		LM_ERR("no more shared memory\n");
-		return -1;
+		return NULL;
 	}
-	memset(me, 0, size);
 
-	start_expire_timer(start,local_exec_threshold);
+	me->cnt = (lcache_cnt_t*)(me + 1);
+	me->cnt_no = cnt_no;
+	me->cnt_base = 0;
+	me->tomb = 0;
 
-	me->attr.s = (char*)me + (sizeof(lcache_entry_t));
+	me->attr.s = (char*)(me->cnt + cnt_no);
 	memcpy(me->attr.s, attr->s, attr->len);
 	me->attr.len = attr->len;
 
-	me->value.s = (char*)me + (sizeof(lcache_entry_t)) + attr->len;
+	me->value.s = me->attr.s + attr->len;
 	memcpy(me->value.s, value->s, value->len);
 	me->value.len = value->len;
-	if( expires != 0)
-		me->expires = get_ticks() + expires;
 
-	hash_code= core_hash( attr, 0, cache_col->size);
-	lock_get(&cache_htable[hash_code].lock);
+	me->hash = hash;
+	me->expires = expires;
+	me->ts = 0;
+	me->prev = me->next = NULL;
 
-	it = cache_htable[hash_code].entries;
+	return me;
+}
 
-	/* if a previous record for the same attr delete it */
-	lcache_htable_remove_safe( *attr, &it);
+/* must be called with the bucket lock held */
+static lcache_entry_t* entry_find(lcache_t *bucket, str *attr,
+		unsigned int hash)
+{
+	lcache_entry_t* it;
 
-	me->next = it;
-	cache_htable[hash_code].entries = me;
+	for (it = bucket->entries; it; it = it->next)
+		if (it->hash == hash && it->attr.len == attr->len &&
+				memcmp(it->attr.s, attr->s, attr->len) == 0)
+			return it;
 
-	lock_release(&cache_htable[hash_code].lock);
+	return NULL;
+}
 
-	stop_expire_timer(start,local_exec_threshold,
-	"cachedb_local insert",attr->s,attr->len,0);
-	return 1;
+/* same as entry_find(), but an expired entry is dropped on the spot */
+static lcache_entry_t* entry_find_valid(lcache_col_t *col, lcache_t *bucket,
+		str *attr, unsigned int hash)
+{
+	lcache_entry_t* it;
+
+	it = entry_find(bucket, attr, hash);
+	if (it && it->expires != 0 && it->expires < get_ticks()) {
+		lcache_htable_drop(col, bucket, it);
+		return NULL;
+	}
+
+	return it;
 }
 
-void lcache_htable_remove_safe(str attr, lcache_entry_t** it_p)
+/* same as entry_find_valid(), but a removed key is not found either */
+static lcache_entry_t* entry_lookup(lcache_col_t *col, lcache_t *bucket,
+		str *attr, unsigned int hash)
 {
-	lcache_entry_t* me = NULL, *it= *it_p;
+	lcache_entry_t* it;
 
-	while(it)
-	{
-		if(it->attr.len == attr.len &&
-				(strncmp(it->attr.s, attr.s, attr.len) == 0))
-		{
+	it = entry_find_valid(col, bucket, attr, hash);
+	return (it && it->tomb) ? NULL : it;
+}
 
-			if(me)
-				me->next = it->next;
-			else
-				*it_p = it->next;
+/* the position of the node in the shares of the counter, or -1 */
+static int cnt_find(lcache_cnt_t *cnt, int cnt_no, int node)
+{
+	int i;
 
-			shm_free(it);
+	for (i = 0; i < cnt_no; i++)
+		if (cnt[i].node == node)
+			return i;
+
+	return -1;
+}
+
+/* replaces the previous entry for the same attr, if any */
+static void entry_store(lcache_col_t *col, lcache_t *bucket,
+		lcache_entry_t *me, lcache_entry_t *old)
+{
+	long diff = lcache_entry_size(me);
+
+	if (old) {
+		entry_unlink(bucket, old);
+		diff -= lcache_entry_size(old);
+		shm_free(old);
+	}
+
+	entry_push(bucket, me);
+	update_col_mem(col, diff);
+}
+
+void lcache_htable_drop(lcache_col_t *col, lcache_t *bucket,
+		lcache_entry_t *me)
+{
+	entry_unlink(bucket, me);
+	update_col_mem(col, -(long)lcache_entry_size(me));
+	shm_free(me);
+}
+
+/*
+ * Throws away the least recently used entries, one bucket at a time, until
+ * the collection fits again into cache_max_memory. Only one bucket lock is
+ * held at a time, so it must be called with no bucket lock held.
+ */
+static void lcache_evict(lcache_col_t *col)
+{
+	lcache_t *bucket;
+	unsigned int i;
+	int idle;
+
+	if (!cache_max_memory)
+		return;
 
-			return;
+	for (idle = 0; col->mem > (unsigned long)cache_max_memory << 10 &&
+	idle < col->size; ) {
+		i = __sync_fetch_and_add(&col->evict_idx, 1) & (col->size - 1);
+
+		bucket = &col->col_htable[i];
+
+		lock_get(&bucket->lock);
+		if (bucket->last) {
+			LM_DBG("evicting entry attr= [%.*s]\n",
+					bucket->last->attr.len, bucket->last->attr.s);
+			lcache_htable_drop(col, bucket, bucket->last);
+			update_stat(lcache_evictions, 1);
+			idle = 0;
+		} else {
+			idle++;
 		}
-		me = it;
-		it = it->next;
+		lock_release(&bucket->lock);
 	}
-	LM_DBG("entry not found\n");
 }
 
-int lcache_htable_remove(cachedb_con *con,str* attr)
+static inline unsigned long long lcache_now(void)
 {
-	int hash_code;
-	struct timeval start;
+	struct timeval tv;
 
-	lcache_t* cache_htable;
-	lcache_col_t* cache_col;
+	gettimeofday(&tv, NULL);
+	return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
 
-	cache_col = ((lcache_con*)con->data)->col;
-	if ( !cache_col ) {
-		LM_ERR("url <%.*s> does not have any collection associated with!",
-				con->url.len, con->url.s);
+int _lcache_htable_insert(lcache_col_t *col, str *attr, str *value,
+		int expires, unsigned long long ts, int isrepl)
+{
+	lcache_entry_t *me, *old;
+	unsigned int hash;
+	lcache_t* bucket;
+
+	if (col->replicated && !isrepl)
+		ts = lcache_now();
+
+	hash = core_hash(attr, 0, 0);
+	me = entry_new(attr, hash, value, expires ? get_ticks() + expires : 0, 0);
+	if (me == NULL)
 		return -1;
+	me->ts = ts;
+
+	bucket = &col->col_htable[hash & (col->size - 1)];
+	lock_get(&bucket->lock);
+
+	old = entry_find(bucket, attr, hash);
+	if (isrepl && old && old->ts > ts) {
+		/* we already have a more recent set or remove */
+		lock_release(&bucket->lock);
+		shm_free(me);
+		return 1;
 	}
 
-	cache_htable = cache_col->col_htable;
+	/* if a previous record for the same attr delete it */
+	entry_store(col, bucket, me, old);
 
+	lock_release(&bucket->lock);
 
-	start_expire_timer(start,local_exec_threshold);
+	lcache_evict(col);
 
-	hash_code= core_hash( attr, 0, cache_col->size);
-	lock_get(&cache_htable[hash_code].lock);
+	if (col->replicated && !isrepl)
+		replicate_lcache_insert(col, attr, value, expires, ts);
 
-	lcache_htable_remove_safe( *attr, &cache_htable[hash_code].entries);
+	return 1;
+}
 
-	lock_release(&cache_htable[hash_code].lock);
+int lcache_htable_insert(cachedb_con *con,str* attr, str* value, int expires)
+{
+	lcache_col_t* cache_col;
+	struct timeval start;
+	int rc;
+
+	cache_col = get_con_col(con);
+	if ( !cache_col )
+		return -1;
+
+	start_expire_timer(start,local_exec_threshold);
+
+	rc = _lcache_htable_insert(cache_col, attr, value, expires, 0, 0);
 
 	stop_expire_timer(start,local_exec_threshold,
-	"cachedb_local remove",attr->s,attr->len,0);
+	"cachedb_local insert",attr->s,attr->len,0);
+	return rc;
+}
+
+int _lcache_htable_remove(lcache_col_t *col, str *attr,
+		unsigned long long ts, int isrepl)
+{
+	lcache_entry_t *me, *tomb = NULL;
+	unsigned int hash;
+	lcache_t* bucket;
+	str empty = {NULL, 0};
+
+	if (col->replicated && !isrepl)
+		ts = lcache_now();
+
+	hash = core_hash(attr, 0, 0);
+
+	/* the writes older than the removal may still be on their way from the
+	 * other nodes, so leave a tombstone behind to reject them */
+	if (col->replicated) {
+		tomb = entry_new(attr, hash, &empty, get_ticks() + LCACHE_TOMB_TTL, 0);
+		if (tomb) {
+			tomb->tomb = 1;
+			tomb->ts = ts;
+		}
+	}
+
+	bucket = &col->col_htable[hash & (col->size - 1)];
+	lock_get(&bucket->lock);
+
+	me = entry_find(bucket, attr, hash);
+	if (me && isrepl && me->ts > ts) {
+		LM_DBG("entry written after the removal\n");
+		if (tomb)
+			shm_free(tomb);
+	} else if (tomb) {
+		entry_store(col, bucket, tomb, me);
+	} else if (me) {
+		lcache_htable_drop(col, bucket, me);
+	} else {
+		LM_DBG("entry not found\n");
+	}
+
+	lock_release(&bucket->lock);
+
+	if (tomb)
+		lcache_evict(col);
+
+	if (col->replicated && !isrepl)
+		replicate_lcache_remove(col, attr, ts);
 
 	return 0;
 }
 
-int lcache_htable_add(cachedb_con *con,str *attr,int val,int expires,int *new_val)
+int lcache_htable_remove(cachedb_con *con,str* attr)
 {
-	int hash_code;
-	lcache_entry_t *it=NULL,*it_prev=NULL;
-	int old_value;
-	char *new_value;
-	int new_len;
-	str ins_val;
-	struct timeval start;
-
-	lcache_t* cache_htable;
 	lcache_col_t* cache_col;
+	struct timeval start;
+	int rc;
 
-	cache_col = ((lcache_con*)con->data)->col;
-	if ( !cache_col ) {
-		LM_ERR("url <%.*s> does not have any collection associated with!",
-				con->url.len, con->url.s);
+	cache_col = get_con_col(con);
+	if ( !cache_col )
 		return -1;
-	}
-
-	cache_htable = cache_col->col_htable;
 
 	start_expire_timer(start,local_exec_threshold);
 
-	hash_code = core_hash(attr,0,cache_col->size);
-	lock_get(&cache_htable[hash_code].lock);
-
-	it = cache_htable[hash_code].entries;
-	while (it) {
-		if (it->attr.len == attr->len &&
-				memcmp(it->attr.s,attr->s,attr->len) == 0) {
-			if (it->expires !=0 && it->expires < get_ticks()) {
-				/* found an expired entry  -> delete it */
-				if(it_prev)
-					it_prev->next = it->next;
-				else
-					cache_htable[hash_code].entries = it->next;
-
-				shm_free(it);
-				lock_release(&cache_htable[hash_code].lock);
-
-				ins_val.s = sint2str(val,&ins_val.len);
-				if (lcache_htable_insert(con,attr,&ins_val,expires) < 0) {
-					LM_ERR("failed to insert value\n");
-					stop_expire_timer(start,local_exec_threshold,
-					"cachedb_local add",attr->s,attr->len,0);
-					return -1;
-				}
-
-				if (new_val)
-					*new_val = val;
-
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local add",attr->s,attr->len,0);
-				return 0;
-			}
+	rc = _lcache_htable_remove(cache_col, attr, 0, 0);
 
-			/* found our valid entry */
-			if (str2sint(&it->value,&old_value) < 0) {
-				LM_ERR("not an integer\n");
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local add",attr->s,attr->len,0);
-				return -1;
-			}
+	stop_expire_timer(start,local_exec_threshold,
+	"cachedb_local remove",attr->s,attr->len,0);
 
-			old_value+=val;
-			expires = it->expires;
-			new_value = sint2str(old_value,&new_len);
-			it = shm_realloc(it,sizeof(lcache_entry_t) + attr->len +new_len);
-			if (it == NULL) {
-				LM_ERR("failed to realloc struct\n");
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local add",attr->s,attr->len,0);
-				return -1;
-			}
+	return rc;
+}
+
+int _lcache_htable_add(lcache_col_t *col, str *attr, int val, int expires,
+		int *new_val, unsigned long long ts, int node, int isrepl)
+{
+	lcache_entry_t *it, *me;
+	unsigned int hash;
+	int base, sum, i, idx, cnt_no, old_no, fresh;
+	str ins_val;
+	lcache_t* bucket;
+
+	if (col->replicated && !isrepl) {
+		ts = lcache_now();
+		node = clusterer_api.get_my_id();
+	}
+
+	hash = core_hash(attr, 0, 0);
+	bucket = &col->col_htable[hash & (col->size - 1)];
+	lock_get(&bucket->lock);
 
-			if (it_prev)
-				it_prev->next = it;
-			else
-				cache_htable[hash_code].entries = it;
-
-			it->attr.s = (char*)(it + 1);
-			it->value.s =(char *)(it + 1) + attr->len;
-			it->expires = expires;
-
-			memcpy(it->value.s,new_value,new_len);
-			it->value.len = new_len;
-			lock_release(&cache_htable[hash_code].lock);
-			if (new_val)
-				*new_val = old_value;
-			stop_expire_timer(start,local_exec_threshold,
-			"cachedb_local add",attr->s,attr->len,0);
-			return 0;
+	it = entry_find_valid(col, bucket, attr, hash);
+	if (it && isrepl && it->ts > ts) {
+		/* done before the last set/remove of the key, so overwritten */
+		lock_release(&bucket->lock);
+		return 0;
+	}
+
+	base = 0;
+	if (it && !it->tomb) {
+		/* found our valid entry */
+		if (it->cnt_no) {
+			base = it->cnt_base;
+		} else if (str2sint(&it->value,&base) < 0) {
+			LM_ERR("not an integer\n");
+			lock_release(&bucket->lock);
+			return -1;
 		}
+	}
 
-		it_prev = it;
-		it = it->next;
+	/* on the replicated collections, each node keeps its own share of
+	 * the counter, so the shares can be merged on sync */
+	old_no = (it && !it->tomb) ? it->cnt_no : 0;
+	cnt_no = old_no;
+	idx = -1;
+	if (col->replicated) {
+		idx = cnt_find(old_no ? it->cnt : NULL, old_no, node);
+		if (idx < 0)
+			idx = cnt_no++;
 	}
 
-	lock_release(&cache_htable[hash_code].lock);
+	sum = base + val;
+	for (i = 0; i < old_no; i++)
+		sum += it->cnt[i].sum;
 
-	/* not found */
-	ins_val.s = sint2str(val,&ins_val.len);
-	if (lcache_htable_insert(con,attr,&ins_val,expires) < 0) {
+	ins_val.s = sint2str(sum,&ins_val.len);
+	/* an existing entry keeps its expire time */
+	me = entry_new(attr, hash, &ins_val, (it && !it->tomb) ? it->expires :
+		(expires ? get_ticks() + expires : 0), cnt_no);
+	if (me == NULL) {
 		LM_ERR("failed to insert value\n");
-		stop_expire_timer(start,local_exec_threshold,
-		"cachedb_local add",attr->s,attr->len,0);
+		lock_release(&bucket->lock);
 		return -1;
 	}
 
+	if (idx >= 0) {
+		if (old_no)
+			memcpy(me->cnt, it->cnt, old_no * sizeof(lcache_cnt_t));
+		if (idx == old_no) {
+			me->cnt[idx].node = node;
+			me->cnt[idx].sum = 0;
+			me->cnt[idx].ts = 0;
+		}
+		me->cnt[idx].sum += val;
+		if (ts > me->cnt[idx].ts)
+			me->cnt[idx].ts = ts;
+		me->cnt_base = base;
+	}
+	/* the increments of all the nodes add up, so only the last set/remove
+	 * decides which of them still count */
+	me->ts = it ? it->ts : 0;
+	fresh = !it || it->tomb;
+
+	entry_store(col, bucket, me, it);
+
+	lock_release(&bucket->lock);
+
+	if (fresh)
+		lcache_evict(col);
+
 	if (new_val)
-		*new_val = val;
+		*new_val = sum;
+
+	if (col->replicated && !isrepl)
+		replicate_lcache_add(col, attr, val, expires, ts);
+
+	return 0;
+}
+
+/*
+ * Merges an entry pulled from another node on sync. The key goes to the
+ * most recent set/remove, as for the live writes, but the shares of the
+ * nodes in a counter set at the same time are merged, each node's most
+ * recent share winning, so no increment gets lost or counted twice.
+ */
+int lcache_htable_sync(lcache_col_t *col, str *attr, str *value,
+		int expires, unsigned long long ts, int cnt_base, lcache_cnt_t *cnt,
+		int cnt_no)
+{
+	lcache_entry_t *old, *me;
+	lcache_cnt_t *shares = NULL;
+	unsigned int hash;
+	lcache_t* bucket;
+	int i, j, n, sum, merge;
+	str ins_val;
+
+	hash = core_hash(attr, 0, 0);
+	bucket = &col->col_htable[hash & (col->size - 1)];
+	lock_get(&bucket->lock);
+
+	old = entry_find_valid(col, bucket, attr, hash);
+	if (old && (old->ts > ts ||
+	(old->ts == ts && (old->tomb || !cnt_no)))) {
+		/* more recent here, or the same set with no increments to add */
+		lock_release(&bucket->lock);
+		return 0;
+	}
+
+	merge = old && old->ts == ts && old->cnt_no;
+
+	n = 0;
+	if (cnt_no) {
+		shares = pkg_malloc((cnt_no + (merge ? old->cnt_no : 0)) *
+			sizeof *shares);
+		if (!shares) {
+			LM_ERR("no more pkg memory\n");
+			lock_release(&bucket->lock);
+			return -1;
+		}
+
+		memcpy(shares, cnt, cnt_no * sizeof *shares);
+		n = cnt_no;
+		for (i = 0; merge && i < old->cnt_no; i++) {
+			j = cnt_find(shares, cnt_no, old->cnt[i].node);
+			if (j < 0)
+				shares[n++] = old->cnt[i];
+			else if (old->cnt[i].ts > shares[j].ts)
+				shares[j] = old->cnt[i];
+		}
+
+		for (i = 0, sum = cnt_base; i < n; i++)
+			sum += shares[i].sum;
+		ins_val.s = sint2str(sum, &ins_val.len);
+	} else {
+		ins_val = *value;
+	}
+
+	me = entry_new(attr, hash, &ins_val, merge ? old->expires :
+		(expires ? get_ticks() + expires : 0), n);
+	if (me == NULL) {
+		lock_release(&bucket->lock);
+		if (shares)
+			pkg_free(shares);
+		return -1;
+	}
+
+	if (n)
+		memcpy(me->cnt, shares, n * sizeof *shares);
+	me->cnt_base = cnt_base;
+	me->ts = ts;
+
+	entry_store(col, bucket, me, old);
+
+	lock_release(&bucket->lock);
+
+	if (shares)
+		pkg_free(shares);
+
+	if (!merge)
+		lcache_evict(col);
+
+	return 0;
+}
+
+int lcache_htable_add(cachedb_con *con,str *attr,int val,int expires,int *new_val)
+{
+	lcache_col_t* cache_col;
+	struct timeval start;
+	int rc;
+
+	cache_col = get_con_col(con);
+	if ( !cache_col )
+		return -1;
+
+	start_expire_timer(start,local_exec_threshold);
+
+	rc = _lcache_htable_add(cache_col, attr, val, expires, new_val, 0, 0, 0);
+
 	stop_expire_timer(start,local_exec_threshold,
 	"cachedb_local add",attr->s,attr->len,0);
-	return 0;
+	return rc;
 }
 
 int lcache_htable_sub(cachedb_con *con,str *attr,int val,int expires,int *new_val)
@@ -351,146 +642,146 @@ int lcache_htable_sub(cachedb_con *con,str *attr,int val,int expires,int *new_va
  * */
 int lcache_htable_fetch(cachedb_con *con,str* attr, str* res)
 {
-	int hash_code;
-	lcache_entry_t* it = NULL, *it_aux = NULL;
+	lcache_entry_t* it;
+	unsigned int hash;
 	char* value;
 	struct timeval start;
 
-	lcache_t* cache_htable;
+	lcache_t* bucket;
 	lcache_col_t* cache_col;
 
-	cache_col = ((lcache_con*)con->data)->col;
-
-	if ( !cache_col ) {
-		LM_ERR("url <%.*s> does not have any collection associated with!",
-				con->url.len, con->url.s);
+	cache_col = get_con_col(con);
+	if ( !cache_col )
 		return -1;
-	}
-
-	cache_htable = cache_col->col_htable;
 
 	start_expire_timer(start,local_exec_threshold);
 
-	hash_code= core_hash( attr, 0, cache_col->size);
-	lock_get(&cache_htable[hash_code].lock);
+	hash = core_hash(attr, 0, 0);
+	bucket = &cache_col->col_htable[hash & (cache_col->size - 1)];
+	lock_get(&bucket->lock);
 
-	it = cache_htable[hash_code].entries;
+	it = entry_lookup(cache_col, bucket, attr, hash);
+	if (it == NULL) {
+		lock_release(&bucket->lock);
+		update_stat(lcache_misses, 1);
+		stop_expire_timer(start,local_exec_threshold,
+		"cachedb_local fetch",attr->s,attr->len,0);
+		return -2;
+	}
 
-	while(it)
+	value = (char*)pkg_malloc(it->value.len);
+	if(value == NULL)
 	{
-		if(it->attr.len == attr->len &&
-				(strncmp(it->attr.s, attr->s, attr->len) == 0))
-		{
-			if( it->expires != 0 && it->expires < get_ticks())
-			{
-				/* found an expired entry  -> delete it */
-				if(it_aux)
-					it_aux->next = it->next;
-				else
-					cache_htable[hash_code].entries = it->next;
-
-				shm_free(it);
-
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local fetch",attr->s,attr->len,0);
-				return -2;
-			}
-			value = (char*)pkg_malloc(it->value.len);
-			if(value == NULL)
-			{
-				LM_ERR("no more memory\n");
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local fetch",attr->s,attr->len,0);
-				return -1;
-			}
-			memcpy(value, it->value.s, it->value.len);
-			res->len = it->value.len;
-			res->s = value;
-			lock_release(&cache_htable[hash_code].lock);
-			stop_expire_timer(start,local_exec_threshold,
-			"cachedb_local fetch",attr->s,attr->len,0);
-			return 1;
-		}
+		LM_ERR("no more memory\n");
+		lock_release(&bucket->lock);
+		stop_expire_timer(start,local_exec_threshold,
+		"cachedb_local fetch",attr->s,attr->len,0);
+		return -1;
+	}
+	memcpy(value, it->value.s, it->value.len);
+	res->len = it->value.len;
+	res->s = value;
 
-		it_aux = it;
-		it = it->next;
+	if (it != bucket->entries) {
+		entry_unlink(bucket, it);
+		entry_push(bucket, it);
 	}
 
-	lock_release(&cache_htable[hash_code].lock);
+	lock_release(&bucket->lock);
+
+	update_stat(lcache_hits, 1);
 	stop_expire_timer(start,local_exec_threshold,
 	"cachedb_local fetch",attr->s,attr->len,0);
-	return -2;
+	return 1;
 }
 
 int lcache_htable_fetch_counter(cachedb_con* con,str* attr,int *val)
 {
-	int hash_code;
-	lcache_entry_t* it = NULL, *it_aux = NULL;
+	lcache_entry_t* it;
+	unsigned int hash;
 	int ret;
 	struct timeval start;
 
-	lcache_t* cache_htable;
+	lcache_t* bucket;
 	lcache_col_t* cache_col;
 
-	cache_col = ((lcache_con*)con->data)->col;
-	if ( !cache_col ) {
-		LM_ERR("url <%.*s> does not have any collection associated with!",
-				con->url.len, con->url.s);
+	cache_col = get_con_col(con);
+	if ( !cache_col )
 		return -1;
-	}
-
-	cache_htable = cache_col->col_htable;
 
 	start_expire_timer(start,local_exec_threshold);
 
-	hash_code= core_hash( attr, 0, cache_col->size);
-	lock_get(&cache_htable[hash_code].lock);
+	hash = core_hash(attr, 0, 0);
+	bucket = &cache_col->col_htable[hash & (cache_col->size - 1)];
+	lock_get(&bucket->lock);
 
-	it = cache_htable[hash_code].entries;
+	it = entry_lookup(cache_col, bucket, attr, hash);
+	if (it == NULL) {
+		lock_release(&bucket->lock);
+		update_stat(lcache_misses, 1);
+		stop_expire_timer(start,local_exec_threshold,
+		"cachedb_local fetch_counter",attr->s,attr->len,0);
+		return -2;
+	}
 
-	while(it)
-	{
-		if(it->attr.len == attr->len &&
-				(strncmp(it->attr.s, attr->s, attr->len) == 0))
-		{
-			if( it->expires != 0 && it->expires < get_ticks())
-			{
-				/* found an expired entry  -> delete it */
-				if(it_aux)
-					it_aux->next = it->next;
-				else
-					cache_htable[hash_code].entries = it->next;
-
-				shm_free(it);
-
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local fetch_counter",attr->s,attr->len,0);
-				return -2;
-			}
-			if (str2sint(&it->value,&ret) != 0) {
-				LM_ERR("Not a counter key\n");
-				lock_release(&cache_htable[hash_code].lock);
-				stop_expire_timer(start,local_exec_threshold,
-				"cachedb_local fetch_counter",attr->s,attr->len,0);
-				return -3;
-			}
-			if (val)
-				*val = ret;
-			lock_release(&cache_htable[hash_code].lock);
-			stop_expire_timer(start,local_exec_threshold,
-			"cachedb_local fetch_counter",attr->s,attr->len,0);
-			return 1;
-		}
+	if (str2sint(&it->value,&ret) != 0) {
+		LM_ERR("Not a counter key\n");
+		lock_release(&bucket->lock);
+		stop_expire_timer(start,local_exec_threshold,
+		"cachedb_local fetch_counter",attr->s,attr->len,0);
+		return -3;
+	}
+	if (val)
+		*val = ret;
 
-		it_aux = it;
-		it = it->next;
+	if (it != bucket->entries) {
+		entry_unlink(bucket, it);
+		entry_push(bucket, it);
 	}
 
-	lock_release(&cache_htable[hash_code].lock);
+	lock_release(&bucket->lock);
+
+	update_stat(lcache_hits, 1);
 	stop_expire_timer(start,local_exec_threshold,
 	"cachedb_local fetch_counter",attr->s,attr->len,0);
-	return -2;
+	return 1;
+}
+
+void lcache_htable_clean(lcache_col_t *col, int buckets)
+{
+	lcache_entry_t *me1, *me2;
+	lcache_t *bucket;
+	unsigned int now, next_expire;
+
+	now = get_ticks();
+
+	for ( ; buckets > 0; buckets--,
+	col->clean_idx = (col->clean_idx + 1) & (col->size - 1)) {
+		bucket = &col->col_htable[col->clean_idx];
+
+		/* nothing expired in this bucket yet, no need to lock it */
+		if (bucket->next_expire == 0 || bucket->next_expire >= now)
+			continue;
+
+		lock_get(&bucket->lock);
+
+		next_expire = 0;
+		for (me1 = bucket->entries; me1; me1 = me2) {
+			me2 = me1->next;
+
+			if (me1->expires == 0)
+				continue;
+
+			if (me1->expires < now) {
+				LM_DBG("deleted entry attr= [%.*s]\n",
+						me1->attr.len, me1->attr.s);
+				lcache_htable_drop(col, bucket, me1);
+			} else if (next_expire == 0 || me1->expires < next_expire) {
+				next_expire = me1->expires;
+			}
+		}
+		bucket->next_expire = next_expire;
+
+		lock_release(&bucket->lock);
+	}
 }
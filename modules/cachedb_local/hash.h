@@ -32,24 +32,60 @@
 #include "../../lock_ops.h"
 #include "../../cachedb/cachedb.h"
 
+struct lcache_col;
+
+/* the share of a node in a replicated counter */
+typedef struct lcache_cnt
+{
+	int node;
+	int sum;				/* all the increments done by the node */
+	unsigned long long ts;	/* time of its last increment */
+}lcache_cnt_t;
+
+/* the counter shares, attr and value are kept in the same chunk,
+ * right after the entry */
 typedef struct lcache_entry
 {
 	str attr;
 	str value;
+	unsigned int hash;		/* core_hash() of attr, not masked */
 	unsigned int expires;
+	/* time of the last set/remove (usec), only kept for replicated
+	 * collections */
+	unsigned long long ts;
+	/* replicated counters: the value set at "ts", plus the share of each
+	 * node which changed it since */
+	int cnt_base;
+	unsigned short cnt_no;
+	/* removed - only kept for a while, to reject the older writes */
+	unsigned short tomb;
+	lcache_cnt_t *cnt;
+	/* the chain of the bucket, most recently used first */
+	struct lcache_entry* prev;
 	struct lcache_entry* next;
 }lcache_entry_t;
 
+/* for how long (s) a key removed from a replicated collection rejects the
+ * older writes still on their way from the other nodes */
+#define LCACHE_TOMB_TTL 30
+
+#define lcache_entry_size(_e) \
+	(sizeof(lcache_entry_t) + (_e)->cnt_no * sizeof(lcache_cnt_t) + \
+		(_e)->attr.len + (_e)->value.len)
+
 
 typedef struct lcache
 {
 	lcache_entry_t* entries;
+	lcache_entry_t* last;
+	/* none of the entries expires before this, 0 if none expires at all */
+	unsigned int next_expire;
 	gen_lock_t lock;
 }lcache_t;
 
 
 int lcache_htable_init(lcache_t** cache_htable_p, int size);
-void lcache_htable_destroy();
+void lcache_htable_destroy(lcache_t** cache_htable_p, int size);
 int lcache_htable_insert(cachedb_con *con,str* attr, str* value,int expires);
 int lcache_htable_remove(cachedb_con *con,str* attr);
 int lcache_htable_fetch(cachedb_con *con,str* attr, str* val);
@@ -57,4 +93,22 @@ int lcache_htable_add(cachedb_con *con,str *attr,int val,int expires,int *new_va
 int lcache_htable_sub(cachedb_con *con,str *attr,int val,int expires,int *new_val);
 int lcache_htable_fetch_counter(cachedb_con* con,str* attr,int *val);
 
+/* same as above, but working directly on a collection; for the writes
+ * received from the cluster (@isrepl set), @ts decides which write wins */
+int _lcache_htable_insert(struct lcache_col *col, str *attr, str *value,
+		int expires, unsigned long long ts, int isrepl);
+int _lcache_htable_remove(struct lcache_col *col, str *attr,
+		unsigned long long ts, int isrepl);
+int _lcache_htable_add(struct lcache_col *col, str *attr, int val, int expires,
+		int *new_val, unsigned long long ts, int node, int isrepl);
+int lcache_htable_sync(struct lcache_col *col, str *attr, str *value,
+		int expires, unsigned long long ts, int cnt_base, lcache_cnt_t *cnt,
+		int cnt_no);
+
+/* unlinks and frees an entry; must be called with the bucket lock held */
+void lcache_htable_drop(struct lcache_col *col, lcache_t *bucket,
+		lcache_entry_t *me);
+/* removes the expired entries from the next @buckets buckets */
+void lcache_htable_clean(struct lcache_col *col, int buckets);
+
 #endif
@@ -0,0 +1,352 @@
+/*
+ * Replication of the cachedb_local collections
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+#include "../../dprint.h"
+#include "../../timer.h"
+#include "../../mem/mem.h"
+
+#include "lcache_replication.h"
+#include "hash.h"
+
+str lcache_repl_cap = str_init("cachedb-local-repl");
+
+struct clusterer_binds clusterer_api;
+
+/* the write timestamps don't fit in a BIN integer */
+#define bin_push_ts(_p, _ts) \
+	(bin_push_int(_p, (unsigned int)((_ts) >> 32)) < 0 || \
+	bin_push_int(_p, (unsigned int)(_ts)) < 0 ? -1 : 0)
+#define bin_field_ts(_hi, _lo) \
+	(((unsigned long long)(unsigned int)(_hi).i << 32) | (unsigned int)(_lo).i)
+
+/* packet sending */
+
+static void lcache_replicate(bin_packet_t *packet)
+{
+	int rc;
+
+	rc = clusterer_api.send_all(packet, lcache_repl_cluster);
+	switch (rc) {
+	case CLUSTERER_CURR_DISABLED:
+		LM_INFO("Current node is disabled in cluster: %d\n", lcache_repl_cluster);
+		goto error;
+	case CLUSTERER_DEST_DOWN:
+		LM_INFO("All destinations in cluster: %d are down or probing\n",
+			lcache_repl_cluster);
+		goto error;
+	case CLUSTERER_SEND_ERR:
+		LM_ERR("Error sending in cluster: %d\n", lcache_repl_cluster);
+		goto error;
+	}
+
+	return;
+
+error:
+	LM_ERR("Failed to replicate cachedb_local write\n");
+}
+
+void replicate_lcache_insert(lcache_col_t *col, str *attr, str *value,
+		int expires, unsigned long long ts)
+{
+	bin_packet_t packet;
+
+	if (bin_init(&packet, &lcache_repl_cap, REPL_CACHE_INSERT, BIN_VERSION, 0) != 0) {
+		LM_ERR("failed to replicate this event\n");
+		return;
+	}
+
+	if (bin_push_str(&packet, &col->col_name) < 0 ||
+	bin_push_str(&packet, attr) < 0 ||
+	bin_push_str(&packet, value) < 0 ||
+	bin_push_int(&packet, expires) < 0 ||
+	bin_push_ts(&packet, ts) < 0) {
+		LM_ERR("failed to build replication packet\n");
+		goto end;
+	}
+
+	lcache_replicate(&packet);
+
+end:
+	bin_free_packet(&packet);
+}
+
+void replicate_lcache_remove(lcache_col_t *col, str *attr,
+		unsigned long long ts)
+{
+	bin_packet_t packet;
+
+	if (bin_init(&packet, &lcache_repl_cap, REPL_CACHE_REMOVE, BIN_VERSION, 0) != 0) {
+		LM_ERR("failed to replicate this event\n");
+		return;
+	}
+
+	if (bin_push_str(&packet, &col->col_name) < 0 ||
+	bin_push_str(&packet, attr) < 0 ||
+	bin_push_ts(&packet, ts) < 0) {
+		LM_ERR("failed to build replication packet\n");
+		goto end;
+	}
+
+	lcache_replicate(&packet);
+
+end:
+	bin_free_packet(&packet);
+}
+
+void replicate_lcache_add(lcache_col_t *col, str *attr, int val, int expires,
+		unsigned long long ts)
+{
+	bin_packet_t packet;
+
+	if (bin_init(&packet, &lcache_repl_cap, REPL_CACHE_ADD, BIN_VERSION, 0) != 0) {
+		LM_ERR("failed to replicate this event\n");
+		return;
+	}
+
+	if (bin_push_str(&packet, &col->col_name) < 0 ||
+	bin_push_str(&packet, attr) < 0 ||
+	bin_push_int(&packet, val) < 0 ||
+	bin_push_int(&packet, expires) < 0 ||
+	bin_push_ts(&packet, ts) < 0) {
+		LM_ERR("failed to build replication packet\n");
+		goto end;
+	}
+
+	lcache_replicate(&packet);
+
+end:
+	bin_free_packet(&packet);
+}
+
+/* packet receiving */
+
+static lcache_col_t *get_repl_col(str *name, int src_id)
+{
+	lcache_col_t *col;
+
+	for (col = lcache_collection; col; col = col->next)
+		if (!str_strcmp(&col->col_name, name))
+			break;
+
+	if (!col || !col->replicated) {
+		LM_DBG("collection <%.*s> from node %d is not replicated here\n",
+			name->len, name->s, src_id);
+		return NULL;
+	}
+
+	return col;
+}
+
+static int lcache_recv_insert(bin_packet_t *packet)
+{
+	bin_field_t f[6];
+	lcache_col_t *col;
+
+	if (bin_pop_fields(packet, "sssiii", f) != 6) {
+		LM_ERR("bad insert packet from node %d\n", packet->src_id);
+		return -1;
+	}
+
+	col = get_repl_col(&f[0].s, packet->src_id);
+	if (!col)
+		return 0;
+
+	return _lcache_htable_insert(col, &f[1].s, &f[2].s, f[3].i,
+		bin_field_ts(f[4], f[5]), 1) < 0 ? -1 : 0;
+}
+
+static int lcache_recv_remove(bin_packet_t *packet)
+{
+	bin_field_t f[4];
+	lcache_col_t *col;
+
+	if (bin_pop_fields(packet, "ssii", f) != 4) {
+		LM_ERR("bad remove packet from node %d\n", packet->src_id);
+		return -1;
+	}
+
+	col = get_repl_col(&f[0].s, packet->src_id);
+	if (!col)
+		return 0;
+
+	return _lcache_htable_remove(col, &f[1].s, bin_field_ts(f[2], f[3]), 1);
+}
+
+static int lcache_recv_add(bin_packet_t *packet)
+{
+	bin_field_t f[6];
+	lcache_col_t *col;
+
+	if (bin_pop_fields(packet, "ssiiii", f) != 6) {
+		LM_ERR("bad add packet from node %d\n", packet->src_id);
+		return -1;
+	}
+
+	col = get_repl_col(&f[0].s, packet->src_id);
+	if (!col)
+		return 0;
+
+	return _lcache_htable_add(col, &f[1].s, f[2].i, f[3].i, NULL,
+		bin_field_ts(f[4], f[5]), packet->src_id, 1);
+}
+
+/* a whole entry, with the node shares of a counter */
+static int lcache_recv_sync(bin_packet_t *packet)
+{
+	bin_field_t f[8], c[4];
+	lcache_cnt_t *cnt = NULL;
+	lcache_col_t *col;
+	int i, rc;
+
+	if (bin_pop_fields(packet, "sssiiiii", f) != 8 || f[7].i < 0) {
+		LM_ERR("bad sync packet from node %d\n", packet->src_id);
+		return -1;
+	}
+
+	if (f[7].i) {
+		cnt = pkg_malloc(f[7].i * sizeof *cnt);
+		if (!cnt) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+	}
+
+	/* pop all the shares, so the next entry of the chunk is in place */
+	for (i = 0; i < f[7].i; i++) {
+		if (bin_pop_fields(packet, "iiii", c) != 4) {
+			LM_ERR("bad sync packet from node %d\n", packet->src_id);
+			pkg_free(cnt);
+			return -1;
+		}
+		cnt[i].node = c[0].i;
+		cnt[i].sum = c[1].i;
+		cnt[i].ts = bin_field_ts(c[2], c[3]);
+	}
+
+	col = get_repl_col(&f[0].s, packet->src_id);
+	rc = col ? lcache_htable_sync(col, &f[1].s, &f[2].s, f[3].i,
+		bin_field_ts(f[4], f[5]), f[6].i, cnt, f[7].i) : 0;
+
+	if (cnt)
+		pkg_free(cnt);
+	return rc;
+}
+
+void receive_lcache_repl(bin_packet_t *packet)
+{
+	int rc = 0;
+	bin_packet_t *pkt;
+
+	for (pkt = packet; pkt; pkt = pkt->next) {
+		switch (pkt->type) {
+		case REPL_CACHE_INSERT:
+			rc = lcache_recv_insert(pkt);
+			break;
+		case REPL_CACHE_REMOVE:
+			rc = lcache_recv_remove(pkt);
+			break;
+		case REPL_CACHE_ADD:
+			rc = lcache_recv_add(pkt);
+			break;
+		case SYNC_PACKET_TYPE:
+			while (clusterer_api.sync_chunk_iter(pkt))
+				if (lcache_recv_sync(pkt) < 0) {
+					LM_ERR("Failed to process sync packet\n");
+					return;
+				}
+			break;
+		default:
+			rc = -1;
+			LM_WARN("Invalid cachedb_local binary packet command: %d "
+				"(from node: %d in cluster: %d)\n", pkt->type, pkt->src_id,
+				lcache_repl_cluster);
+		}
+
+		if (rc != 0)
+			LM_ERR("Failed to process a binary packet!\n");
+	}
+}
+
+static int receive_sync_request(int node_id)
+{
+	lcache_col_t *col;
+	lcache_entry_t *me;
+	lcache_t *bucket;
+	bin_packet_t *sync_packet;
+	unsigned int now;
+	int i, j, expires;
+
+	for (col = lcache_collection; col; col = col->next) {
+		if (!col->replicated)
+			continue;
+
+		for (i = 0; i < col->size; i++) {
+			bucket = &col->col_htable[i];
+			now = get_ticks();
+
+			lock_get(&bucket->lock);
+			for (me = bucket->entries; me; me = me->next) {
+				if (me->tomb || (me->expires != 0 && me->expires < now))
+					continue;
+
+				/* the attr hash is the same on all nodes, whatever the
+				 * size of their collections */
+				if (!clusterer_api.sync_in_shard(me->hash))
+					continue;
+
+				sync_packet = clusterer_api.sync_chunk_start(&lcache_repl_cap,
+					lcache_repl_cluster, node_id);
+				if (!sync_packet)
+					goto error;
+
+				expires = me->expires == 0 ? 0 :
+					(me->expires > now ? me->expires - now : 1);
+
+				bin_push_str(sync_packet, &col->col_name);
+				bin_push_str(sync_packet, &me->attr);
+				bin_push_str(sync_packet, &me->value);
+				bin_push_int(sync_packet, expires);
+				bin_push_ts(sync_packet, me->ts);
+				bin_push_int(sync_packet, me->cnt_base);
+				bin_push_int(sync_packet, me->cnt_no);
+				for (j = 0; j < me->cnt_no; j++) {
+					bin_push_int(sync_packet, me->cnt[j].node);
+					bin_push_int(sync_packet, me->cnt[j].sum);
+					bin_push_ts(sync_packet, me->cnt[j].ts);
+				}
+			}
+			lock_release(&bucket->lock);
+		}
+	}
+
+	return 0;
+
+error:
+	lock_release(&bucket->lock);
+	return -1;
+}
+
+void receive_lcache_cluster_event(enum clusterer_event ev, int node_id)
+{
+	if (ev == SYNC_REQ_RCV && receive_sync_request(node_id) < 0)
+		LM_ERR("Failed to reply to sync request from node: %d\n", node_id);
+}
@@ -0,0 +1,52 @@
+/*
+ * Replication of the cachedb_local collections
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+#ifndef _LCACHE_REPLICATION_H_
+#define _LCACHE_REPLICATION_H_
+
+#include "../../bin_interface.h"
+#include "../clusterer/api.h"
+#include "cachedb_local.h"
+
+#define REPL_CACHE_INSERT 1
+#define REPL_CACHE_REMOVE 2
+#define REPL_CACHE_ADD    3
+
+#define BIN_VERSION 2
+
+extern int lcache_repl_cluster;
+extern struct clusterer_binds clusterer_api;
+
+extern str lcache_repl_cap;
+
+/* duplicate local writes to the other nodes of the cluster */
+void replicate_lcache_insert(lcache_col_t *col, str *attr, str *value,
+		int expires, unsigned long long ts);
+void replicate_lcache_remove(lcache_col_t *col, str *attr,
+		unsigned long long ts);
+void replicate_lcache_add(lcache_col_t *col, str *attr, int val, int expires,
+		unsigned long long ts);
+
+void receive_lcache_repl(bin_packet_t *packet);
+void receive_lcache_cluster_event(enum clusterer_event ev, int node_id);
+
+#endif
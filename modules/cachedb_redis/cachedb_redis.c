@@ -39,12 +39,14 @@
 #include "../../cachedb/cachedb.h"
 
 #include "cachedb_redis_dbase.h"
+#include "cachedb_redis_nearcache.h"
+#include "cachedb_redis_async.h"
 
 static int mod_init(void);
 static int child_init(int);
 static void destroy(void);
 
-static str cache_mod_name = str_init("redis");
+str cache_mod_name = str_init("redis");
 struct cachedb_url *redis_script_urls = NULL;
 
 int set_connection(unsigned int type, void *val)
@@ -57,9 +59,29 @@ static param_export_t params[]={
 	{ "query_timeout",               INT_PARAM,                &redis_query_tout      },
 	{ "shutdown_on_error",           INT_PARAM,                &shutdown_on_error     },
 	{ "cachedb_url",                 STR_PARAM|USE_FUNC_PARAM, (void *)&set_connection},
+	{ "async_connections",           INT_PARAM,                &redis_async_conns     },
+	{ "near_cache_ttl",              INT_PARAM,                &near_cache_ttl        },
+	{ "near_cache_size",             INT_PARAM,                &near_cache_size       },
+	{ "near_cache_prefix",           STR_PARAM,                &near_cache_prefix.s   },
 	{0,0,0}
 };
 
+static acmd_export_t acmds[] = {
+	{ "redis_fetch", (acmd_function)w_redis_async_fetch, 3, fixup_redis_fetch },
+	{ "redis_store", (acmd_function)w_redis_async_store, 3, fixup_redis_store },
+	{ "redis_store", (acmd_function)w_redis_async_store, 4, fixup_redis_store },
+	{ "redis_add",   (acmd_function)w_redis_async_add,   3, fixup_redis_add   },
+	{ "redis_add",   (acmd_function)w_redis_async_add,   4, fixup_redis_add   },
+	{ "redis_add",   (acmd_function)w_redis_async_add,   5, fixup_redis_add   },
+	{ 0, 0, 0, 0 }
+};
+
+static stat_export_t mod_stats[] = {
+	{ "near_cache_hits",   0, &near_cache_hits   },
+	{ "near_cache_misses", 0, &near_cache_misses },
+	{ 0, 0, 0 }
+};
+
 
 /** module exports */
 struct module_exports exports= {
@@ -69,9 +91,9 @@ struct module_exports exports= {
 	DEFAULT_DLFLAGS,			/* dlopen flags */
 	NULL,            /* OpenSIPS module dependencies */
 	0,						/* exported functions */
-	0,						/* exported async functions */
+	acmds,						/* exported async functions */
 	params,						/* exported parameters */
-	0,							/* exported statistics */
+	mod_stats,					/* exported statistics */
 	0,							/* exported MI functions */
 	0,							/* exported pseudo-variables */
 	0,							/* exported transformations */
@@ -93,6 +115,9 @@ static int mod_init(void)
 	LM_NOTICE("initializing module cachedb_redis ...\n");
 	memset(&cde,0,sizeof(cachedb_engine));
 
+	if (near_cache_prefix.s)
+		near_cache_prefix.len = strlen(near_cache_prefix.s);
+
 	cde.name = cache_mod_name;
 
 	cde.cdb_func.init = redis_init;
@@ -0,0 +1,419 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <string.h>
+#include <hiredis/hiredis.h>
+
+#include "../../dprint.h"
+#include "../../error.h"
+#include "../../mem/mem.h"
+#include "../../mod_fix.h"
+#include "../../pvar.h"
+#include "../../ut.h"
+#include "cachedb_redis_dbase.h"
+#include "cachedb_redis_nearcache.h"
+#include "cachedb_redis_async.h"
+
+enum redis_async_op {
+	REDIS_ASYNC_FETCH,
+	REDIS_ASYNC_STORE,
+	REDIS_ASYNC_ADD,
+};
+
+struct redis_async_param {
+	enum redis_async_op op;
+	redis_con *con;
+	redis_async_con *ac;
+	/* replies still to be read - only the first one carries the result */
+	int replies;
+	int pending;
+	pv_spec_t *out;
+	str key;
+};
+
+
+static int fixup_redis_out(void **param)
+{
+	if (fixup_pvar(param) < 0)
+		return E_CFG;
+
+	if (((pv_spec_p)*param)->setf == NULL) {
+		LM_ERR("output parameter must be a writable variable\n");
+		return E_CFG;
+	}
+
+	return 0;
+}
+
+int fixup_redis_fetch(void **param, int param_no)
+{
+	if (param_no < 3)
+		return fixup_spve(param);
+
+	return fixup_redis_out(param);
+}
+
+int fixup_redis_store(void **param, int param_no)
+{
+	if (param_no < 4)
+		return fixup_spve(param);
+
+	return fixup_igp(param);
+}
+
+int fixup_redis_add(void **param, int param_no)
+{
+	if (param_no < 3)
+		return fixup_spve(param);
+	if (param_no < 5)
+		return fixup_igp(param);
+
+	return fixup_redis_out(param);
+}
+
+/* @id is the same "redis[:group]" used by the cache_*() script functions */
+static cachedb_con *redis_script_con(struct sip_msg *msg, char *id, char *key,
+		str *skey)
+{
+	cachedb_con *con;
+	str sid, engine, grp = {NULL, 0};
+	char *p;
+
+	if (fixup_get_svalue(msg, (gparam_p)id, &sid) != 0 ||
+	        fixup_get_svalue(msg, (gparam_p)key, skey) != 0) {
+		LM_ERR("failed to get the cachedb id or the key\n");
+		return NULL;
+	}
+
+	engine = sid;
+	p = memchr(sid.s, ':', sid.len);
+	if (p) {
+		engine.len = p - sid.s;
+		grp.s = p + 1;
+		grp.len = sid.s + sid.len - grp.s;
+	}
+
+	if (str_strcmp(&engine, &cache_mod_name)) {
+		LM_ERR("[%.*s] is not a redis connection\n", sid.len, sid.s);
+		return NULL;
+	}
+
+	con = cachedb_get_connection(lookup_cachedb(&cache_mod_name), &grp);
+	if (!con) {
+		LM_ERR("no redis connection for group [%.*s] : check cachedb_url\n",
+			grp.len, grp.s);
+		return NULL;
+	}
+
+	return con;
+}
+
+/* @return: NULL if the query cannot be run async (no connection to spare) */
+static struct redis_async_param *redis_async_new(cachedb_con *connection,
+		str *key, enum redis_async_op op, pv_spec_t *out)
+{
+	struct redis_async_param *p;
+	redis_con *con = (redis_con *)connection->data;
+	cluster_node *node;
+	redis_async_con *ac;
+
+	node = redis_get_node(con, key);
+	if (!node)
+		return NULL;
+
+	ac = redis_get_async_con(con, node);
+	if (!ac)
+		return NULL;
+
+	p = pkg_malloc(sizeof *p + key->len);
+	if (!p) {
+		LM_ERR("no more pkg memory\n");
+		ac->busy = 0;
+		return NULL;
+	}
+	memset(p, 0, sizeof *p);
+
+	p->op = op;
+	p->con = con;
+	p->ac = ac;
+	p->out = out;
+	p->key.s = (char *)(p + 1);
+	p->key.len = key->len;
+	memcpy(p->key.s, key->s, key->len);
+
+	return p;
+}
+
+static void redis_async_free(struct redis_async_param *p)
+{
+	p->ac->busy = 0;
+	pkg_free(p);
+}
+
+/* hiredis sets an error on the context when appending fails, so the
+ * connection is dropped the next time it is picked */
+static int redis_async_append_failed(struct redis_async_param *p)
+{
+	LM_ERR("failed to queue the query to Redis - %s\n",
+		p->ac->context->errstr);
+	redis_async_free(p);
+	return -1;
+}
+
+static int redis_async_result(struct sip_msg *msg,
+		struct redis_async_param *p, redisReply *reply)
+{
+	pv_value_t val;
+	str s;
+
+	if (reply->type == REDIS_REPLY_ERROR) {
+		/* the redirections are not followed, as on the sync path */
+		if ((reply->len > 6 && !memcmp(reply->str, "MOVED ", 6)) ||
+		        (reply->len > 4 && !memcmp(reply->str, "ASK ", 4)))
+			LM_ERR("key %.*s not served by the queried node - %.*s\n",
+				p->key.len, p->key.s, reply->len, reply->str);
+		else
+			LM_ERR("Redis operation failure - %.*s\n", reply->len, reply->str);
+		return -1;
+	}
+
+	switch (p->op) {
+	case REDIS_ASYNC_FETCH:
+		if (reply->type != REDIS_REPLY_STRING || reply->len == 0) {
+			LM_DBG("no such key - %.*s\n", p->key.len, p->key.s);
+			return -2;
+		}
+
+		s.s = reply->str;
+		s.len = reply->len;
+		redis_nc_store(p->con, &p->key, &s, 0);
+
+		val.flags = PV_VAL_STR;
+		val.rs = s;
+		break;
+	case REDIS_ASYNC_ADD:
+		if (!p->out)
+			return 1;
+
+		val.flags = PV_VAL_INT|PV_TYPE_INT;
+		val.ri = (int)reply->integer;
+		break;
+	default:
+		return 1;
+	}
+
+	if (pv_set_value(msg, p->out, 0, &val) != 0) {
+		LM_ERR("failed to set the output variable\n");
+		return -1;
+	}
+
+	return 1;
+}
+
+static enum async_ret_code resume_redis_async(int fd, struct sip_msg *msg,
+		void *param)
+{
+	struct redis_async_param *p = (struct redis_async_param *)param;
+	redisContext *ctx = p->ac->context;
+	redisReply *reply;
+	int ret = 1;
+
+	/* called by the reactor once the socket is readable, while in sync
+	 * mode this blocks until the reply arrives (or query_timeout hits) */
+	if (redisBufferRead(ctx) != REDIS_OK) {
+		LM_ERR("failed to read from Redis - %s\n", ctx->errstr);
+		ret = -1;
+		goto done;
+	}
+
+	while (p->pending) {
+		if (redisGetReplyFromReader(ctx, (void **)&reply) != REDIS_OK) {
+			LM_ERR("bad reply from Redis - %s\n", ctx->errstr);
+			ret = -1;
+			goto done;
+		}
+
+		if (!reply) {
+			async_status = ASYNC_CONTINUE;
+			return 1;
+		}
+
+		if (p->pending-- == p->replies)
+			ret = redis_async_result(msg, p, reply);
+		else if (reply->type == REDIS_REPLY_ERROR)
+			LM_ERR("Redis operation failure - %.*s\n", reply->len, reply->str);
+
+		freeReplyObject(reply);
+	}
+
+done:
+	redis_async_free(p);
+	async_status = ASYNC_DONE;
+	return ret;
+}
+
+/* writes the @replies commands appended to the connection and hands
+ * the socket over to the reactor */
+static int redis_async_send(async_ctx *ctx, struct redis_async_param *p,
+		int replies)
+{
+	redisContext *c = p->ac->context;
+	int done = 0;
+
+	do {
+		if (redisBufferWrite(c, &done) != REDIS_OK) {
+			LM_ERR("failed to send query to Redis - %s\n", c->errstr);
+			redis_async_free(p);
+			return -1;
+		}
+	} while (!done);
+
+	p->replies = p->pending = replies;
+
+	ctx->resume_f = resume_redis_async;
+	ctx->resume_param = p;
+	async_status = c->fd;
+
+	return 1;
+}
+
+int w_redis_async_fetch(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *out)
+{
+	struct redis_async_param *p;
+	cachedb_con *con;
+	pv_value_t val;
+	str skey;
+	int ret;
+
+	con = redis_script_con(msg, id, key, &skey);
+	if (!con)
+		return -1;
+
+	p = redis_async_new(con, &skey, REDIS_ASYNC_FETCH, (pv_spec_t *)out);
+	if (p && redis_nc_fetch(p->con, &skey, &val.rs) != 1) {
+		if (redisAppendCommand(p->ac->context, "GET %b",
+		        skey.s, skey.len) != REDIS_OK)
+			return redis_async_append_failed(p);
+		return redis_async_send(ctx, p, 1);
+	}
+
+	/* a near cache hit or no connection to spare - no need to suspend */
+	if (p)
+		redis_async_free(p);
+	else if ((ret = redis_get(con, &skey, &val.rs)) != 0)
+		goto sync;
+
+	val.flags = PV_VAL_STR;
+	ret = 1;
+	if (pv_set_value(msg, (pv_spec_t *)out, 0, &val) != 0) {
+		LM_ERR("failed to set the output variable\n");
+		ret = -1;
+	}
+	pkg_free(val.rs.s);
+
+sync:
+	async_status = ASYNC_SYNC;
+	return ret;
+}
+
+int w_redis_async_store(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *value, char *expires)
+{
+	struct redis_async_param *p;
+	cachedb_con *con;
+	str skey, sval;
+	int exp = 0, ret;
+
+	con = redis_script_con(msg, id, key, &skey);
+	if (!con)
+		return -1;
+
+	if (fixup_get_svalue(msg, (gparam_p)value, &sval) != 0 ||
+	        (expires && fixup_get_ivalue(msg, (gparam_p)expires, &exp) != 0)) {
+		LM_ERR("failed to get the value or the expire time\n");
+		return -1;
+	}
+
+	p = redis_async_new(con, &skey, REDIS_ASYNC_STORE, NULL);
+	if (!p) {
+		async_status = ASYNC_SYNC;
+		return redis_set(con, &skey, &sval, exp) == 0 ? 1 : -1;
+	}
+
+	redis_nc_remove(p->con, &skey);
+
+	if (exp)
+		ret = redisAppendCommand(p->ac->context, "SET %b %b EX %d",
+			skey.s, skey.len, sval.s, sval.len, exp);
+	else
+		ret = redisAppendCommand(p->ac->context, "SET %b %b",
+			skey.s, skey.len, sval.s, sval.len);
+	if (ret != REDIS_OK)
+		return redis_async_append_failed(p);
+
+	return redis_async_send(ctx, p, 1);
+}
+
+int w_redis_async_add(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *value, char *expires, char *out)
+{
+	struct redis_async_param *p;
+	cachedb_con *con;
+	pv_value_t val;
+	str skey;
+	int delta, exp = 0, ret;
+
+	con = redis_script_con(msg, id, key, &skey);
+	if (!con)
+		return -1;
+
+	if (fixup_get_ivalue(msg, (gparam_p)value, &delta) != 0 ||
+	        (expires && fixup_get_ivalue(msg, (gparam_p)expires, &exp) != 0)) {
+		LM_ERR("failed to get the value or the expire time\n");
+		return -1;
+	}
+
+	p = redis_async_new(con, &skey, REDIS_ASYNC_ADD, (pv_spec_t *)out);
+	if (!p) {
+		async_status = ASYNC_SYNC;
+		if (redis_add(con, &skey, delta, exp, &val.ri) != 0)
+			return -1;
+
+		ret = 1;
+		val.flags = PV_VAL_INT|PV_TYPE_INT;
+		if (out && pv_set_value(msg, (pv_spec_t *)out, 0, &val) != 0) {
+			LM_ERR("failed to set the output variable\n");
+			ret = -1;
+		}
+		return ret;
+	}
+
+	redis_nc_remove(p->con, &skey);
+
+	/* pipelined, both replies come back in a single round-trip */
+	if (redisAppendCommand(p->ac->context, "INCRBY %b %d",
+	        skey.s, skey.len, delta) != REDIS_OK ||
+	        (exp && redisAppendCommand(p->ac->context, "EXPIRE %b %d",
+	        skey.s, skey.len, exp) != REDIS_OK))
+		return redis_async_append_failed(p);
+
+	return redis_async_send(ctx, p, exp ? 2 : 1);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Async flavors of the fetch/store/add operations, to be used with the
+ * async() script statement. Each node gets a few extra connections, each of
+ * them serving a single async query at a time: the query is written right
+ * away and the reply is read once the reactor reports the socket readable,
+ * so the worker moves on to other messages in the meantime.
+ */
+
+#ifndef CACHEDB_REDIS_ASYNC_H
+#define CACHEDB_REDIS_ASYNC_H
+
+#include "../../async.h"
+#include "../../str.h"
+
+extern str cache_mod_name;
+
+int fixup_redis_fetch(void **param, int param_no);
+int fixup_redis_store(void **param, int param_no);
+int fixup_redis_add(void **param, int param_no);
+
+int w_redis_async_fetch(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *out);
+int w_redis_async_store(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *value, char *expires);
+int w_redis_async_add(struct sip_msg *msg, async_ctx *ctx,
+		char *id, char *key, char *value, char *expires, char *out);
+
+#endif /* CACHEDB_REDIS_ASYNC_H */
@@ -26,6 +26,7 @@
 #include "../../dprint.h"
 #include "cachedb_redis_dbase.h"
 #include "cachedb_redis_utils.h"
+#include "cachedb_redis_nearcache.h"
 #include "../../mem/mem.h"
 #include "../../ut.h"
 #include "../../cachedb/cachedb.h"
@@ -36,6 +37,7 @@
 int redis_query_tout = CACHEDB_REDIS_DEFAULT_TIMEOUT;
 int redis_connnection_tout = CACHEDB_REDIS_DEFAULT_TIMEOUT;
 int shutdown_on_error = 0;
+int redis_async_conns = 4;
 
 redisContext *redis_get_ctx(char *ip, int port)
 {
@@ -69,41 +71,52 @@ redisContext *redis_get_ctx(char *ip, int port)
 	return ctx;
 }
 
-int redis_connect_node(redis_con *con,cluster_node *node)
+/* opens a new connection to the node, ready to be queried */
+static redisContext *redis_open_node_ctx(redis_con *con,cluster_node *node)
 {
+	redisContext *ctx;
 	redisReply *rpl;
 
-	node->context = redis_get_ctx(node->ip,node->port);
-	if (!node->context)
-		return -1;
+	ctx = redis_get_ctx(node->ip,node->port);
+	if (!ctx)
+		return NULL;
 
 	if (con->id->password) {
-		rpl = redisCommand(node->context,"AUTH %s",con->id->password);
+		rpl = redisCommand(ctx,"AUTH %s",con->id->password);
 		if (rpl == NULL || rpl->type == REDIS_REPLY_ERROR) {
 			LM_ERR("failed to auth to redis - %.*s\n",
 				rpl?rpl->len:7,rpl?rpl->str:"FAILURE");
 			freeReplyObject(rpl);
-			redisFree(node->context);
-			return -1;
+			redisFree(ctx);
+			return NULL;
 		}
 		LM_DBG("AUTH [password] -  %.*s\n",rpl->len,rpl->str);
 		freeReplyObject(rpl);
 	}
 
 	if ((con->flags & REDIS_SINGLE_INSTANCE) && con->id->database) {
-		rpl = redisCommand(node->context,"SELECT %s",con->id->database);
+		rpl = redisCommand(ctx,"SELECT %s",con->id->database);
 		if (rpl == NULL || rpl->type == REDIS_REPLY_ERROR) {
 			LM_ERR("failed to select database %s - %.*s\n",con->id->database,
 				rpl?rpl->len:7,rpl?rpl->str:"FAILURE");
 			freeReplyObject(rpl);
-			redisFree(node->context);
-			return -1;
+			redisFree(ctx);
+			return NULL;
 		}
 
 		LM_DBG("SELECT [%s] - %.*s\n",con->id->database,rpl->len,rpl->str);
 		freeReplyObject(rpl);
 	}
 
+	return ctx;
+}
+
+int redis_connect_node(redis_con *con,cluster_node *node)
+{
+	node->context = redis_open_node_ctx(con,node);
+	if (!node->context)
+		return -1;
+
 	return 0;
 }
 
@@ -157,14 +170,13 @@ int redis_connect(redis_con *con)
 			redisFree(ctx);
 			return -1;
 		}
+		memset(con->nodes,0,sizeof(cluster_node) + len + 1);
 		con->nodes->ip = (char *)(con->nodes + 1);
 
 		strcpy(con->nodes->ip,con->id->host);
 		con->nodes->port = con->id->port;
 		con->nodes->start_slot = 0;
 		con->nodes->end_slot = 4096;
-		con->nodes->context = NULL;
-		con->nodes->next = NULL;
 		LM_DBG("single instance mode\n");
 	} else {
 		/* cluster instance mode */
@@ -195,6 +207,11 @@ int redis_connect(redis_con *con)
 		}
 	}
 
+	if ((con->flags & REDIS_CLUSTER_INSTANCE) && build_slot_map(con) < 0) {
+		LM_ERR("failed to index the cluster slots\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -247,6 +264,9 @@ void redis_free_connection(cachedb_pool_con *con)
 	if (!con) return;
 	c = (redis_con *)con;
 	destroy_cluster_nodes(c);
+	if (c->slot_map)
+		pkg_free(c->slot_map);
+	redis_nc_destroy(c);
 	pkg_free(c);
 }
 
@@ -290,6 +310,98 @@ void redis_destroy(cachedb_con *con) {
 		} \
 	} while (0)
 
+cluster_node *redis_get_node(redis_con *con,str *key)
+{
+	cluster_node *node;
+
+	if (!(con->flags & REDIS_INIT_NODES) && redis_connect(con) < 0) {
+		LM_ERR("failed to connect to DB\n");
+		return NULL;
+	}
+
+	node = get_redis_connection(con,key);
+	if (node == NULL) {
+		LM_ERR("Bad cluster configuration\n");
+		return NULL;
+	}
+
+	if (node->context == NULL && redis_reconnect_node(con,node) < 0)
+		return NULL;
+
+	return node;
+}
+
+redis_async_con *redis_get_async_con(redis_con *con,cluster_node *node)
+{
+	redis_async_con *ac;
+	int i;
+
+	if (redis_async_conns <= 0)
+		return NULL;
+
+	if (node->async_cons == NULL) {
+		node->async_cons = pkg_malloc(redis_async_conns * sizeof *ac);
+		if (node->async_cons == NULL) {
+			LM_ERR("no more pkg\n");
+			return NULL;
+		}
+		memset(node->async_cons,0,redis_async_conns * sizeof *ac);
+	}
+
+	for (i=0;i<redis_async_conns;i++) {
+		ac = &node->async_cons[i];
+		if (ac->busy)
+			continue;
+
+		/* drop the connections broken during a previous query */
+		if (ac->context && ac->context->err != REDIS_OK) {
+			redisFree(ac->context);
+			ac->context = NULL;
+		}
+
+		if (ac->context == NULL) {
+			ac->context = redis_open_node_ctx(con,node);
+			if (ac->context == NULL)
+				return NULL;
+		}
+
+		ac->busy = 1;
+		return ac;
+	}
+
+	LM_DBG("all the async connections to %s:%hu are busy\n",
+		node->ip,node->port);
+	return NULL;
+}
+
+/* reads the replies of the last @n commands appended to the context; all of
+ * them are consumed, even if some failed, so the connection stays in sync */
+static int redis_get_replies(redisContext *ctx,redisReply **reply,int n)
+{
+	int i,ret = 0;
+
+	for (i=0;i<n;i++) {
+		if (redisGetReply(ctx,(void **)&reply[i]) != REDIS_OK) {
+			LM_ERR("Redis operation failure - %s\n",ctx->errstr);
+			while (i--)
+				freeReplyObject(reply[i]);
+			return -1;
+		}
+
+		if (reply[i]->type == REDIS_REPLY_ERROR) {
+			LM_ERR("Redis operation failure - %.*s\n",
+				reply[i]->len,reply[i]->str);
+			ret = -1;
+		}
+	}
+
+	if (ret < 0)
+		for (i=0;i<n;i++)
+			freeReplyObject(reply[i]);
+
+	return ret;
+}
+
 int redis_get(cachedb_con *connection,str *attr,str *val)
 {
 	redis_con *con;
@@ -302,6 +414,9 @@ int redis_get(cachedb_con *connection,str *attr,str *val)
 		return -1;
 	}
 
+	if (redis_nc_fetch((redis_con *)connection->data,attr,val) == 1)
+		return 0;
+
 	redis_run_command(con,attr,"GET %b",attr->s,attr->len);
 
 	if (reply->type == REDIS_REPLY_NIL || reply->str == NULL
@@ -309,6 +424,7 @@ int redis_get(cachedb_con *connection,str *attr,str *val)
 		LM_DBG("no such key - %.*s\n",attr->len,attr->s);
 		val->s = NULL;
 		val->len = 0;
+		freeReplyObject(reply);
 		return -2;
 	}
 
@@ -324,6 +440,8 @@ int redis_get(cachedb_con *connection,str *attr,str *val)
 	memcpy(val->s,reply->str,reply->len);
 	val->len = reply->len;
 	freeReplyObject(reply);
+
+	redis_nc_store(con,attr,val,0);
 	return 0;
 }
 
@@ -339,22 +457,20 @@ int redis_set(cachedb_con *connection,str *attr,str *val,int expires)
 		return -1;
 	}
 
-	redis_run_command(con,attr,"SET %b %b",attr->s,attr->len,val->s,val->len);
+	/* set the value and its expiry at once, in a single round-trip */
+	if (expires)
+		redis_run_command(con,attr,"SET %b %b EX %d",attr->s,attr->len,
+			val->s,val->len,expires);
+	else
+		redis_run_command(con,attr,"SET %b %b",attr->s,attr->len,
+			val->s,val->len);
 
-	LM_DBG("set %.*s to %.*s - status = %d - %.*s\n",attr->len,attr->s,val->len,
-			val->s,reply->type,reply->len,reply->str);
+	LM_DBG("set %.*s to %.*s (expires %d) - status = %d - %.*s\n",attr->len,
+			attr->s,val->len,val->s,expires,reply->type,reply->len,reply->str);
 
 	freeReplyObject(reply);
 
-	if (expires) {
-		redis_run_command(con,attr,"EXPIRE %b %d",attr->s,attr->len,expires);
-
-		LM_DBG("set %.*s to expire in %d s - %.*s\n",attr->len,attr->s,expires,
-				reply->len,reply->str);
-
-		freeReplyObject(reply);
-	}
-
+	redis_nc_store(con,attr,val,expires);
 	return 0;
 }
 
@@ -382,70 +498,79 @@ int redis_remove(cachedb_con *connection,str *attr)
 		LM_DBG("Key %.*s successfully removed\n",attr->len,attr->s);
 
 	freeReplyObject(reply);
+
+	redis_nc_remove(con,attr);
 	return ret;
 }
 
-/* returns the new value of the counter */
-int redis_add(cachedb_con *connection,str *attr,int val,int expires,int *new_val)
+/* the counter update and its EXPIRE are pipelined, so they only cost
+ * a single round-trip to the server */
+static int redis_counter_op(cachedb_con *connection,const char *op,str *attr,
+		int val,int expires,int *new_val)
 {
 	redis_con *con;
 	cluster_node *node;
-	redisReply *reply;
-	int i;
+	redisReply *reply[2];
+	int i,n;
 
 	if (!attr || !connection) {
 		LM_ERR("null parameter\n");
 		return -1;
 	}
 
-	redis_run_command(con,attr,"INCRBY %b %d",attr->s,attr->len,val);
-
-	if (new_val)
-		*new_val = reply->integer;
-	freeReplyObject(reply);
+	con = (redis_con *)connection->data;
+	node = redis_get_node(con,attr);
+	if (node == NULL)
+		return -1;
 
-	if (expires) {
-		redis_run_command(con,attr,"EXPIRE %b %d",attr->s,attr->len,expires);
+	n = expires ? 2 : 1;
+	for (i=2;i;i--) {
+		redisAppendCommand(node->context,"%s %b %d",op,attr->s,attr->len,val);
+		if (expires)
+			redisAppendCommand(node->context,"EXPIRE %b %d",
+				attr->s,attr->len,expires);
 
-		LM_DBG("set %.*s to expire in %d s - %.*s\n",attr->len,attr->s,expires,
-				reply->len,reply->str);
+		if (redis_get_replies(node->context,reply,n) == 0)
+			break;
 
-		freeReplyObject(reply);
+		if (node->context->err == REDIS_OK ||
+		        redis_reconnect_node(con,node) < 0) {
+			i = 0; break;
+		}
 	}
 
-	return 0;
-}
-
-int redis_sub(cachedb_con *connection,str *attr,int val,int expires,int *new_val)
-{
-	redis_con *con;
-	cluster_node *node;
-	redisReply *reply;
-	int i;
-
-	if (!attr || !connection) {
-		LM_ERR("null parameter\n");
+	if (i==0) {
+		LM_ERR("giving up on query\n");
 		return -1;
 	}
 
-	redis_run_command(con,attr,"DECRBY %b %d",attr->s,attr->len,val);
+	redis_nc_remove(con,attr);
 
+	LM_DBG("%s %.*s by %d - %lld\n",op,attr->len,attr->s,val,reply[0]->integer);
 	if (new_val)
-		*new_val = reply->integer;
-	freeReplyObject(reply);
+		*new_val = reply[0]->integer;
+	freeReplyObject(reply[0]);
 
 	if (expires) {
-		redis_run_command(con,attr,"EXPIRE %b %d",attr->s,attr->len,expires);
-
-		LM_DBG("set %.*s to expire in %d s - %.*s\n",attr->len,attr->s,expires,
-				reply->len,reply->str);
-
-		freeReplyObject(reply);
+		LM_DBG("set %.*s to expire in %d s - %lld\n",attr->len,attr->s,
+			expires,reply[1]->integer);
+		freeReplyObject(reply[1]);
 	}
 
 	return 0;
 }
 
+/* returns the new value of the counter */
+int redis_add(cachedb_con *connection,str *attr,int val,int expires,int *new_val)
+{
+	return redis_counter_op(connection,"INCRBY",attr,val,expires,new_val);
+}
+
+int redis_sub(cachedb_con *connection,str *attr,int val,int expires,int *new_val)
+{
+	return redis_counter_op(connection,"DECRBY",attr,val,expires,new_val);
+}
+
 int redis_get_counter(cachedb_con *connection,str *attr,int *val)
 {
 	redis_con *con;
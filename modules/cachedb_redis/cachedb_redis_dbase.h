@@ -29,6 +29,12 @@
 #include <hiredis/hiredis.h>
 #include "../../cachedb/cachedb.h"
 
+/* extra connection to a node, used by a single async query at a time */
+typedef struct redis_async_con {
+	redisContext *context;
+	int busy;
+} redis_async_con;
+
 typedef struct cluster_nodes {
 	char *ip;							/* ip of this cluster node */
 	short port;						/* port of this cluster node */
@@ -36,6 +42,7 @@ typedef struct cluster_nodes {
 	unsigned short end_slot;		/* last slot for this server */
 
 	redisContext *context;			/* actual connection to this node */
+	redis_async_con *async_cons;	/* connections for the async queries */
 	struct cluster_nodes *next;
 } cluster_node;
 
@@ -45,6 +52,7 @@ typedef struct cluster_nodes {
 extern int redis_query_tout;
 extern int redis_connnection_tout;
 extern int shutdown_on_error;
+extern int redis_async_conns;
 
 enum redis_flag {
 	REDIS_SINGLE_INSTANCE  = 1 << 0,
@@ -60,6 +68,9 @@ typedef struct {
 	enum redis_flag flags;
 	unsigned short slots_assigned; /* total slots for cluster */
 	cluster_node *nodes; /* one or more Redis nodes */
+	cluster_node **slot_map; /* cluster nodes, sorted by their slots */
+	int slot_map_len;
+	struct redis_nearcache *ncache; /* local copies of the fetched keys */
 } redis_con;
 
 cachedb_con* redis_init(str *url);
@@ -72,5 +83,8 @@ int redis_sub(cachedb_con *con,str *attr,int val,int expires,int *new_val);
 int redis_get_counter(cachedb_con *connection,str *attr,int *val);
 int redis_raw_query(cachedb_con *connection,str *attr,cdb_raw_entry ***reply,int expected_kv_no,int *reply_no);
 
+cluster_node *redis_get_node(redis_con *con,str *key);
+redis_async_con *redis_get_async_con(redis_con *con,cluster_node *node);
+
 #endif /* CACHEDBREDIS_DBASE_H */
 
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <string.h>
+
+#include "../../dprint.h"
+#include "../../mem/mem.h"
+#include "../../hash_func.h"
+#include "../../timer.h"
+#include "cachedb_redis_nearcache.h"
+
+int near_cache_ttl = 0;
+int near_cache_size = 1024;
+str near_cache_prefix = {NULL, 0};
+
+stat_var *near_cache_hits;
+stat_var *near_cache_misses;
+
+struct nc_entry {
+	unsigned int hash;
+	unsigned int expires;
+	str key;
+	str val;
+	struct nc_entry *hnext;
+	/* the LRU list, most recently used first */
+	struct nc_entry *prev;
+	struct nc_entry *next;
+};
+
+struct redis_nearcache {
+	unsigned int size;
+	int used;
+	struct nc_entry **buckets;
+	struct nc_entry *head;
+	struct nc_entry *tail;
+};
+
+
+static inline int nc_enabled(str *key)
+{
+	if (near_cache_ttl <= 0 || near_cache_size <= 0)
+		return 0;
+
+	return key->len >= near_cache_prefix.len &&
+		!memcmp(key->s, near_cache_prefix.s, near_cache_prefix.len);
+}
+
+static struct redis_nearcache *nc_get(redis_con *con)
+{
+	struct redis_nearcache *nc;
+	unsigned int size;
+
+	if (con->ncache)
+		return con->ncache;
+
+	for (size = 1; size < near_cache_size; size <<= 1) ;
+
+	nc = pkg_malloc(sizeof *nc + size * sizeof *nc->buckets);
+	if (!nc) {
+		LM_ERR("no more pkg memory\n");
+		return NULL;
+	}
+	memset(nc, 0, sizeof *nc + size * sizeof *nc->buckets);
+
+	nc->size = size;
+	nc->buckets = (struct nc_entry **)(nc + 1);
+
+	con->ncache = nc;
+	return nc;
+}
+
+/* @return: the link pointing to the entry, or to the end of its bucket */
+static struct nc_entry **nc_lookup(struct redis_nearcache *nc,
+		str *key, unsigned int hash)
+{
+	struct nc_entry **link;
+
+	for (link = &nc->buckets[hash & (nc->size - 1)]; *link;
+	        link = &(*link)->hnext)
+		if ((*link)->hash == hash && (*link)->key.len == key->len &&
+		        !memcmp((*link)->key.s, key->s, key->len))
+			break;
+
+	return link;
+}
+
+static void nc_unlink(struct redis_nearcache *nc, struct nc_entry *e)
+{
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		nc->head = e->next;
+
+	if (e->next)
+		e->next->prev = e->prev;
+	else
+		nc->tail = e->prev;
+}
+
+static void nc_push(struct redis_nearcache *nc, struct nc_entry *e)
+{
+	e->prev = NULL;
+	e->next = nc->head;
+	if (nc->head)
+		nc->head->prev = e;
+	else
+		nc->tail = e;
+	nc->head = e;
+}
+
+static void nc_drop(struct redis_nearcache *nc, struct nc_entry **link)
+{
+	struct nc_entry *e = *link;
+
+	*link = e->hnext;
+	nc_unlink(nc, e);
+	pkg_free(e);
+	nc->used--;
+}
+
+
+int redis_nc_fetch(redis_con *con, str *key, str *val)
+{
+	struct redis_nearcache *nc = con->ncache;
+	struct nc_entry **link, *e;
+	unsigned int hash;
+
+	if (!nc_enabled(key))
+		return 0;
+
+	if (!nc)
+		goto miss;
+
+	hash = core_hash(key, NULL, 0);
+	link = nc_lookup(nc, key, hash);
+	e = *link;
+	if (!e)
+		goto miss;
+
+	if (e->expires <= get_ticks()) {
+		nc_drop(nc, link);
+		goto miss;
+	}
+
+	val->s = pkg_malloc(e->val.len);
+	if (!val->s) {
+		LM_ERR("no more pkg memory\n");
+		goto miss;
+	}
+	memcpy(val->s, e->val.s, e->val.len);
+	val->len = e->val.len;
+
+	if (e != nc->head) {
+		nc_unlink(nc, e);
+		nc_push(nc, e);
+	}
+
+	update_stat(near_cache_hits, 1);
+	return 1;
+
+miss:
+	update_stat(near_cache_misses, 1);
+	return 0;
+}
+
+void redis_nc_store(redis_con *con, str *key, str *val, int expires)
+{
+	struct redis_nearcache *nc;
+	struct nc_entry **link, *e;
+	unsigned int hash;
+
+	if (!nc_enabled(key) || !(nc = nc_get(con)))
+		return;
+
+	hash = core_hash(key, NULL, 0);
+	link = nc_lookup(nc, key, hash);
+	if (*link)
+		nc_drop(nc, link);
+
+	if (nc->used >= near_cache_size) {
+		e = nc->tail;
+		nc_drop(nc, nc_lookup(nc, &e->key, e->hash));
+	}
+
+	e = pkg_malloc(sizeof *e + key->len + val->len);
+	if (!e) {
+		LM_ERR("no more pkg memory\n");
+		return;
+	}
+
+	e->hash = hash;
+	e->expires = get_ticks() +
+		(expires && expires < near_cache_ttl ? expires : near_cache_ttl);
+	e->key.s = (char *)(e + 1);
+	e->key.len = key->len;
+	memcpy(e->key.s, key->s, key->len);
+	e->val.s = e->key.s + key->len;
+	e->val.len = val->len;
+	memcpy(e->val.s, val->s, val->len);
+
+	link = &nc->buckets[hash & (nc->size - 1)];
+	e->hnext = *link;
+	*link = e;
+
+	nc_push(nc, e);
+	nc->used++;
+}
+
+void redis_nc_remove(redis_con *con, str *key)
+{
+	struct redis_nearcache *nc = con->ncache;
+	struct nc_entry **link;
+
+	if (!nc || !nc_enabled(key))
+		return;
+
+	link = nc_lookup(nc, key, core_hash(key, NULL, 0));
+	if (*link)
+		nc_drop(nc, link);
+}
+
+void redis_nc_destroy(redis_con *con)
+{
+	struct redis_nearcache *nc = con->ncache;
+	struct nc_entry *e, *next;
+
+	if (!nc)
+		return;
+
+	for (e = nc->head; e; e = next) {
+		next = e->next;
+		pkg_free(e);
+	}
+
+	pkg_free(nc);
+	con->ncache = NULL;
+}
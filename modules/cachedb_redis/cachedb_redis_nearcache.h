@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Per-process "near cache" of the fetched keys: the values read from Redis
+ * are kept in pkg memory for up to near_cache_ttl seconds, so that the
+ * read-mostly keys do not cost a round-trip on each fetch. The local writes
+ * update or drop the cached copy, while the writes done by other processes
+ * or servers only become visible once the copy expires.
+ */
+
+#ifndef CACHEDB_REDIS_NEARCACHE_H
+#define CACHEDB_REDIS_NEARCACHE_H
+
+#include "../../statistics.h"
+#include "cachedb_redis_dbase.h"
+
+extern int near_cache_ttl;
+extern int near_cache_size;
+extern str near_cache_prefix;
+
+extern stat_var *near_cache_hits;
+extern stat_var *near_cache_misses;
+
+/* @return: 1 on hit, with @val allocated in pkg, 0 on miss */
+int redis_nc_fetch(redis_con *con, str *key, str *val);
+
+/* caches (or refreshes) the value of the key, for at most @expires seconds,
+ * if non-zero */
+void redis_nc_store(redis_con *con, str *key, str *val, int expires);
+
+void redis_nc_remove(redis_con *con, str *key);
+
+void redis_nc_destroy(redis_con *con);
+
+#endif /* CACHEDB_REDIS_NEARCACHE_H */
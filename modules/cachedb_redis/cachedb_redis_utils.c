@@ -83,26 +83,84 @@ unsigned int redisHash(redis_con *con, str* key)
 	return crc16(key->s,key->len) & con->slots_assigned;
 }
 
+/* indexes the cluster nodes by their first slot, so the node serving a key
+ * can be found with a binary search */
+int build_slot_map(redis_con *con)
+{
+	cluster_node *it,*tmp;
+	int n,i;
+
+	for (n=0,it=con->nodes;it;it=it->next)
+		n++;
+
+	if (con->slot_map)
+		pkg_free(con->slot_map);
+
+	con->slot_map = pkg_malloc(n * sizeof *con->slot_map);
+	if (!con->slot_map) {
+		LM_ERR("no more pkg\n");
+		con->slot_map_len = 0;
+		return -1;
+	}
+
+	/* insertion sort - there are only a handful of masters */
+	for (n=0,it=con->nodes;it;it=it->next,n++) {
+		for (i=n;i>0 && con->slot_map[i-1]->start_slot > it->start_slot;i--)
+			con->slot_map[i] = con->slot_map[i-1];
+		con->slot_map[i] = it;
+	}
+	con->slot_map_len = n;
+
+	for (i=1;i<n;i++) {
+		tmp = con->slot_map[i-1];
+		if (tmp->end_slot >= con->slot_map[i]->start_slot)
+			LM_WARN("overlapping slots %hu-%hu and %hu-%hu\n",
+				tmp->start_slot,tmp->end_slot,
+				con->slot_map[i]->start_slot,con->slot_map[i]->end_slot);
+	}
+
+	return 0;
+}
+
 cluster_node *get_redis_connection(redis_con *con,str *key)
 {
 	unsigned short hash_slot;
 	cluster_node *it;
+	int lo,hi,mid;
 
 	if (con->flags & REDIS_SINGLE_INSTANCE)
 		return con->nodes;
-	else {
-		hash_slot = redisHash(con, key);
-		for (it=con->nodes;it;it=it->next) {
-			if (it->start_slot <= hash_slot && it->end_slot >= hash_slot)
-				return it;
+
+	hash_slot = redisHash(con, key);
+
+	if (con->slot_map) {
+		/* look for the last node starting at or before the slot */
+		lo = 0;
+		hi = con->slot_map_len - 1;
+		it = NULL;
+		while (lo <= hi) {
+			mid = (lo + hi) / 2;
+			if (con->slot_map[mid]->start_slot <= hash_slot) {
+				it = con->slot_map[mid];
+				lo = mid + 1;
+			} else {
+				hi = mid - 1;
+			}
 		}
-		return NULL;
+		return (it && it->end_slot >= hash_slot) ? it : NULL;
+	}
+
+	for (it=con->nodes;it;it=it->next) {
+		if (it->start_slot <= hash_slot && it->end_slot >= hash_slot)
+			return it;
 	}
+	return NULL;
 }
 
 void destroy_cluster_nodes(redis_con *con)
 {
 	cluster_node *new,*foo;
+	int i;
 
 	LM_DBG("destroying cluster %p\n",con);
 
@@ -110,6 +168,12 @@ void destroy_cluster_nodes(redis_con *con)
 	while (new) {
 		foo = new->next;
 		redisFree(new->context);
+		if (new->async_cons) {
+			for (i=0;i<redis_async_conns;i++)
+				if (new->async_cons[i].context)
+					redisFree(new->async_cons[i].context);
+			pkg_free(new->async_cons);
+		}
 		pkg_free(new);
 		new = foo;
 	}
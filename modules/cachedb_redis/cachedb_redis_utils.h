@@ -29,6 +29,7 @@
 #include "cachedb_redis_dbase.h"
 
 int build_cluster_nodes(redis_con *con,char *info,int size);
+int build_slot_map(redis_con *con);
 cluster_node *get_redis_connection(redis_con *con,str *key);
 void destroy_cluster_nodes(redis_con *con);
 
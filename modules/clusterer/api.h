@@ -108,6 +108,17 @@ typedef int (*get_my_sip_addr_f)(int cluster_id, str *out_addr);
  */
 typedef int (*get_my_index_f)(int cluster_id, str *capability, int *nr_nodes);
 
+/*
+ * Return the id of the node owning @key within cluster @cluster_id. The owner
+ * is chosen by consistent (rendezvous) hashing over the currently reachable
+ * nodes, so all the nodes agree on it and only the keys of a joining/leaving
+ * node change their owner.
+ *
+ * Return: owner node id (may be the current node), -1 on error or if no
+ *         node is available
+ */
+typedef int (*get_shard_owner_f)(int cluster_id, str *key);
+
 /*
  * Send a message to a specific node in the cluster.
  */
@@ -176,6 +187,18 @@ typedef bin_packet_t* (*sync_chunk_start_f)(str *capability, int cluster_id, int
  * Returns 1 if there are any chunks left, and 0 otherwise.
  */
 typedef int (*sync_chunk_iter_f)(bin_packet_t *packet);
+/*
+ * Check if the data hashed to @hash should be included in the sync
+ * currently being sent. The requesting node may split the data set in
+ * several shards, pulled from different nodes, so the modules should skip
+ * the data outside of the requested shard. The @hash (e.g. a hash table slot)
+ * must be computed in the same way by all the nodes.
+ *
+ * This function should only be called from the callback for the SYNC_REQ_RCV event.
+ *
+ * Returns 1 if the data belongs to the requested shard, and 0 otherwise.
+ */
+typedef int (*sync_in_shard_f)(unsigned int hash);
 
 
 struct clusterer_binds {
@@ -186,6 +209,7 @@ struct clusterer_binds {
 	get_my_id_f get_my_id;
 	get_my_sip_addr_f get_my_sip_addr;
 	get_my_index_f get_my_index;
+	get_shard_owner_f get_shard_owner;
 	send_to_f send_to;
 	send_all_f send_all;
 	send_all_having_f send_all_having;
@@ -195,6 +219,7 @@ struct clusterer_binds {
 	request_sync_f request_sync;
 	sync_chunk_start_f sync_chunk_start;
 	sync_chunk_iter_f sync_chunk_iter;
+	sync_in_shard_f sync_in_shard;
 };
 
 typedef int (*load_clusterer_f)(struct clusterer_binds *binds);
@@ -0,0 +1,272 @@
+/* Copyright (C) 2018 OpenSIPS Project
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batching of the replicated (broadcasted) module packets: instead of
+ * writing each one of them to every node, the packets are queued per
+ * (cluster, capability) and sent out together, inside a single
+ * CLUSTERER_BATCH packet, once the queue fills up or as soon as the
+ * SIP message which generated them is processed. The packets queued
+ * outside of the SIP processing (timer routes, MI) are sent by the flush
+ * timer. The receiving node unpacks them and runs each one through the
+ * regular BIN callbacks, in the order they were queued.
+ */
+
+#include "../../mem/shm_mem.h"
+#include "../../locking.h"
+#include "../../rw_locking.h"
+
+#include "api.h"
+#include "node_info.h"
+#include "clusterer.h"
+#include "batch.h"
+
+int batch_size = 0;
+int batch_flush_interval = DEFAULT_BATCH_FLUSH_INTERVAL;
+
+stat_var *batch_frames;
+stat_var *batch_packets;
+
+struct cl_batch {
+	gen_lock_t lock;
+	int cluster_id;
+	str cap;
+	/* the queued packets, trailer included, one after the other */
+	char *buf;
+	int len;
+	int count;
+	/* when the oldest queued packet was added */
+	utime_t since;
+	/* for the replication lag statistic */
+	unsigned long frames;
+	unsigned long long lag;
+	struct cl_batch *next;
+};
+
+/* built at startup only, so it can be walked without locking */
+static struct cl_batch *batches;
+
+/* set once this process queued a packet */
+static int batch_pending;
+
+
+int cl_batch_add(str *cap, int cluster_id)
+{
+	struct cl_batch *b;
+
+	if (batch_size <= 0)
+		return 0;
+
+	b = shm_malloc(sizeof *b + batch_size);
+	if (!b) {
+		LM_ERR("No more shm memory\n");
+		return -1;
+	}
+	memset(b, 0, sizeof *b);
+
+	if (!lock_init(&b->lock)) {
+		LM_ERR("Failed to init lock\n");
+		shm_free(b);
+		return -1;
+	}
+
+	b->cluster_id = cluster_id;
+	b->cap = *cap;
+	b->buf = (char *)(b + 1);
+
+	b->next = batches;
+	batches = b;
+
+	return 0;
+}
+
+static inline struct cl_batch *get_batch(str *cap, int cluster_id)
+{
+	struct cl_batch *b;
+
+	for (b = batches; b; b = b->next)
+		if (b->cluster_id == cluster_id && !str_strcmp(&b->cap, cap))
+			return b;
+
+	return NULL;
+}
+
+/* must be called with the batch lock held, so the packets leave in order */
+static void flush_batch(struct cl_batch *b)
+{
+	bin_packet_t frame;
+	str payload;
+	int rc;
+
+	payload.s = b->buf;
+	payload.len = b->len;
+
+	if (bin_init(&frame, &cl_extra_cap, CLUSTERER_BATCH, BIN_VERSION,
+			MIN_BIN_PACKET_SIZE + cl_extra_cap.len + LEN_FIELD_SIZE +
+			b->len + 3 * sizeof(int)) < 0) {
+		LM_ERR("Failed to init bin send buffer\n");
+		goto drop;
+	}
+
+	if (bin_push_str(&frame, &payload) < 0 ||
+	        msg_add_trailer(&frame, b->cluster_id, -1 /* dummy value */) < 0) {
+		LM_ERR("Failed to build batch packet\n");
+		bin_free_packet(&frame);
+		goto drop;
+	}
+
+	rc = clusterer_bcast_msg(&frame, b->cluster_id);
+	if (rc == CLUSTERER_SEND_ERR)
+		LM_ERR("Failed to send batch of %d %.*s packets\n", b->count,
+			b->cap.len, b->cap.s);
+
+	bin_free_packet(&frame);
+
+	update_stat(batch_frames, 1);
+	update_stat(batch_packets, b->count);
+	b->frames++;
+	b->lag += get_uticks() - b->since;
+
+drop:
+	b->len = 0;
+	b->count = 0;
+}
+
+int cl_batch_packet(bin_packet_t *packet, int cluster_id)
+{
+	struct cl_batch *b;
+	str cap, buf;
+
+	if (batch_size <= 0)
+		return 1;
+
+	bin_get_capability(packet, &cap);
+	b = get_batch(&cap, cluster_id);
+	if (!b)
+		return 1;
+
+	if (msg_add_trailer(packet, cluster_id, -1 /* fixed up by receiver */) < 0) {
+		LM_ERR("Failed to add trailer to module's message\n");
+		return CLUSTERER_SEND_ERR;
+	}
+	bin_get_buffer(packet, &buf);
+
+	lock_get(&b->lock);
+
+	if (b->len + buf.len > batch_size && b->count)
+		flush_batch(b);
+
+	if (buf.len > batch_size) {
+		/* too large to be batched anyway */
+		lock_release(&b->lock);
+		bin_remove_int_buffer_end(packet, 3);
+		return 1;
+	}
+
+	memcpy(b->buf + b->len, buf.s, buf.len);
+	b->len += buf.len;
+	if (b->count++ == 0)
+		b->since = get_uticks();
+
+	lock_release(&b->lock);
+
+	batch_pending = 1;
+
+	bin_remove_int_buffer_end(packet, 3);
+
+	return CLUSTERER_SEND_SUCCES;
+}
+
+static void flush_batches(void)
+{
+	struct cl_batch *b;
+
+	for (b = batches; b; b = b->next) {
+		if (!b->count)
+			continue;
+
+		lock_get(&b->lock);
+		if (b->count)
+			flush_batch(b);
+		lock_release(&b->lock);
+	}
+}
+
+void cl_batch_timer(utime_t ticks, void *param)
+{
+	flush_batches();
+}
+
+/* the packets queued while processing a SIP message are sent right after
+ * it, along with the ones queued meanwhile by the other processes, so the
+ * batching only adds the processing time of a message to their delay */
+int cl_batch_script_flush(struct sip_msg *msg, void *param)
+{
+	if (batch_pending) {
+		batch_pending = 0;
+		flush_batches();
+	}
+
+	return SCB_RUN_ALL;
+}
+
+void handle_batch_packet(bin_packet_t *packet, struct receive_info *ri)
+{
+	str payload;
+	char *p, *end;
+	unsigned int len;
+
+	if (bin_pop_str(packet, &payload) != 0) {
+		LM_ERR("Bad batch packet\n");
+		return;
+	}
+
+	for (p = payload.s, end = payload.s + payload.len; p < end; p += len) {
+		if (end - p < MIN_BIN_PACKET_SIZE || !is_valid_bin_packet(p)) {
+			LM_ERR("Bad packet inside batch, dropping the rest of it\n");
+			return;
+		}
+
+		memcpy(&len, p + BIN_PACKET_MARKER_SIZE, sizeof len);
+		if (len < MIN_BIN_PACKET_SIZE + 3 * sizeof(int) || len > end - p) {
+			LM_ERR("Bad packet length inside batch, dropping the rest of it\n");
+			return;
+		}
+
+		/* the batched packets were broadcasted, so set ourselves as the
+		 * destination, as done by the sender for regular packets */
+		memcpy(p + len - sizeof(int), &current_id, sizeof(int));
+
+		call_callbacks(p, ri);
+	}
+}
+
+unsigned long cl_batch_avg_lag(void *foo)
+{
+	struct cl_batch *b;
+	unsigned long frames = 0;
+	unsigned long long lag = 0;
+
+	for (b = batches; b; b = b->next) {
+		frames += b->frames;
+		lag += b->lag;
+	}
+
+	return frames ? (unsigned long)(lag / frames) : 0;
+}
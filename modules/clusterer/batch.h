@@ -0,0 +1,54 @@
+/* Copyright (C) 2018 OpenSIPS Project
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef CLUSTERER_BATCH_H
+#define CLUSTERER_BATCH_H
+
+#include "../../bin_interface.h"
+#include "../../statistics.h"
+#include "../../timer.h"
+#include "../../script_cb.h"
+
+#define DEFAULT_BATCH_FLUSH_INTERVAL 100 /* in milliseconds */
+/* the whole batch travels as a single BIN string */
+#define MAX_BATCH_SIZE 65000
+
+extern int batch_size;
+extern int batch_flush_interval;
+
+extern stat_var *batch_frames;
+extern stat_var *batch_packets;
+
+/* set up a send queue for the broadcasts of capability @cap in @cluster_id;
+ * only called at startup, while registering the capabilities */
+int cl_batch_add(str *cap, int cluster_id);
+
+/* @return: CLUSTERER_SEND_SUCCES if the packet was queued, 1 if the packet
+ * is not to be batched and should be sent right away, <0 on error */
+int cl_batch_packet(bin_packet_t *packet, int cluster_id);
+
+void cl_batch_timer(utime_t ticks, void *param);
+
+int cl_batch_script_flush(struct sip_msg *msg, void *param);
+
+void handle_batch_packet(bin_packet_t *packet, struct receive_info *ri);
+
+unsigned long cl_batch_avg_lag(void *foo);
+
+#endif  /* CLUSTERER_BATCH_H */
@@ -39,6 +39,7 @@
 #include "node_info.h"
 #include "clusterer.h"
 #include "sync.h"
+#include "batch.h"
 
 struct clusterer_binds clusterer_api;
 
@@ -656,7 +657,7 @@ enum clusterer_send_ret clusterer_send_msg(bin_packet_t *packet,
 	return CLUSTERER_SEND_ERR;
 }
 
-static enum clusterer_send_ret clusterer_bcast_msg(bin_packet_t *packet, int cluster_id)
+enum clusterer_send_ret clusterer_bcast_msg(bin_packet_t *packet, int cluster_id)
 {
 	node_info_t *node;
 	int rc, sent = 0, down = 1;
@@ -832,6 +833,12 @@ enum clusterer_send_ret cl_send_to(bin_packet_t *packet, int cluster_id, int nod
 
 enum clusterer_send_ret cl_send_all(bin_packet_t *packet, int cluster_id)
 {
+	int rc;
+
+	rc = cl_batch_packet(packet, cluster_id);
+	if (rc != 1)
+		return rc;
+
 	if (msg_add_trailer(packet, cluster_id, -1 /* dummy value */) < 0) {
 		LM_ERR("Failed to add trailer to module's message\n");
 		return CLUSTERER_SEND_ERR;
@@ -1342,7 +1349,7 @@ static void handle_cap_update(bin_packet_t *packet, node_info_t *source)
 						lock_release(source->cluster->lock);
 
 						rc = send_sync_req(&cap, source->cluster->cluster_id,
-											node_id);
+											node_id, 0, 1);
 						if (rc == CLUSTERER_SEND_SUCCES) {
 							lock_get(source->cluster->lock);
 							lcap->flags &= ~CAP_SYNC_PENDING;
@@ -1776,7 +1783,13 @@ void bin_rcv_cl_extra_packets(bin_packet_t *packet, int packet_type,
 			handle_sync_request(packet, cl, node);
 		else if (packet_type == CLUSTERER_SYNC || packet_type == CLUSTERER_SYNC_END)
 			handle_sync_packet(packet, packet_type, cl, source_id);
-		else {
+		else if (packet_type == CLUSTERER_BATCH) {
+			/* the batched packets go through the regular receiving path,
+			 * which takes the cluster list lock again */
+			lock_stop_read(cl_list_lock);
+			handle_batch_packet(packet, ri);
+			return;
+		} else {
 			LM_ERR("Unknown clusterer message type: %d\n", packet_type);
 			goto exit;
 		}
@@ -2328,17 +2341,8 @@ static void do_actions_node_ev(cluster_info_t *clusters, int *select_cluster,
 				lock_release(node->lock);
 
 				/* check pending sync replies */
-				for (n_cap = node->capabilities; n_cap; n_cap = n_cap->next) {
-					lock_get(node->lock);
-					if (n_cap->flags & CAP_SYNC_PENDING) {
-						n_cap->flags &= ~CAP_SYNC_PENDING;
-						lock_release(node->lock);
-
-						/* reply now that the node is up */
-						send_sync_repl(cl, node->node_id, &n_cap->name);
-					} else
-						lock_release(node->lock);
-				}
+				for (n_cap = node->capabilities; n_cap; n_cap = n_cap->next)
+					send_pending_sync_repl(cl, node, n_cap);
 
 				for (cap_it = cl->capabilities; cap_it; cap_it = cap_it->next) {
 					/* check pending sync request */
@@ -2354,7 +2358,7 @@ static void do_actions_node_ev(cluster_info_t *clusters, int *select_cluster,
 									lock_release(node->lock);
 
 									rc = send_sync_req(&n_cap->name,
-										cl->cluster_id, node->node_id);
+										cl->cluster_id, node->node_id, 0, 1);
 									if (rc == CLUSTERER_SEND_SUCCES) {
 										lock_get(cl->lock);
 										cap_it->flags &= ~CAP_SYNC_PENDING;
@@ -2603,6 +2607,12 @@ int cl_register_cap(str *cap, cl_packet_cb_f packet_cb, cl_event_cb_f event_cb,
 
 	bin_register_cb(cap, bin_rcv_mod_packets, &new_cl_cap->reg);
 
+	if (cl_batch_add(cap, cluster_id) < 0) {
+		LM_ERR("Failed to set up packet batching for capability: %.*s\n",
+			cap->len, cap->s);
+		return -1;
+	}
+
 	LM_DBG("Registered capability: %.*s\n", cap->len, cap->s);
 
 	return 0;
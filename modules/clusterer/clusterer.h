@@ -27,6 +27,8 @@
 #ifndef CLUSTERER_H
 #define CLUSTERER_H
 
+#include "../../timer.h"
+
 #include "api.h"
 
 #define BIN_VERSION 1
@@ -59,7 +61,8 @@ typedef enum { CLUSTERER_PING, CLUSTERER_PONG,
 				CLUSTERER_GENERIC_MSG,
 				CLUSTERER_MI_CMD,
 				CLUSTERER_CAP_UPDATE,
-				CLUSTERER_SYNC_REQ, CLUSTERER_SYNC, CLUSTERER_SYNC_END
+				CLUSTERER_SYNC_REQ, CLUSTERER_SYNC, CLUSTERER_SYNC_END,
+				CLUSTERER_BATCH
 } clusterer_msg_type;
 
 typedef enum {
@@ -90,12 +93,21 @@ struct local_cap {
 	struct buf_bin_pkt *pkt_q_back;
 	struct buf_bin_pkt *pkt_q_cutpos;
 	unsigned int flags;
+	/* sync progress */
+	int sync_ends_pending;
+	utime_t sync_start;
+	utime_t sync_end;
+	unsigned long sync_pkts;
+	unsigned long sync_bytes;
 	struct local_cap *next;
 };
 
 struct remote_cap {
 	str name;
 	unsigned int flags;
+	/* shards of the pending sync reply */
+	int sync_shards;
+	unsigned int sync_shard_mask;
 	struct remote_cap *next;
 };
 
@@ -131,6 +143,7 @@ int get_next_hop(struct node_info *dest);
 int msg_add_trailer(bin_packet_t *packet, int cluster_id, int dst_id);
 enum clusterer_send_ret clusterer_send_msg(bin_packet_t *packet,
 												int cluster_id, int dst_id);
+enum clusterer_send_ret clusterer_bcast_msg(bin_packet_t *packet, int cluster_id);
 int send_single_cap_update(struct cluster_info *cluster, struct local_cap *cap,
 							int cap_state);
 
@@ -36,11 +36,13 @@
 #include "../../timer.h"
 #include "../../bin_interface.h"
 #include "../../mod_fix.h"
+#include "../../statistics.h"
 
 #include "api.h"
 #include "node_info.h"
 #include "clusterer.h"
 #include "sync.h"
+#include "batch.h"
 
 int ping_interval = DEFAULT_PING_INTERVAL;
 int node_timeout = DEFAULT_NODE_TIMEOUT;
@@ -61,6 +63,9 @@ str sip_addr_col = str_init("sip_addr");
 str flags_col = str_init("flags");
 str description_col = str_init("description");
 
+stat_var *shard_local_keys;
+stat_var *shard_remote_keys;
+
 extern db_con_t *db_hdl;
 extern db_func_t dr_dbf;
 
@@ -88,10 +93,16 @@ int cmd_send_req(struct sip_msg *msg, char *param_cluster, char *param_node,
 int cmd_send_rpl(struct sip_msg *msg, char *param_cluster, char *param_node,
 								char *param_msg, char *param_tag);
 int cmd_check_addr(struct sip_msg *msg, char *param_cluster, char *param_ip);
+int cmd_shard_owner(struct sip_msg *msg, char *param_cluster, char *param_key,
+								char *param_owner);
+int cmd_shard_forward(struct sip_msg *msg, char *param_cluster, char *param_key,
+								char *param_msg, char *param_tag);
 
 static int fixup_broadcast(void ** param, int param_no);
 static int fixup_send(void ** param, int param_no);
 static int fixup_check_addr(void ** param, int param_no);
+static int fixup_shard_owner(void ** param, int param_no);
+static int fixup_shard_forward(void ** param, int param_no);
 
  /*
  * Exported functionsu
@@ -111,6 +122,14 @@ static cmd_export_t cmds[] = {
 		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
 	{"cluster_check_addr", (cmd_function)cmd_check_addr, 2, fixup_check_addr, 0,
 		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
+	{"cluster_shard_owner", (cmd_function)cmd_shard_owner, 2, fixup_shard_owner, 0,
+		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
+	{"cluster_shard_owner", (cmd_function)cmd_shard_owner, 3, fixup_shard_owner, 0,
+		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
+	{"cluster_shard_forward", (cmd_function)cmd_shard_forward, 3, fixup_shard_forward, 0,
+		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
+	{"cluster_shard_forward", (cmd_function)cmd_shard_forward, 4, fixup_shard_forward, 0,
+		REQUEST_ROUTE | FAILURE_ROUTE | ONREPLY_ROUTE | LOCAL_ROUTE | BRANCH_ROUTE | EVENT_ROUTE},
 	{0,0,0,0,0,0}
 };
 
@@ -138,6 +157,9 @@ static param_export_t params[] = {
 	{"neighbor_info",		STR_PARAM|USE_FUNC_PARAM,	(void*)&provision_neighbor},
 	{"current_info",		STR_PARAM|USE_FUNC_PARAM,	(void*)&provision_current},
 	{"sync_packet_size",	INT_PARAM,	&sync_packet_size	},
+	{"sync_shards",			INT_PARAM,	&sync_shards		},
+	{"batch_size",			INT_PARAM,	&batch_size			},
+	{"batch_flush_interval",	INT_PARAM,	&batch_flush_interval	},
 	{0, 0, 0}
 };
 
@@ -162,6 +184,18 @@ static mi_export_t mi_cmds[] = {
 	{0, 0, 0, 0, 0, 0}
 };
 
+/*
+ * Exported statistics
+ */
+static stat_export_t mod_stats[] = {
+	{"shard_local_keys",	0,	&shard_local_keys	},
+	{"shard_remote_keys",	0,	&shard_remote_keys	},
+	{"batch_frames",		0,	&batch_frames		},
+	{"batch_packets",		0,	&batch_packets		},
+	{"batch_avg_lag",		STAT_IS_FUNC,	(stat_var**)cl_batch_avg_lag	},
+	{0, 0, 0}
+};
+
 static dep_export_t deps = {
 	{ /* OpenSIPS module dependencies */
 		{ MOD_TYPE_SQLDB, NULL, DEP_ABORT },
@@ -185,7 +219,7 @@ struct module_exports exports = {
 	cmds,					/* exported functions */
 	0,						/* exported async functions */
 	params,					/* exported parameters */
-	0,						/* exported statistics */
+	mod_stats,				/* exported statistics */
 	mi_cmds,				/* exported MI functions */
 	0,						/* exported pseudo-variables */
 	0,						/* exported transformations */
@@ -339,6 +373,35 @@ static int mod_init(void)
 		}
 	}
 
+	if (sync_shards < 1) {
+		LM_WARN("Invalid sync_shards parameter, using 1\n");
+		sync_shards = 1;
+	} else if (sync_shards > MAX_SYNC_SHARDS) {
+		LM_WARN("sync_shards too large, using %d\n", MAX_SYNC_SHARDS);
+		sync_shards = MAX_SYNC_SHARDS;
+	}
+
+	if (batch_size > MAX_BATCH_SIZE) {
+		LM_WARN("batch_size too large, using %d\n", MAX_BATCH_SIZE);
+		batch_size = MAX_BATCH_SIZE;
+	}
+	if (batch_size > 0) {
+		if (batch_flush_interval <= 0) {
+			LM_WARN("Invalid batch_flush_interval parameter, using default value\n");
+			batch_flush_interval = DEFAULT_BATCH_FLUSH_INTERVAL;
+		}
+		if (register_utimer("clstr-batch-flush", cl_batch_timer, NULL,
+			batch_flush_interval*1000, TIMER_FLAG_DELAY_ON_DELAY) < 0) {
+			LM_CRIT("Unable to register clusterer batch flush timer\n");
+			goto error;
+		}
+		if (register_script_cb(cl_batch_script_flush,
+			POST_SCRIPT_CB|REQ_TYPE_CB|RPL_TYPE_CB, NULL) < 0) {
+			LM_CRIT("Unable to register clusterer batch flush callback\n");
+			goto error;
+		}
+	}
+
 	if (bin_register_cb(&cl_internal_cap, bin_rcv_cl_packets, NULL) < 0) {
 		LM_CRIT("Cannot register clusterer binary packet callback!\n");
 		goto error;
@@ -539,6 +602,9 @@ static struct mi_root * clusterer_list_cap(struct mi_root *cmd_tree, void *param
 	struct mi_node *node_s = NULL;
 	struct mi_attr* attr;
 	str val;
+	unsigned long pkts, bytes;
+	utime_t duration;
+	int ends_pending;
 	static str str_ok = str_init("Ok");
 	static str str_not_synced = str_init("not synced");
 
@@ -567,6 +633,46 @@ static struct mi_root * clusterer_list_cap(struct mi_root *cmd_tree, void *param
 				(cap->flags & CAP_STATE_OK) ? str_ok.s : str_not_synced.s,
 				(cap->flags & CAP_STATE_OK) ? str_ok.len : str_not_synced.len);
 			if (!attr) goto error;
+
+			lock_get(cl->lock);
+			pkts = cap->sync_pkts;
+			bytes = cap->sync_bytes;
+			ends_pending = cap->sync_ends_pending;
+			if (cap->sync_start)
+				duration = (cap->sync_end ? cap->sync_end : get_uticks()) -
+					cap->sync_start;
+			else
+				duration = 0;
+			lock_release(cl->lock);
+
+			if (!duration)
+				continue;
+
+			val.s = int2str(ends_pending, &val.len);
+			attr = add_mi_attr(node_s, MI_DUP_VALUE,
+				MI_SSTR("Sync shards pending"), val.s, val.len);
+			if (!attr) goto error;
+
+			val.s = int2str(pkts, &val.len);
+			attr = add_mi_attr(node_s, MI_DUP_VALUE, MI_SSTR("Sync packets"),
+				val.s, val.len);
+			if (!attr) goto error;
+
+			val.s = int2str(bytes, &val.len);
+			attr = add_mi_attr(node_s, MI_DUP_VALUE, MI_SSTR("Sync bytes"),
+				val.s, val.len);
+			if (!attr) goto error;
+
+			val.s = int2str(duration / 1000, &val.len);
+			attr = add_mi_attr(node_s, MI_DUP_VALUE, MI_SSTR("Sync time (ms)"),
+				val.s, val.len);
+			if (!attr) goto error;
+
+			val.s = int2str((unsigned long long)bytes * 1000000 / duration,
+				&val.len);
+			attr = add_mi_attr(node_s, MI_DUP_VALUE,
+				MI_SSTR("Sync throughput (B/s)"), val.s, val.len);
+			if (!attr) goto error;
 	   }
 	}
 
@@ -895,6 +1001,32 @@ static int fixup_check_addr(void ** param, int param_no)
 	return E_UNSPEC;
 }
 
+static int fixup_shard_owner(void ** param, int param_no)
+{
+	if (param_no == 1)
+		return fixup_igp(param);
+	else if (param_no == 2)
+		return fixup_spve(param);
+	else if (param_no == 3)
+		return fixup_pvar(param);
+
+	LM_CRIT("Unknown parameter number %d\n", param_no);
+	return E_UNSPEC;
+}
+
+static int fixup_shard_forward(void ** param, int param_no)
+{
+	if (param_no == 1)
+		return fixup_igp(param);
+	else if (param_no == 2 || param_no == 3)
+		return fixup_spve(param);
+	else if (param_no == 4)
+		return fixup_pvar(param);
+
+	LM_CRIT("Unknown parameter number %d\n", param_no);
+	return E_UNSPEC;
+}
+
 static inline void generate_msg_tag(pv_value_t *tag_val, int cluster_id)
 {
 	static char gen_tag_buf[TAG_RAND_LEN+TAG_FIX_MAXLEN];
@@ -1088,6 +1220,105 @@ int cmd_check_addr(struct sip_msg *msg, char *param_cluster, char *param_ip)
 		return 1;
 }
 
+/* @return: owner node id, -1 on error (already logged) */
+static int get_shard_owner(struct sip_msg *msg, char *param_cluster,
+									char *param_key, int *cluster_id)
+{
+	str key;
+	int owner;
+
+	if (fixup_get_ivalue(msg, (gparam_p)param_cluster, cluster_id) < 0) {
+		LM_ERR("Failed to fetch cluster id parameter\n");
+		return -1;
+	}
+	if (fixup_get_svalue(msg, (gparam_p)param_key, &key) < 0) {
+		LM_ERR("Failed to fetch key parameter\n");
+		return -1;
+	}
+
+	owner = cl_get_shard_owner(*cluster_id, &key);
+	if (owner < 0) {
+		LM_ERR("No owner available for key <%.*s> in cluster: %d\n",
+			key.len, key.s, *cluster_id);
+		return -1;
+	}
+
+	if (owner == current_id)
+		update_stat(shard_local_keys, 1);
+	else
+		update_stat(shard_remote_keys, 1);
+
+	return owner;
+}
+
+int cmd_shard_owner(struct sip_msg *msg, char *param_cluster, char *param_key,
+								char *param_owner)
+{
+	int cluster_id, owner;
+	pv_value_t owner_val;
+
+	owner = get_shard_owner(msg, param_cluster, param_key, &cluster_id);
+	if (owner < 0)
+		return -2;
+
+	if (param_owner) {
+		memset(&owner_val, 0, sizeof owner_val);
+		owner_val.flags = PV_VAL_INT|PV_TYPE_INT;
+		owner_val.ri = owner;
+
+		if (pv_set_value(msg, (pv_spec_p)param_owner, 0, &owner_val) < 0) {
+			LM_ERR("Unable to set owner pvar\n");
+			return -2;
+		}
+	}
+
+	return owner == current_id ? 1 : -1;
+}
+
+int cmd_shard_forward(struct sip_msg *msg, char *param_cluster, char *param_key,
+								char *param_msg, char *param_tag)
+{
+	int cluster_id, owner;
+	str gen_msg;
+	pv_value_t tag_val;
+	int rc;
+
+	owner = get_shard_owner(msg, param_cluster, param_key, &cluster_id);
+	if (owner < 0)
+		return -3;
+
+	/* we own the key, nothing to relay */
+	if (owner == current_id)
+		return 2;
+
+	if (fixup_get_svalue(msg, (gparam_p)param_msg, &gen_msg) < 0) {
+		LM_ERR("Failed to fetch message parameter\n");
+		return -1;
+	}
+
+	/* generate tag */
+	generate_msg_tag(&tag_val, cluster_id);
+
+	if (param_tag && pv_set_value(msg, (pv_spec_p)param_tag, 0, &tag_val) < 0) {
+		LM_ERR("Unable to set tag pvar\n");
+		return -1;
+	}
+
+	rc = send_gen_msg(cluster_id, owner, &gen_msg, &tag_val.rs, 1);
+	switch (rc) {
+		case 0:
+			return 1;
+		case 1:
+			return -1;
+		case -1:
+			return -2;
+		case -2:
+			return -3;
+		default:
+			return -3;
+	}
+}
+
 static void destroy(void)
 {
 	if (db_hdl) {
@@ -1125,6 +1356,7 @@ int load_clusterer(struct clusterer_binds *binds)
 	binds->get_my_id = cl_get_my_id;
 	binds->get_my_sip_addr = cl_get_my_sip_addr;
 	binds->get_my_index = cl_get_my_index;
+	binds->get_shard_owner = cl_get_shard_owner;
 	binds->send_to = cl_send_to;
 	binds->send_all = cl_send_all;
 	binds->send_all_having = cl_send_all_having;
@@ -1134,6 +1366,7 @@ int load_clusterer(struct clusterer_binds *binds)
 	binds->request_sync = cl_request_sync;
 	binds->sync_chunk_start = cl_sync_chunk_start;
 	binds->sync_chunk_iter = cl_sync_chunk_iter;
+	binds->sync_in_shard = cl_sync_in_shard;
 
 	return 1;
 }
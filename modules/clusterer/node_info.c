@@ -31,6 +31,7 @@
 #include "../../rw_locking.h"
 #include "../../resolve.h"
 #include "../../socket_info.h"
+#include "../../hash_func.h"
 
 #include "api.h"
 #include "node_info.h"
@@ -871,3 +872,67 @@ int cl_get_my_index(int cluster_id, str *capability, int *nr_nodes)
 	(*nr_nodes)++;
 	return i;
 }
+
+/* murmur3 finalizer, spreads the key hash / node id combination */
+static inline unsigned int shard_score(unsigned int key_hash, int node_id)
+{
+	unsigned int h = key_hash ^ ((unsigned int)node_id * 0x9e3779b9);
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+
+	return h;
+}
+
+/*
+ * Rendezvous (highest random weight) hashing over the nodes currently
+ * reachable in the cluster, including ourselves if enabled. All the nodes
+ * with the same view of the topology pick the same owner for a key and,
+ * when a node joins or leaves, only the keys owned by that node move.
+ */
+int cl_get_shard_owner(int cluster_id, str *key)
+{
+	node_info_t *node;
+	cluster_info_t *cl;
+	unsigned int key_hash, score, best_score = 0;
+	int owner = -1;
+
+	key_hash = core_hash(key, NULL, 0);
+
+	lock_start_read(cl_list_lock);
+
+	cl = get_cluster_by_id(cluster_id);
+	if (!cl) {
+		LM_ERR("cluster id: %d not found!\n", cluster_id);
+		lock_stop_read(cl_list_lock);
+		return -1;
+	}
+
+	lock_get(cl->current_node->lock);
+	if (cl->current_node->flags & NODE_STATE_ENABLED) {
+		owner = current_id;
+		best_score = shard_score(key_hash, current_id);
+	}
+	lock_release(cl->current_node->lock);
+
+	for (node = cl->node_list; node; node = node->next)
+		if (get_next_hop(node) > 0) {
+			score = shard_score(key_hash, node->node_id);
+			if (owner < 0 || score > best_score ||
+				(score == best_score && node->node_id > owner)) {
+				owner = node->node_id;
+				best_score = score;
+			}
+		}
+
+	lock_stop_read(cl_list_lock);
+
+	if (owner < 0)
+		LM_DBG("no available node to own key <%.*s> in cluster: %d\n",
+			key->len, key->s, cluster_id);
+
+	return owner;
+}
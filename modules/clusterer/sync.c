@@ -25,12 +25,18 @@
 #include "sync.h"
 
 int sync_packet_size = DEFAULT_SYNC_PACKET_SIZE;
+int sync_shards = 1;
 int _sync_from_id = 0;
 
 static bin_packet_t *sync_packet_snd;
 static int sync_prev_buf_len;
 
-int send_sync_req(str *capability, int cluster_id, int source_id)
+/* the hash range requested by the node currently being synced */
+static int sync_shard_idx;
+static int sync_shard_cnt = 1;
+
+int send_sync_req(str *capability, int cluster_id, int source_id,
+					int shard, int shards)
 {
 	bin_packet_t packet;
 	int rc;
@@ -41,24 +47,34 @@ int send_sync_req(str *capability, int cluster_id, int source_id)
 	}
 
 	bin_push_str(&packet, capability);
+	/* a request for the whole data set is kept in the old format */
+	if (shards > 1) {
+		bin_push_int(&packet, shard);
+		bin_push_int(&packet, shards);
+	}
 	msg_add_trailer(&packet, cluster_id, source_id);
 
 	rc = clusterer_send_msg(&packet, cluster_id, source_id);
 	if (rc == CLUSTERER_SEND_SUCCES)
-		LM_DBG("Sync request sent for capability: %.*s to node: %d\n",
-			capability->len, capability->s, source_id);
+		LM_DBG("Sync request sent for capability: %.*s (shard %d/%d) to "
+			"node: %d\n", capability->len, capability->s, shard, shards,
+			source_id);
 
 	bin_free_packet(&packet);
 
 	return rc;
 }
 
-static int get_sync_source(cluster_info_t *cluster, str *capability)
+/* fill @ids with up to @max nodes which can be a source for syncing,
+ * returns the number of nodes found */
+static int get_sync_sources(cluster_info_t *cluster, str *capability,
+								int *ids, int max)
 {
 	node_info_t *node;
 	struct remote_cap *cap;
+	int n = 0;
 
-	for (node = cluster->node_list; node; node = node->next)
+	for (node = cluster->node_list; node && n < max; node = node->next)
 		if (get_next_hop(node) > 0) {
 			for (cap = node->capabilities; cap; cap = cap->next)
 				if (!str_strcmp(capability, &cap->name))
@@ -66,21 +82,20 @@ static int get_sync_source(cluster_info_t *cluster, str *capability)
 			/* if the node does have the capability and it's in the OK state
 			 * then it can be a source for syncing */
 			lock_get(node->lock);
-			if (cap && cap->flags & CAP_STATE_OK) {
-				lock_release(node->lock);
-				return node->node_id;
-			} else
-				lock_release(node->lock);
+			if (cap && cap->flags & CAP_STATE_OK)
+				ids[n++] = node->node_id;
+			lock_release(node->lock);
 		}
 
-	return 0;
+	return n;
 }
 
 int cl_request_sync(str *capability, int cluster_id)
 {
 	cluster_info_t *cluster;
 	struct local_cap *lcap;
-	int source_id;
+	int source_ids[MAX_SYNC_SHARDS];
+	int nr_sources, shard, i;
 	int rc;
 
 	LM_DBG("requesting %.*s sync in cluster %d\n",
@@ -122,26 +137,50 @@ int cl_request_sync(str *capability, int cluster_id)
 	} else
 		lock_release(cluster->lock);
 
-	source_id = get_sync_source(cluster, capability);
-	if (source_id == 0) {	/* we didn't find any node ready to sync from */
-		/* send requst later */
+	nr_sources = get_sync_sources(cluster, capability, source_ids, sync_shards);
+
+	lock_get(cluster->lock);
+	lcap->sync_start = get_uticks();
+	lcap->sync_end = 0;
+	lcap->sync_pkts = 0;
+	lcap->sync_bytes = 0;
+	/* one SYNC_END is expected for each shard, or a single one if the
+	 * request is sent later to a whole data set donor */
+	lcap->sync_ends_pending = nr_sources ? sync_shards : 1;
+	if (nr_sources == 0)	/* we didn't find any node ready to sync from */
+		lcap->flags |= CAP_SYNC_PENDING;	/* send requst later */
+	lock_release(cluster->lock);
+
+	/* spread the shards across the available donors */
+	for (shard = 0; shard < sync_shards && nr_sources; shard++) {
+		for (i = 0; i < nr_sources; i++) {
+			rc = send_sync_req(capability, cluster_id,
+				source_ids[(shard + i) % nr_sources], shard, sync_shards);
+			if (rc == CLUSTERER_SEND_SUCCES)
+				break;
+			if (rc == CLUSTERER_SEND_ERR)
+				return -1;
+		}
+		if (i < nr_sources)
+			continue;
+
+		/* all the donors got disabled or down in the meantime, so ask for the
+		 * whole data set later, in place of the shards still unrequested */
 		lock_get(cluster->lock);
+		lcap->sync_ends_pending -= sync_shards - shard - 1;
 		lcap->flags |= CAP_SYNC_PENDING;
 		lock_release(cluster->lock);
-	} else {
-		rc = send_sync_req(capability, cluster_id, source_id);
-		if (rc == CLUSTERER_DEST_DOWN || rc == CLUSTERER_CURR_DISABLED) {
-			/* node was up and ready but in the meantime got disabled or down */
-			lock_get(cluster->lock);
-			lcap->flags |= CAP_SYNC_PENDING;
-			lock_release(cluster->lock);
-		} else if (rc == CLUSTERER_SEND_ERR)
-			return -1;
+		break;
 	}
 
 	return 0;
 }
 
+int cl_sync_in_shard(unsigned int hash)
+{
+	return sync_shard_cnt <= 1 || hash % sync_shard_cnt == sync_shard_idx;
+}
+
 bin_packet_t *cl_sync_chunk_start(str *capability, int cluster_id, int dst_id)
 {
 	str bin_buffer;
@@ -226,7 +265,8 @@ int cl_sync_chunk_iter(bin_packet_t *packet)
 		return 0;
 }
 
-int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name)
+int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name,
+					int shard, int shards)
 {
 	bin_packet_t sync_end_pkt;
 	struct local_cap *cap;
@@ -241,8 +281,14 @@ int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name)
 		return -1;
 	}
 
+	sync_shard_idx = shard;
+	sync_shard_cnt = shards;
+
 	cap->reg.event_cb(SYNC_REQ_RCV, node_id);
 
+	sync_shard_idx = 0;
+	sync_shard_cnt = 1;
+
 	if (sync_packet_snd) {
 		/* send and free the previously built packet */
 		msg_add_trailer(sync_packet_snd, cluster->cluster_id, node_id);
@@ -271,8 +317,8 @@ int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name)
 
 	bin_free_packet(&sync_end_pkt);
 
-	LM_DBG("Sent all sync packets for capability: %.*s to node: %d\n",
-		cap_name->len, cap_name->s, node_id);
+	LM_DBG("Sent all sync packets for capability: %.*s (shard %d/%d) to "
+		"node: %d\n", cap_name->len, cap_name->s, shard, shards, node_id);
 
 	return 0;
 }
@@ -282,16 +328,30 @@ void handle_sync_request(bin_packet_t *packet, cluster_info_t *cluster,
 {
 	str cap_name;
 	struct remote_cap *cap;
-	int nhop;
+	bin_field_t f[3];
+	int shard = 0, shards = 1;
+	int nhop, n;
 
-	bin_pop_str(packet, &cap_name);
+	n = bin_pop_fields(packet, "sii", f);
+	if (n < 1) {
+		LM_ERR("Bad sync request from node: %d\n", source->node_id);
+		return;
+	}
+	cap_name = f[0].s;
 
-	LM_DBG("Received sync request for capability: %.*s from: %d\n", cap_name.len,
-		cap_name.s, source->node_id);
+	/* requests for the whole data set carry no shard info */
+	if (n == 3 && f[2].i > 1 && f[2].i <= MAX_SYNC_SHARDS &&
+		f[1].i >= 0 && f[1].i < f[2].i) {
+		shard = f[1].i;
+		shards = f[2].i;
+	}
+
+	LM_DBG("Received sync request for capability: %.*s (shard %d/%d) from: "
+		"%d\n", cap_name.len, cap_name.s, shard, shards, source->node_id);
 
 	nhop = get_next_hop(source);
 	if (nhop > 0) {
-		send_sync_repl(cluster, source->node_id, &cap_name);
+		send_sync_repl(cluster, source->node_id, &cap_name, shard, shards);
 	} else {
 		for (cap = source->capabilities; cap; cap = cap->next)
 			if (!str_strcmp(&cap_name, &cap->name))
@@ -303,11 +363,37 @@ void handle_sync_request(bin_packet_t *packet, cluster_info_t *cluster,
 		}
 		lock_get(source->lock);
 		/* reply to sync later when the node is up */
+		if (!(cap->flags & CAP_SYNC_PENDING) || cap->sync_shards != shards)
+			cap->sync_shard_mask = 0;
 		cap->flags |= CAP_SYNC_PENDING;
+		cap->sync_shards = shards;
+		cap->sync_shard_mask |= 1U << shard;
 		lock_release(source->lock);
 	}
 }
 
+void send_pending_sync_repl(cluster_info_t *cluster, node_info_t *node,
+								struct remote_cap *cap)
+{
+	unsigned int mask;
+	int shards, shard;
+
+	lock_get(node->lock);
+	if (!(cap->flags & CAP_SYNC_PENDING)) {
+		lock_release(node->lock);
+		return;
+	}
+	cap->flags &= ~CAP_SYNC_PENDING;
+	shards = cap->sync_shards;
+	mask = cap->sync_shard_mask;
+	lock_release(node->lock);
+
+	/* reply now that the node is up */
+	for (shard = 0; shard < shards; shard++)
+		if (mask & (1U << shard))
+			send_sync_repl(cluster, node->node_id, &cap->name, shard, shards);
+}
+
 void handle_sync_packet(bin_packet_t *packet, int packet_type,
 								cluster_info_t *cluster, int source_id)
 {
@@ -315,6 +401,7 @@ void handle_sync_packet(bin_packet_t *packet, int packet_type,
 	struct local_cap *cap;
 	struct buf_bin_pkt *buf_pkt, *buf_tmp, *cutpos_next;
 	bin_packet_t *bin_pkt_list, *bin_pkt, *bin_tmp;
+	str bin_buffer;
 
 	bin_pop_str(packet, &cap_name);
 	for (cap = cluster->capabilities; cap; cap = cap->next)
@@ -327,9 +414,13 @@ void handle_sync_packet(bin_packet_t *packet, int packet_type,
 	}
 
 	if (packet_type == CLUSTERER_SYNC) {
+		bin_get_buffer(packet, &bin_buffer);
+
 		lock_get(cluster->lock);
 		/* buffer other types of packets during sync */
 		cap->flags |= CAP_PKT_BUFFERING;
+		cap->sync_pkts++;
+		cap->sync_bytes += bin_buffer.len;
 		lock_release(cluster->lock);
 
 		/* overwrite packet type with one identifiable by modules */
@@ -338,11 +429,23 @@ void handle_sync_packet(bin_packet_t *packet, int packet_type,
 
 		cap->reg.packet_cb(packet);
 	} else { /* CLUSTERER_SYNC_END */
+		lock_get(cluster->lock);
+
+		/* wait for the rest of the shards */
+		if (cap->sync_ends_pending > 1) {
+			cap->sync_ends_pending--;
+			lock_release(cluster->lock);
+
+			LM_DBG("Received a sync shard for capability: %.*s from node: "
+				"%d\n", cap_name.len, cap_name.s, source_id);
+			return;
+		}
+		cap->sync_ends_pending = 0;
+		cap->sync_end = get_uticks();
+
 		LM_DBG("Received all sync packets for capability: %.*s\n", cap_name.len,
 			cap_name.s);
 
-		lock_get(cluster->lock);
-
 		/* post-sync phase */
 		while (cap->pkt_q_front) {
 			/* delimit list of buffered packets to deliver for processing */
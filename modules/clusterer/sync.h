@@ -24,12 +24,16 @@
 
 #define DEFAULT_SYNC_PACKET_SIZE 32768
 #define SYNC_CHUNK_START_MARKER 101010101
+/* the pending shards of a sync reply are kept as a bitmask */
+#define MAX_SYNC_SHARDS 32
 
 extern int sync_packet_size;
+extern int sync_shards;
 
 int cl_request_sync(str *capability, int cluster_id);
 bin_packet_t *cl_sync_chunk_start(str *capability, int cluster_id, int dst_id);
 int cl_sync_chunk_iter(bin_packet_t *packet);
+int cl_sync_in_shard(unsigned int hash);
 
 void handle_sync_request(bin_packet_t *packet, cluster_info_t *cluster,
 							node_info_t *source);
@@ -37,8 +41,12 @@ void handle_sync_packet(bin_packet_t *packet, int packet_type,
 								cluster_info_t *cluster, int source_id);
 
 int buffer_bin_pkt(bin_packet_t *packet, struct local_cap *cap, int src_id);
-int send_sync_req(str *capability, int cluster_id, int source_id);
-int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name);
+int send_sync_req(str *capability, int cluster_id, int source_id,
+					int shard, int shards);
+int send_sync_repl(cluster_info_t *cluster, int node_id, str *cap_name,
+					int shard, int shards);
+void send_pending_sync_repl(cluster_info_t *cluster, node_info_t *node,
+								struct remote_cap *cap);
 
 #endif  /* CLUSTERER_SYNC_H */
 
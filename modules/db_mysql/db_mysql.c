@@ -45,6 +45,10 @@ unsigned int db_mysql_exec_query_threshold = 0;   /* Warning in case DB query
 											takes too long disabled by default*/
 int max_db_retries = 3;
 int max_db_queries = 2;
+int ps_cache_size = 0;   /* statement cache disabled by default */
+
+stat_var *ps_cache_hits;
+stat_var *ps_cache_misses;
 
 static int mysql_mod_init(void);
 
@@ -70,11 +74,19 @@ static param_export_t params[] = {
 	{"exec_query_threshold", INT_PARAM, &db_mysql_exec_query_threshold},
 	{"max_db_retries", INT_PARAM, &max_db_retries},
 	{"max_db_queries", INT_PARAM, &max_db_queries},
+	{"ps_cache_size", INT_PARAM, &ps_cache_size},
 	{"tls_client_domain", STR_PARAM, &tls_client_domain.s},
 	{0, 0, 0}
 };
 
 
+static stat_export_t mod_stats[] = {
+	{"ps_cache_hits",   0, &ps_cache_hits  },
+	{"ps_cache_misses", 0, &ps_cache_misses},
+	{0, 0, 0}
+};
+
+
 struct module_exports exports = {
 	"db_mysql",
 	MOD_TYPE_SQLDB,  /* class of this module */
@@ -84,7 +96,7 @@ struct module_exports exports = {
 	cmds,
 	0,               /* exported async functions */
 	params,          /* module parameters */
-	0,               /* exported statistics */
+	mod_stats,       /* exported statistics */
 	0,               /* exported MI functions */
 	0,               /* exported pseudo-variables */
 	0,				 /* exported transformations */
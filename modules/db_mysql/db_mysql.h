@@ -29,10 +29,16 @@
 #ifndef DB_MOD_H
 #define DB_MOD_H
 
+#include "../../statistics.h"
+
 extern unsigned int db_mysql_timeout_interval;
 extern unsigned int db_mysql_exec_query_threshold;
 extern int max_db_retries;
 extern int max_db_queries;
+extern int ps_cache_size;
+
+extern stat_var *ps_cache_hits;
+extern stat_var *ps_cache_misses;
 
 int mysql_register_event(void);
 
@@ -41,6 +41,7 @@
 #include "../../db/db_async.h"
 #include "../../db/db_ut.h"
 #include "../../db/db_insertq.h"
+#include "../../db/db_ps_cache.h"
 #include "val.h"
 #include "my_con.h"
 #include "res.h"
@@ -346,6 +347,44 @@ static void db_mysql_free_pq(struct prep_stmt *pq_ptr)
 }
 
 
+/*
+ *	Release a statement evicted from the connection's statement cache
+ */
+static void db_mysql_free_cached_ps(const db_con_t *_h, db_ps_t ps)
+{
+	struct prep_stmt **pq_ptr;
+
+	for (pq_ptr = &CON_PS_LIST(_h); *pq_ptr; pq_ptr = &(*pq_ptr)->next)
+		if (*pq_ptr == ps) {
+			*pq_ptr = (*pq_ptr)->next;
+			db_mysql_free_pq((struct prep_stmt *)ps);
+			return;
+		}
+
+	LM_BUG("cached statement %p not found on connection %p\n",
+		ps, (void *)_h->tail);
+}
+
+/*
+ *	For the writes run without a prepared statement of their own, pick
+ *	one from the connection's statement cache, if enabled. Never for the
+ *	queries: their results point into the buffers of the statement, which
+ *	the next query of the same shape (or an eviction) would overwrite
+ */
+#define db_mysql_cache_ps(_h, _args...) \
+	do { \
+		if (!CON_HAS_PS(_h) && (_h)->ps_cache) \
+			switch (db_ps_cache_set(_h, ##_args)) { \
+			case 1: \
+				update_stat(ps_cache_hits, 1); \
+				break; \
+			case 0: \
+				update_stat(ps_cache_misses, 1); \
+				break; \
+			} \
+	} while (0)
+
+
 /*
 **	Free all allocated prep_stmt structures
  */
@@ -824,7 +863,14 @@ static int db_mysql_submit_dummy_query(const db_con_t* _h, const str* _s)
  */
 db_con_t* db_mysql_init(const str* _url)
 {
-	return db_do_init(_url, (void *)db_mysql_new_connection);
+	db_con_t *_h;
+
+	_h = db_do_init(_url, (void *)db_mysql_new_connection);
+	if (_h && ps_cache_size > 0 &&
+	        db_ps_cache_init(_h, ps_cache_size, db_mysql_free_cached_ps) < 0)
+		LM_WARN("failed to enable the statement cache for this connection\n");
+
+	return _h;
 }
 
 
@@ -1270,6 +1316,9 @@ int db_mysql_insert(const db_con_t* _h, const db_key_t* _k, const db_val_t* _v,
 {
 	int ret;
 
+	if (!CON_HAS_INSLIST(_h))
+		db_mysql_cache_ps(_h, DB_PS_INSERT, _k, NULL, _v, _n, NULL, NULL, 0);
+
 	if (CON_HAS_PS(_h)) {
 		if (CON_HAS_UNINIT_PS(_h)||!has_stmt_ctx(_h,&(CON_MYSQL_PS(_h)->ctx))){
 			ret = db_do_insert(_h, _k, _v, _n, db_mysql_val2str,
@@ -1307,6 +1356,8 @@ int db_mysql_delete(const db_con_t* _h, const db_key_t* _k, const db_op_t* _o,
 {
 	int ret;
 
+	db_mysql_cache_ps(_h, DB_PS_DELETE, _k, _o, _v, _n, NULL, NULL, 0);
+
 	if (CON_HAS_PS(_h)) {
 		if (CON_HAS_UNINIT_PS(_h)||!has_stmt_ctx(_h,&(CON_MYSQL_PS(_h)->ctx))){
 			ret = db_do_delete(_h, _k, _o, _v, _n, db_mysql_val2str,
@@ -1340,6 +1391,8 @@ int db_mysql_update(const db_con_t* _h, const db_key_t* _k, const db_op_t* _o,
 {
 	int ret;
 
+	db_mysql_cache_ps(_h, DB_PS_UPDATE, _k, _o, _v, _n, _uk, _uv, _un);
+
 	if (CON_HAS_PS(_h)) {
 		if (CON_HAS_UNINIT_PS(_h)||!has_stmt_ctx(_h,&(CON_MYSQL_PS(_h)->ctx))){
 			ret = db_do_update(_h, _k, _o, _v, _uk, _uv, _n, _un,
@@ -1367,6 +1420,8 @@ int db_mysql_replace(const db_con_t* _h, const db_key_t* _k, const db_val_t* _v,
 {
 	int ret;
 
+	db_mysql_cache_ps(_h, DB_PS_REPLACE, _k, NULL, _v, _n, NULL, NULL, 0);
+
 	if (CON_HAS_PS(_h)) {
 		if (CON_HAS_UNINIT_PS(_h)||!has_stmt_ctx(_h,&(CON_MYSQL_PS(_h)->ctx))){
 			ret = db_do_replace(_h, _k, _v, _n, db_mysql_val2str,
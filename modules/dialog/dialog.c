@@ -120,6 +120,7 @@ str cdb_url = {0,0};
 /* dialog replication using clusterer */
 int dialog_repl_cluster = 0;
 int profile_repl_cluster = 0;
+int dialog_repl_delta = 0;
 str dlg_repl_cap = str_init("dialog-dlg-repl");
 str prof_repl_cap = str_init("dialog-prof-repl");
 
@@ -278,6 +279,7 @@ static param_export_t mod_params[]={
 	/* dialog replication through clusterer using TCP binary packets */
 	{ "dialog_replication_cluster",     INT_PARAM, &dialog_repl_cluster  },
 	{ "profile_replication_cluster",	INT_PARAM, &profile_repl_cluster },
+	{ "dialog_replication_delta",       INT_PARAM, &dialog_repl_delta    },
 	{ "replicate_profiles_timer", INT_PARAM, &repl_prof_utimer      },
 	{ "replicate_profiles_check", INT_PARAM, &repl_prof_timer_check },
 	{ "replicate_profiles_buffer",INT_PARAM, &repl_prof_buffer_th   },
@@ -78,6 +78,10 @@
 #define DLG_FLAG_REINVITE_PING_ENGAGED_REQ	(1<<13)
 #define DLG_FLAG_REINVITE_PING_ENGAGED_REPL	(1<<14)
 
+/* parts of the dialog changed since the last replicated update */
+#define DLG_REPL_VARS			(1<<0)
+#define DLG_REPL_PROFILES		(1<<1)
+
 #define DLG_CALLER_LEG         0
 #define DLG_FIRST_CALLEE_LEG   1
 
@@ -143,6 +147,8 @@ struct dlg_cell
 	unsigned int         initial_t_hash_index;
 	unsigned int         initial_t_label;
 	unsigned int         replicated; /* indicates if the dialog is replicated */
+	unsigned int         repl_seq;   /* number of the last replicated update */
+	unsigned int         repl_dirty; /* DLG_REPL_* parts changed since then */
 	struct dlg_tl        tl;
 	struct dlg_ping_list *pl;
 	struct dlg_ping_list *reinvite_pl;
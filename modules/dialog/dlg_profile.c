@@ -505,7 +505,7 @@ static struct dlg_profile_table* new_dlg_profile( str *name, unsigned int size,
 
 		for( i= 0; i < size; i++)
 		{
-			profile->entries[i] = map_create(AVLMAP_SHARED);
+			profile->entries[i] = map_create(AVLMAP_SHARED | MAP_HASHED);
 			if( !profile->entries[i] )
 			{
 				LM_ERR("Unable to create a map\n");
@@ -603,11 +603,14 @@ void destroy_linkers(struct dlg_profile_link *linker, char is_replicated)
 						/* XXX: we should queue these */
 						repl_prof_remove(&l->profile->name, &l->value);
 						map_remove(entry,l->value );
+						__sync_fetch_and_sub(&l->profile->values_no, 1);
 					}
 				}
 			}
-			else
+			else {
 				l->profile->counts[l->hash_idx]--;
+				__sync_fetch_and_sub(&l->profile->noval_count, 1);
+			}
 
 			lock_set_release( l->profile->locks, l->hash_idx  );
 		} else if (!is_replicated) {
@@ -705,13 +708,19 @@ static void link_dlg_profile(struct dlg_profile_link *linker,
 		if( linker->profile->has_value)
 		{
 			p_entry = linker->profile->entries[hash];
-			dest = map_get( p_entry, linker->value );
+			if ( (dest = map_find( p_entry, linker->value ))==NULL ) {
+				dest = map_get( p_entry, linker->value );
+				if (dest)
+					__sync_fetch_and_add(&linker->profile->values_no, 1);
+			}
 			/* if we accept replicated stuff, we have to allocate the
 			 * structure for it and treat the counter differently */
 			repl_prof_inc(dest);
 		}
-		else
+		else {
 			linker->profile->counts[hash]++;
+			__sync_fetch_and_add(&linker->profile->noval_count, 1);
+		}
 
 		lock_set_release( linker->profile->locks,hash );
 	} else if (!is_replicated) {
@@ -788,6 +797,7 @@ int set_dlg_profile(struct dlg_cell *dlg, str *value,
 	/* add linker to the dialog and profile */
 	link_dlg_profile( linker, dlg, is_replicated);
 	dlg->flags |= DLG_FLAG_VP_CHANGED;
+	dlg->repl_dirty |= DLG_REPL_PROFILES;
 
 	return 0;
 }
@@ -840,6 +850,7 @@ found:
 	}
 	linker->next = NULL;
 	dlg->flags |= DLG_FLAG_VP_CHANGED;
+	dlg->repl_dirty |= DLG_REPL_PROFILES;
 	if (dlg->locked_by!=process_no)
 		dlg_unlock( d_table, d_entry);
 	/* remove linker from profile table and free it */
@@ -906,16 +917,7 @@ unsigned int get_profile_size(struct dlg_profile_table *profile, str *value)
 
 		} else {
 
-			for( i=0; i<profile->size; i++ )
-			{
-
-				lock_set_get( profile->locks, i);
-
-				n += profile->counts[i];
-
-				lock_set_release( profile->locks, i);
-
-			}
+			n = profile->noval_count;
 
 		}
 		n += replicate_profiles_count(profile->repl);
@@ -938,16 +940,8 @@ unsigned int get_profile_size(struct dlg_profile_table *profile, str *value)
 
 			} else {
 
-				for( i=0; i<profile->size; i++ )
-				{
-
-					lock_set_get( profile->locks, i);
-
-					n += map_size(profile->entries[i]);
+				n = profile->values_no;
 
-					lock_set_release( profile->locks, i);
-
-				}
 			}
 
 
@@ -1182,14 +1176,7 @@ struct mi_root * mi_get_profile_values(struct mi_root *cmd_tree, void *param )
 	}
 	else
 	{
-		n = 0;
-
-		for( i=0; i<profile->size; i++ )
-		{
-			lock_set_get( profile->locks, i);
-			n += profile->counts[i];
-			lock_set_release( profile->locks, i);
-		}
+		n = profile->noval_count;
 
 		if (profile->repl_type != REPL_CACHEDB)
 			n += replicate_profiles_count(profile->repl);
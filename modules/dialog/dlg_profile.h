@@ -76,6 +76,13 @@ struct dlg_profile_table {
 
 	int * counts;
 
+	/*
+	 * aggregated counters, read without locking: the local dialogs of
+	 * a profile without values and the values of a profile with values
+	 */
+	volatile int noval_count;
+	volatile int values_no;
+
 	/*
 	 * information used for profile replication without values
 	 */
@@ -44,6 +44,10 @@ typedef struct repl_prof_count {
 typedef struct repl_prof_novalue {
 	gen_lock_t lock;
 	struct repl_prof_count *dsts;
+	/* sum of the counters, valid (and readable without the lock) as long
+	 * as the oldest non-zero counter has not expired */
+	volatile int total;
+	volatile time_t oldest;
 } repl_prof_novalue_t;
 
 typedef struct repl_prof_value {
@@ -206,6 +206,8 @@ int dlg_replicated_create(bin_packet_t *packet, struct dlg_cell *cell, str *ftag
 	DLG_BIN_POP(int, packet, dlg->tl.timeout, pre_linking_error);
 	DLG_BIN_POP(int, packet, dlg->legs[DLG_CALLER_LEG].last_gen_cseq, pre_linking_error);
 	DLG_BIN_POP(int, packet, dlg->legs[callee_idx(dlg)].last_gen_cseq, pre_linking_error);
+	if (dialog_repl_delta)
+		DLG_BIN_POP(int, packet, dlg->repl_seq, pre_linking_error);
 
 	if (dlg->tl.timeout <= (unsigned int) time(0))
 		dlg->tl.timeout = 0;
@@ -347,6 +349,8 @@ int dlg_replicated_update(bin_packet_t *packet)
 
 	bin_pop_int(packet, &timeout);
 	bin_skip_int(packet, 2);
+	if (dialog_repl_delta)
+		bin_pop_int(packet, &dlg->repl_seq);
 
 	timeout -= time(0);
 	LM_DBG("Received updated timeout of %d for dialog %.*s\n",
@@ -384,6 +388,198 @@ error:
 	return -1;
 }
 
+static int request_dlg_resync(int node_id, str *call_id, str *from_tag,
+																str *to_tag)
+{
+	bin_packet_t packet;
+	int rc;
+
+	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_RESYNC, BIN_VERSION,
+		1024) != 0) {
+		LM_ERR("Failed to init bin packet\n");
+		return -1;
+	}
+
+	bin_push_str(&packet, call_id);
+	bin_push_str(&packet, from_tag);
+	bin_push_str(&packet, to_tag);
+
+	rc = clusterer_api.send_to(&packet, dialog_repl_cluster, node_id);
+	bin_free_packet(&packet);
+
+	if (rc != CLUSTERER_SEND_SUCCES) {
+		LM_ERR("Failed to request a full update from node %d\n", node_id);
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * applies a remote delta update (only the parts which may change during the
+ * lifetime of a dialog) of an ongoing dialog; if the dialog is unknown or
+ * some updates were missed, a full update is requested from the sender
+ */
+int dlg_replicated_update_delta(bin_packet_t *packet)
+{
+	struct dlg_cell *dlg;
+	str call_id, from_tag, to_tag, cseq1, cseq2;
+	str vars = {NULL, 0}, profiles = {NULL, 0};
+	unsigned int dir, dst_leg, seq, dirty;
+	unsigned int state, user_flags, mod_flags, flags;
+	int timeout, gap;
+	struct dlg_entry *d_entry;
+
+	DLG_BIN_POP(str, packet, call_id, malformed);
+	DLG_BIN_POP(str, packet, from_tag, malformed);
+	DLG_BIN_POP(str, packet, to_tag, malformed);
+	DLG_BIN_POP(int, packet, seq, malformed);
+	DLG_BIN_POP(int, packet, dirty, malformed);
+	DLG_BIN_POP(int, packet, state, malformed);
+	DLG_BIN_POP(str, packet, cseq1, malformed);
+	DLG_BIN_POP(str, packet, cseq2, malformed);
+	DLG_BIN_POP(int, packet, user_flags, malformed);
+	DLG_BIN_POP(int, packet, mod_flags, malformed);
+	DLG_BIN_POP(int, packet, flags, malformed);
+	DLG_BIN_POP(int, packet, timeout, malformed);
+	if (dirty & DLG_REPL_VARS)
+		DLG_BIN_POP(str, packet, vars, malformed);
+	if (dirty & DLG_REPL_PROFILES)
+		DLG_BIN_POP(str, packet, profiles, malformed);
+
+	LM_DBG("replicated delta update #%u for ['%.*s' '%.*s' '%.*s']\n", seq,
+		call_id.len, call_id.s, from_tag.len, from_tag.s, to_tag.len, to_tag.s);
+
+	dlg = get_dlg(&call_id, &from_tag, &to_tag, &dir, &dst_leg);
+	if (!dlg) {
+		LM_DBG("dialog not found, requesting full update\n");
+		return request_dlg_resync(packet->src_id, &call_id, &from_tag, &to_tag);
+	}
+
+	d_entry = &d_table->entries[dlg->h_entry];
+
+	dlg_lock(d_table, d_entry);
+
+	/* 0 - no full update received yet, take this one as reference */
+	gap = dlg->repl_seq && seq != dlg->repl_seq + 1;
+	dlg->repl_seq = seq;
+
+	dlg->state = state;
+
+	if (dlg_update_cseq(dlg, DLG_CALLER_LEG, &cseq1, 0) != 0) {
+		LM_ERR("failed to update caller cseq\n");
+		goto error;
+	}
+
+	if (dlg_update_cseq(dlg, callee_idx(dlg), &cseq2, 0) != 0) {
+		LM_ERR("failed to update callee cseq\n");
+		goto error;
+	}
+
+	dlg->user_flags = user_flags;
+	dlg->mod_flags = mod_flags;
+	dlg->flags = flags;
+
+	timeout -= time(0);
+	if (dlg->lifetime != timeout) {
+		dlg->lifetime = timeout;
+		switch (update_dlg_timer(&dlg->tl, dlg->lifetime) ) {
+		case -1:
+			LM_ERR("failed to update dialog lifetime!\n");
+			/* continue */
+		case 0:
+			/* timeout value was updated */
+			break;
+		case 1:
+			/* dlg inserted in timer list with new expire (reference it)*/
+			ref_dlg(dlg,1);
+		}
+	}
+
+	unref_dlg_unsafe(dlg, 1, d_entry);
+
+	if (vars.s && vars.len != 0)
+		read_dialog_vars(vars.s, vars.len, dlg);
+
+	dlg_unlock(d_table, d_entry);
+
+	if (profiles.s && profiles.len != 0)
+		read_dialog_profiles(profiles.s, profiles.len, dlg, 1, 1);
+
+	if (gap) {
+		LM_DBG("missed updates for dialog %.*s, requesting full update\n",
+			call_id.len, call_id.s);
+		return request_dlg_resync(packet->src_id, &call_id, &from_tag, &to_tag);
+	}
+
+	return 0;
+
+error:
+	unref_dlg_unsafe(dlg, 1, d_entry);
+	dlg_unlock(d_table, d_entry);
+	return -1;
+malformed:
+	return -1;
+}
+
+/**
+ * sends back a full update of a dialog, to a node which missed some of the
+ * delta updates
+ */
+int dlg_replicated_resync(bin_packet_t *packet)
+{
+	str call_id, from_tag, to_tag;
+	unsigned int dir, dst_leg;
+	struct dlg_cell *dlg;
+	bin_packet_t full;
+	int rc;
+
+	DLG_BIN_POP(str, packet, call_id, malformed);
+	DLG_BIN_POP(str, packet, from_tag, malformed);
+	DLG_BIN_POP(str, packet, to_tag, malformed);
+
+	dlg = get_dlg(&call_id, &from_tag, &to_tag, &dir, &dst_leg);
+	if (!dlg) {
+		/* may be already deleted - the delete was replicated as well */
+		LM_DBG("dialog not found (callid: |%.*s| ftag: |%.*s|\n",
+			call_id.len, call_id.s, from_tag.len, from_tag.s);
+		return 0;
+	}
+
+	dlg_lock_dlg(dlg);
+
+	if (dlg->state == DLG_STATE_DELETED) {
+		dlg_unlock_dlg(dlg);
+		unref_dlg(dlg, 1);
+		return 0;
+	}
+
+	if (bin_init(&full, &dlg_repl_cap, REPLICATION_DLG_UPDATED, BIN_VERSION, 0) != 0) {
+		dlg_unlock_dlg(dlg);
+		unref_dlg(dlg, 1);
+		LM_ERR("Failed to init bin packet\n");
+		return -1;
+	}
+
+	bin_push_dlg(&full, dlg);
+
+	dlg_unlock_dlg(dlg);
+	unref_dlg(dlg, 1);
+
+	rc = clusterer_api.send_to(&full, dialog_repl_cluster, packet->src_id);
+	bin_free_packet(&full);
+
+	if (rc != CLUSTERER_SEND_SUCCES) {
+		LM_ERR("Failed to send full dialog update to node %d\n", packet->src_id);
+		return -1;
+	}
+
+	if_update_stat(dlg_enable_stats, update_sent, 1);
+	return 0;
+malformed:
+	return -1;
+}
+
 /**
  * replicates the remote deletion of a dialog locally
  * by reading the relevant information using the Binary Packet Interface
@@ -503,6 +699,42 @@ void bin_push_dlg(bin_packet_t *packet, struct dlg_cell *dlg)
 	bin_push_int(packet, (unsigned int)time(0) + dlg->tl.timeout - get_ticks());
 	bin_push_int(packet, dlg->legs[DLG_CALLER_LEG].last_gen_cseq);
 	bin_push_int(packet, dlg->legs[callee_leg].last_gen_cseq);
+	if (dialog_repl_delta)
+		bin_push_int(packet, dlg->repl_seq);
+}
+
+/* only the parts which may change after the dialog was created */
+void bin_push_dlg_delta(bin_packet_t *packet, struct dlg_cell *dlg)
+{
+	int callee_leg;
+	str *vars, *profiles;
+
+	callee_leg = callee_idx(dlg);
+
+	bin_push_str(packet, &dlg->callid);
+	bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].tag);
+	bin_push_str(packet, &dlg->legs[callee_leg].tag);
+
+	bin_push_int(packet, dlg->repl_seq);
+	bin_push_int(packet, dlg->repl_dirty);
+
+	bin_push_int(packet, dlg->state);
+	bin_push_str(packet, &dlg->legs[DLG_CALLER_LEG].r_cseq);
+	bin_push_str(packet, &dlg->legs[callee_leg].r_cseq);
+	bin_push_int(packet, dlg->user_flags);
+	bin_push_int(packet, dlg->mod_flags);
+	bin_push_int(packet, dlg->flags &
+			     ~(DLG_FLAG_NEW|DLG_FLAG_CHANGED|DLG_FLAG_VP_CHANGED));
+	bin_push_int(packet, (unsigned int)time(0) + dlg->tl.timeout - get_ticks());
+
+	if (dlg->repl_dirty & DLG_REPL_VARS) {
+		vars = write_dialog_vars(dlg->vals);
+		bin_push_str(packet, vars);
+	}
+	if (dlg->repl_dirty & DLG_REPL_PROFILES) {
+		profiles = write_dialog_profiles(dlg->profile_links);
+		bin_push_str(packet, profiles);
+	}
 }
 
 /*  Binary Packet sending functions   */
@@ -536,7 +768,9 @@ void replicate_dialog_created(struct dlg_cell *dlg)
 	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_CREATED, BIN_VERSION, 0) != 0)
 		goto init_error;
 
+	dlg->repl_seq++;
 	bin_push_dlg(&packet, dlg);
+	dlg->repl_dirty = 0;
 
 	dlg->replicated = 1;
 
@@ -590,11 +824,23 @@ void replicate_dialog_updated(struct dlg_cell *dlg)
 		goto end;
 	}
 
-	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_UPDATED, BIN_VERSION, 0) != 0)
-		goto init_error;
+	dlg->repl_seq++;
 
-	bin_push_dlg(&packet, dlg);
+	if (dialog_repl_delta && dlg->replicated) {
+		if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_UPDATED_DELTA,
+			BIN_VERSION, 0) != 0)
+			goto init_error;
+
+		bin_push_dlg_delta(&packet, dlg);
+	} else {
+		if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_UPDATED,
+			BIN_VERSION, 0) != 0)
+			goto init_error;
 
+		bin_push_dlg(&packet, dlg);
+	}
+
+	dlg->repl_dirty = 0;
 	dlg->replicated = 1;
 
 	dlg_unlock_dlg(dlg);
@@ -790,6 +1036,13 @@ void receive_dlg_repl(bin_packet_t *packet)
 			rc = dlg_replicated_update(pkt);
 			if_update_stat(dlg_enable_stats, update_recv, 1);
 			break;
+		case REPLICATION_DLG_UPDATED_DELTA:
+			rc = dlg_replicated_update_delta(pkt);
+			if_update_stat(dlg_enable_stats, update_recv, 1);
+			break;
+		case REPLICATION_DLG_RESYNC:
+			rc = dlg_replicated_resync(pkt);
+			break;
 		case REPLICATION_DLG_DELETED:
 			rc = dlg_replicated_delete(pkt);
 			if_update_stat(dlg_enable_stats, delete_recv, 1);
@@ -825,6 +1078,12 @@ static int receive_sync_request(int node_id)
 	for (i = 0; i < d_table->size; i++) {
 		dlg_lock(d_table, &(d_table->entries[i]));
 		for (dlg = d_table->entries[i].first; dlg; dlg = dlg->next) {
+			/* the table index depends on the hash_size of each node,
+			 * so shard by the Call-ID, which all the nodes agree on */
+			if (!clusterer_api.sync_in_shard(
+				core_hash(&dlg->callid, NULL, 0)))
+				continue;
+
 			sync_packet = clusterer_api.sync_chunk_start(&dlg_repl_cap,
 												dialog_repl_cluster, node_id);
 			if (!sync_packet)
@@ -1010,6 +1269,16 @@ error:
 	LM_ERR("Failed to replicate dialog profile\n");
 }
 
+/* must be called with the lock of the profile counters held */
+static inline void set_destination_counter(repl_prof_novalue_t *noval,
+		repl_prof_count_t *dst, int counter, time_t now)
+{
+	noval->total += counter - dst->counter;
+	dst->counter = counter;
+	dst->update = now;
+}
+
+
 static repl_prof_count_t* find_destination(repl_prof_novalue_t *noval, int machine_id)
 {
 	repl_prof_count_t *head;
@@ -1028,6 +1297,8 @@ static repl_prof_count_t* find_destination(repl_prof_novalue_t *noval, int machi
 			goto error;
 		}
 		head->machine_id = machine_id;
+		head->counter = 0;
+		head->update = 0;
 		head->next = noval->dsts;
 		noval->dsts = head;
 	}
@@ -1113,8 +1384,7 @@ void receive_prof_repl(bin_packet_t *packet)
 					lock_release(&profile->repl->lock);
 					return;
 				}
-				destination->counter = counter;
-				destination->update = now;
+				set_destination_counter(profile->repl, destination, counter, now);
 				lock_release(&profile->repl->lock);
 			} else {
 				/* XXX: hack to make sure we find the proper index */
@@ -1125,8 +1395,10 @@ void receive_prof_repl(bin_packet_t *packet)
 					dst = map_find(profile->entries[i], value);
 					if (!dst)
 						goto release;
-				} else {
+				} else if (!(dst = map_find(profile->entries[i], value))) {
 					dst = map_get(profile->entries[i], value);
+					if (dst)
+						__sync_fetch_and_add(&profile->values_no, 1);
 				}
 				if (!*dst) {
 					rp = shm_malloc(sizeof(repl_prof_value_t));
@@ -1142,15 +1414,14 @@ void receive_prof_repl(bin_packet_t *packet)
 				if (!rp->noval)
 					rp->noval = repl_prof_allocate();
 				if (rp->noval) {
-					lock_release(&rp->noval->lock);
+					lock_get(&rp->noval->lock);
 					destination = find_destination(rp->noval, packet->src_id);
 					if (destination == NULL) {
 						lock_release(&rp->noval->lock);
 						lock_set_release(profile->locks, i);
 						return;
 					}
-					destination->counter = counter;
-					destination ->update = now;
+					set_destination_counter(rp->noval, destination, counter, now);
 					lock_release(&rp->noval->lock);
 				}
 release:
@@ -1204,18 +1475,26 @@ int repl_prof_remove(str *name, str *value)
 int replicate_profiles_count(repl_prof_novalue_t *rp)
 {
 	int counter = 0;
-	time_t now = time(0);
+	time_t now = time(0), oldest = now;
 	repl_prof_count_t *head;
 
+	/* no counter expired since the last check - the sum is still good */
+	if (rp->oldest + repl_prof_timer_expire >= now)
+		return rp->total;
+
 	lock_get(&rp->lock);
 	head = rp->dsts;
 	while (head != NULL) {
 		/* if the replication expired, reset its counter */
 		if ((head->update + repl_prof_timer_expire) < now)
 			head->counter = 0;
+		else if (head->counter && head->update < oldest)
+			oldest = head->update;
 		counter += head->counter;
 		head = head->next;
 	}
+	rp->total = counter;
+	rp->oldest = oldest;
 	lock_release(&rp->lock);
 	return counter;
 }
@@ -1250,6 +1529,7 @@ static void clean_profiles(unsigned int ticks, void *param)
 					if (iterator_next(&it) < 0)
 						LM_DBG("cannot find next iterator\n");
 					rp = (repl_prof_value_t *) iterator_delete(&del);
+					__sync_fetch_and_sub(&profile->values_no, 1);
 					if (rp) {
 						free_profile_val_t(rp);
 						/*if (rp->noval)
@@ -1303,11 +1583,7 @@ static void broadcast_profiles(utime_t ticks, void *param)
 
 		count = 0;
 		if (!profile->has_value) {
-			for (i = 0; i < profile->size; i++) {
-				lock_set_get(profile->locks, i);
-				count += profile->counts[i];
-				lock_set_release(profile->locks, i);
-			}
+			count = profile->noval_count;
 
 			if ((ret = repl_prof_add(&packet, &profile->name, 0, NULL, count)) < 0)
 				goto error;
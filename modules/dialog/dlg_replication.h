@@ -38,6 +38,8 @@
 #define REPLICATION_DLG_UPDATED		2
 #define REPLICATION_DLG_DELETED		3
 #define DLG_SHARING_TAG_ACTIVE		4
+#define REPLICATION_DLG_UPDATED_DELTA	5
+#define REPLICATION_DLG_RESYNC		6
 
 #define BIN_VERSION 1
 
@@ -62,6 +64,7 @@ extern rw_lock_t *shtags_lock;
 
 extern int dialog_repl_cluster;
 extern int profile_repl_cluster;
+extern int dialog_repl_delta;
 
 extern str dlg_repl_cap;
 extern str prof_repl_cap;
@@ -77,8 +80,13 @@ void replicate_dialog_deleted(struct dlg_cell *dlg);
 int dlg_replicated_create(bin_packet_t *packet, struct dlg_cell *cell, str *ftag,
 							str *ttag, int safe);
 int dlg_replicated_update(bin_packet_t *packet);
+int dlg_replicated_update_delta(bin_packet_t *packet);
+int dlg_replicated_resync(bin_packet_t *packet);
 int dlg_replicated_delete(bin_packet_t *packet);
 
+void bin_push_dlg(bin_packet_t *packet, struct dlg_cell *dlg);
+void bin_push_dlg_delta(bin_packet_t *packet, struct dlg_cell *dlg);
+
 void receive_dlg_repl(bin_packet_t *packet);
 void rcv_cluster_event(enum clusterer_event ev, int node_id);
 
@@ -97,6 +97,7 @@ int store_dlg_value_unsafe(struct dlg_cell *dlg, str *name, str *val)
 				else dlg->vals = dv;
 			}
 			dlg->flags |= DLG_FLAG_VP_CHANGED;
+			dlg->repl_dirty |= DLG_REPL_VARS;
 
 			shm_free(it);
 			return 0;
@@ -114,6 +115,7 @@ int store_dlg_value_unsafe(struct dlg_cell *dlg, str *name, str *val)
 	dlg->vals = dv;
 
 	dlg->flags |= DLG_FLAG_VP_CHANGED;
+	dlg->repl_dirty |= DLG_REPL_VARS;
 
 	return 0;
 }
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+
+#include "../../../str.h"
+#include "../../../ip_addr.h"
+#include "../../../bin_interface.h"
+
+#include "../dlg_hash.h"
+#include "../dlg_timer.h"
+#include "../dlg_vals.h"
+#include "../dlg_replication.h"
+
+static struct socket_info test_sock = {
+	.sock_str = str_init("udp:10.0.0.10:5060"),
+};
+
+/* a dialog as established by a typical INVITE, record-routed twice */
+static struct dlg_cell *new_test_dlg(void)
+{
+	str callid = str_init("a84b4c76e66710-4cd3b8e5@pc33.atlanta.example.com");
+	str from = str_init("sip:alice@atlanta.example.com");
+	str to = str_init("sip:bob@biloxi.example.com");
+	str ftag = str_init("1928301774"), ttag = str_init("a6c85cf");
+	str rr = str_init("<sip:10.0.0.10;lr;ftag=1928301774;did=f2b.5c2b7d91>,"
+		"<sip:proxy.biloxi.example.com;lr>");
+	str caller_ct = str_init("<sip:alice@192.0.2.101:5060;transport=udp>");
+	str callee_ct = str_init("<sip:bob@192.0.2.4:5060;transport=udp>");
+	str cseq = str_init("314159"), empty = {NULL, 0};
+	str names[] = {str_init("account"), str_init("billing_plan"),
+		str_init("caller_ip")};
+	str vals[] = {str_init("100234"), str_init("prepaid-eu"),
+		str_init("192.0.2.101")};
+	struct dlg_cell *dlg;
+	int i;
+
+	dlg = build_new_dlg(&callid, &from, &to, &ftag);
+	if (!dlg)
+		return NULL;
+
+	if (dlg_add_leg_info(dlg, &ftag, &rr, &caller_ct, &cseq, &test_sock,
+	        NULL, NULL, NULL) != 0 ||
+	        dlg_add_leg_info(dlg, &ttag, &empty, &callee_ct, &cseq, &test_sock,
+	        NULL, NULL, NULL) != 0)
+		goto error;
+
+	for (i = 0; i < 3; i++)
+		if (store_dlg_value_unsafe(dlg, &names[i], &vals[i]) != 0)
+			goto error;
+
+	dlg->state = DLG_STATE_CONFIRMED;
+	dlg->repl_seq = 7;
+	return dlg;
+
+error:
+	destroy_dlg(dlg);
+	return NULL;
+}
+
+/* the size of the replicated update packet of @dlg */
+static int update_size(struct dlg_cell *dlg, int delta)
+{
+	bin_packet_t packet;
+	int len;
+
+	if (bin_init(&packet, &dlg_repl_cap, delta ? REPLICATION_DLG_UPDATED_DELTA :
+	        REPLICATION_DLG_UPDATED, BIN_VERSION, 0) != 0)
+		return -1;
+
+	if (delta)
+		bin_push_dlg_delta(&packet, dlg);
+	else
+		bin_push_dlg(&packet, dlg);
+
+	len = packet.buffer.len;
+	bin_free_packet(&packet);
+	return len;
+}
+
+/* the receiver finds the dialog and the update sequence in the delta */
+static int check_delta(struct dlg_cell *dlg)
+{
+	bin_packet_t packet, rcv;
+	str callid, ftag, ttag;
+	unsigned int seq, dirty;
+	int rc = -1;
+
+	if (bin_init(&packet, &dlg_repl_cap, REPLICATION_DLG_UPDATED_DELTA,
+	        BIN_VERSION, 0) != 0)
+		return -1;
+	bin_push_dlg_delta(&packet, dlg);
+
+	bin_init_buffer(&rcv, packet.buffer.s, packet.buffer.len);
+	if (rcv.type == REPLICATION_DLG_UPDATED_DELTA &&
+	        bin_pop_str(&rcv, &callid) == 0 && bin_pop_str(&rcv, &ftag) == 0 &&
+	        bin_pop_str(&rcv, &ttag) == 0 && bin_pop_int(&rcv, &seq) == 0 &&
+	        bin_pop_int(&rcv, &dirty) == 0 &&
+	        !str_strcmp(&callid, &dlg->callid) &&
+	        !str_strcmp(&ftag, &dlg->legs[DLG_CALLER_LEG].tag) &&
+	        !str_strcmp(&ttag, &dlg->legs[callee_idx(dlg)].tag) &&
+	        seq == dlg->repl_seq && dirty == dlg->repl_dirty)
+		rc = 0;
+
+	bin_free_packet(&packet);
+	return rc;
+}
+
+void mod_tests(void)
+{
+	struct dlg_cell *dlg;
+	int full, delta, delta_vars;
+
+	if (!ok(init_dlg_table(16) == 0 && init_dlg_timer(NULL) == 0,
+	        "dialog: init the dialogs table"))
+		return;
+
+	dlg = new_test_dlg();
+	if (!ok(dlg != NULL, "dialog: build a confirmed dialog"))
+		goto out;
+
+	dialog_repl_delta = 1;
+
+	full = update_size(dlg, 0);
+	dlg->repl_dirty = 0;
+	delta = update_size(dlg, 1);
+	dlg->repl_dirty = DLG_REPL_VARS;
+	delta_vars = update_size(dlg, 1);
+
+	ok(check_delta(dlg) == 0, "dialog: the delta update names the dialog");
+	ok(full > 0 && delta > 0 && delta < delta_vars && delta_vars < full,
+		"dialog: bytes per update - full %d, delta %d, delta with vars %d",
+		full, delta, delta_vars);
+
+	dialog_repl_delta = 0;
+	destroy_dlg(dlg);
+out:
+	destroy_dlg_timer();
+	destroy_dlg_table();
+}
@@ -27,6 +27,7 @@
 
 #include "../../parser/msg_parser.h"
 #include "../../rw_locking.h"
+#include "../../rcu.h"
 #include "../../time_rec.h"
 
 #include "../../db/db.h"
@@ -38,6 +39,7 @@
 
 #define DP_CASE_INSENSITIVE		1
 #define DP_INDEX_HASH_SIZE		16
+#define DP_MAX_PFX_LEN			32
 
 typedef struct dpl_node{
 	int dpid;
@@ -51,10 +53,30 @@ typedef struct dpl_node{
 	str attrs;
 	str timerec;
 	tmrec_t *parsed_timerec;
+	int regex_no; /*position inside the regexp bucket (regexp rules only)*/
 
 	struct dpl_node * next; /*next rule*/
 }dpl_node_t, *dpl_node_p;
 
+/* a regexp rule hooked into the prefix index */
+typedef struct dpl_pfx_rule{
+	dpl_node_t * rule;
+	struct dpl_pfx_rule * next;
+}dpl_pfx_rule_t, *dpl_pfx_rule_p;
+
+/* byte trie built over the anchored literal prefixes of the regexp rules
+   (e.g. "^\+4021[0-9]+$" is indexed under "+4021"). Each node holds, in
+   bucket order, the rules whose literal prefix ends in that node; rules
+   with no usable prefix are kept in the root node */
+typedef struct dpl_pfx_node{
+	unsigned char c;
+	dpl_pfx_rule_t * first_rule;
+	dpl_pfx_rule_t * last_rule;
+
+	struct dpl_pfx_node * kids;
+	struct dpl_pfx_node * next; /*next sibling*/
+}dpl_pfx_node_t, *dpl_pfx_node_p;
+
 /* HASH_SIZE	buckets of matching strings (lowercase hashing)
    1			bucket of regexps (index: HASH_SIZE) */
 typedef struct dpl_index{
@@ -67,6 +89,8 @@ typedef struct dpl_index{
 typedef struct dpl_id{
 	int dp_id;
 	dpl_index_t* rule_hash;/*fast access :string rules are hashed*/
+	dpl_pfx_node_t pfx_root;/*prefix index over the regexp bucket*/
+	int regex_rules;
 	struct dpl_id * next;
 }dpl_id_t,*dpl_id_p;
 
@@ -81,7 +105,7 @@ typedef struct dp_connection_list {
 	db_con_t** dp_db_handle;
 	db_func_t dp_dbf;
 
-	rw_lock_t *ref_lock;
+	rw_lock_t *ref_lock; /*serializes the reloads - readers use RCU*/
 
 	struct dp_connection_list * next;
 } dp_connection_list_t, *dp_connection_list_p;
@@ -121,6 +145,9 @@ int translate(struct sip_msg *msg, str user_name, str* repl_user, dpl_id_p idp,
 int rule_translate(struct sip_msg *msg, str , dpl_node_t * rule,  str *);
 int test_match(str string, pcre * exp, int * out, int out_max);
 
+int dp_pfx_add_rule(dpl_id_p idp, dpl_node_t * rule);
+void dp_pfx_destroy(dpl_id_p idp);
+
 
 typedef void * (*func_malloc)(size_t );
 typedef void  (*func_free)(void * );
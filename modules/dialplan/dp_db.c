@@ -24,6 +24,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 
 #include "../../dprint.h"
 #include "../../ut.h"
@@ -234,7 +235,7 @@ void dp_disconnect_all_db(void)
 /*load rules from DB*/
 int dp_load_db(dp_connection_list_p dp_conn)
 {
-	int i, nr_rows;
+	int i, nr_rows, old_index;
 	db_res_t * res = 0;
 	db_val_t * values;
 	db_row_t * rows;
@@ -350,10 +351,14 @@ end:
 	/*update data*/
 	lock_start_write( dp_conn->ref_lock );
 
-	destroy_hash(&dp_conn->hash[dp_conn->crt_index]);
-
+	old_index = dp_conn->crt_index;
 	dp_conn->crt_index = dp_conn->next_index;
 
+	/* readers do not lock - wait for the ones still
+	 * walking through the old rules before dropping them */
+	rcu_synchronize();
+	destroy_hash(&dp_conn->hash[old_index]);
+
 	lock_stop_write( dp_conn->ref_lock );
 
 	list_hash(dp_conn->hash[dp_conn->crt_index], dp_conn->ref_lock);
@@ -624,6 +629,11 @@ int add_rule2hash(dpl_node_t * rule, dp_connection_list_t *conn, int index)
 	switch (rule->matchop) {
 		case REGEX_OP:
 			indexp = &crt_idp->rule_hash[DP_INDEX_HASH_SIZE];
+			if (dp_pfx_add_rule(crt_idp, rule) != 0) {
+				LM_ERR("failed to index regexp rule %.*s\n",
+					rule->match_exp.len, rule->match_exp.s);
+				goto err;
+			}
 			break;
 
 		case EQUAL_OP:
@@ -664,12 +674,165 @@ int add_rule2hash(dpl_node_t * rule, dp_connection_list_t *conn, int index)
 	return 0;
 
 err:
-	if(new_id)
+	if(new_id) {
+		dp_pfx_destroy(crt_idp);
 		shm_free(crt_idp);
+	}
 	return -1;
 }
 
 
+/* returns the length of the literal string that any input must start with
+ * in order to match the rule's regexp, or 0 if it cannot be determined */
+static int dp_regex_prefix(dpl_node_t *rule, char *buf, int max_len)
+{
+	char *p, *end, c;
+	int len, depth, in_class;
+
+	end = rule->match_exp.s + rule->match_exp.len;
+
+	/* a top-level alternative means the anchor covers only one branch */
+	for (p = rule->match_exp.s, depth = 0, in_class = 0; p < end; p++) {
+		if (*p == '\\') {
+			p++;
+			continue;
+		}
+
+		if (in_class) {
+			if (*p == ']')
+				in_class = 0;
+			continue;
+		}
+
+		switch (*p) {
+			case '[':
+				in_class = 1;
+				/* a leading ']' is a literal inside the class */
+				if (p + 1 < end && p[1] == '^')
+					p++;
+				if (p + 1 < end && p[1] == ']')
+					p++;
+				break;
+			case '(':
+				depth++;
+				break;
+			case ')':
+				depth--;
+				break;
+			case '|':
+				if (depth == 0)
+					return 0;
+				break;
+		}
+	}
+
+	p = rule->match_exp.s;
+	if (p == end || *p != '^')
+		return 0;
+
+	for (len = 0, p++; p < end && len < max_len; p++) {
+		if (*p == '\\') {
+			/* only escaped punctuation stands for itself */
+			if (p + 1 == end || isalnum((int)(unsigned char)p[1]))
+				break;
+			c = *++p;
+		} else if (*p == 0 || strchr(".[]()*+?{}|^$", *p)) {
+			break;
+		} else {
+			c = *p;
+		}
+
+		if ((rule->match_flags & DP_CASE_INSENSITIVE) &&
+		isalpha((int)(unsigned char)c))
+			break;
+
+		buf[len++] = c;
+	}
+
+	/* the last literal may be optional */
+	if (len && p < end && (*p == '*' || *p == '?' || *p == '{'))
+		len--;
+
+	return len;
+}
+
+
+int dp_pfx_add_rule(dpl_id_p idp, dpl_node_t *rule)
+{
+	char pfx[DP_MAX_PFX_LEN];
+	dpl_pfx_node_p node, kid;
+	dpl_pfx_rule_p pfx_rule;
+	int i, len;
+
+	len = dp_regex_prefix(rule, pfx, DP_MAX_PFX_LEN);
+
+	for (i = 0, node = &idp->pfx_root; i < len; i++, node = kid) {
+		for (kid = node->kids; kid; kid = kid->next)
+			if (kid->c == (unsigned char)pfx[i])
+				break;
+
+		if (!kid) {
+			kid = shm_malloc(sizeof(dpl_pfx_node_t));
+			if (!kid) {
+				LM_ERR("out of shm memory (pfx node)\n");
+				return -1;
+			}
+			memset(kid, 0, sizeof(dpl_pfx_node_t));
+			kid->c = (unsigned char)pfx[i];
+			kid->next = node->kids;
+			node->kids = kid;
+		}
+	}
+
+	pfx_rule = shm_malloc(sizeof(dpl_pfx_rule_t));
+	if (!pfx_rule) {
+		LM_ERR("out of shm memory (pfx rule)\n");
+		return -1;
+	}
+	pfx_rule->rule = rule;
+	pfx_rule->next = NULL;
+
+	if (node->last_rule)
+		node->last_rule->next = pfx_rule;
+	else
+		node->first_rule = pfx_rule;
+	node->last_rule = pfx_rule;
+
+	rule->regex_no = idp->regex_rules++;
+
+	LM_DBG("regexp rule %.*s indexed under prefix '%.*s'\n",
+		rule->match_exp.len, rule->match_exp.s, len, pfx);
+
+	return 0;
+}
+
+
+static void dp_pfx_destroy_node(dpl_pfx_node_p node)
+{
+	dpl_pfx_node_p kid;
+	dpl_pfx_rule_p pfx_rule;
+
+	while ((kid = node->kids)) {
+		node->kids = kid->next;
+		dp_pfx_destroy_node(kid);
+		shm_free(kid);
+	}
+
+	while ((pfx_rule = node->first_rule)) {
+		node->first_rule = pfx_rule->next;
+		shm_free(pfx_rule);
+	}
+	node->last_rule = NULL;
+}
+
+
+void dp_pfx_destroy(dpl_id_p idp)
+{
+	dp_pfx_destroy_node(&idp->pfx_root);
+	idp->regex_rules = 0;
+}
+
+
 void destroy_hash(dpl_id_t **rules_hash)
 {
 	dpl_id_p crt_idp;
@@ -697,6 +860,7 @@ void destroy_hash(dpl_id_t **rules_hash)
 		}
 		*rules_hash = crt_idp->next;
 
+		dp_pfx_destroy(crt_idp);
 		shm_free(crt_idp);
 		crt_idp = NULL;
 	}
@@ -768,8 +932,8 @@ void list_hash(dpl_id_t * hash, rw_lock_t * ref_lock)
 	if(!hash)
 		return;
 
-	/* lock the data for reading */
-	lock_start_read( ref_lock );
+	/* ref the data for reading */
+	rcu_read_lock();
 
 	for(crt_idp = hash; crt_idp; crt_idp = crt_idp->next) {
 		LM_DBG("DPID: %i, pointer %p\n", crt_idp->dp_id, crt_idp);
@@ -786,7 +950,7 @@ void list_hash(dpl_id_t * hash, rw_lock_t * ref_lock)
 	}
 
 	/* we are done reading -> unref the data */
-	lock_stop_read( ref_lock );
+	rcu_read_unlock();
 }
 
 
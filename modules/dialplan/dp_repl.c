@@ -364,8 +364,11 @@ static inline int check_time(tmrec_t *time_rec) {
 static char dp_attrs_buf[DP_MAX_ATTRS_LEN+1];
 int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str * attrs) {
 
-	dpl_node_p rulep, rrulep;
+	dpl_node_p rulep, rrulep, candp;
+	dpl_pfx_node_p pfxp;
+	dpl_pfx_rule_p lists[DP_MAX_PFX_LEN + 1];
 	int string_res = -1, regexp_res = -1, bucket;
+	int i, k, lists_no;
 
 	if(!input.s || !input.len) {
 		LM_ERR("invalid input string\n");
@@ -407,25 +410,59 @@ int translate(struct sip_msg *msg, str input, str * output, dpl_id_p idp, str *
 		}
 	}
 
-	/* try to match the input in the regexp bucket */
-	for (rrulep = idp->rule_hash[DP_INDEX_HASH_SIZE].first_rule; rrulep; rrulep=rrulep->next) {
+	/* only the regexp rules whose literal prefix also prefixes the input
+	 * may match - gather their lists from the prefix index */
+	lists_no = 0;
+	pfxp = &idp->pfx_root;
+	for (i = 0; ; i++) {
+		if (pfxp->first_rule)
+			lists[lists_no++] = pfxp->first_rule;
+
+		if (i == input.len)
+			break;
+
+		for (pfxp = pfxp->kids; pfxp; pfxp = pfxp->next)
+			if (pfxp->c == (unsigned char)input.s[i])
+				break;
+		if (!pfxp)
+			break;
+	}
+
+	/* try to match the input against the candidates, in bucket order */
+	rrulep = NULL;
+	for (;;) {
+		for (i = 0, k = -1; i < lists_no; i++)
+			if (lists[i] && (k < 0 ||
+			lists[i]->rule->regex_no < lists[k]->rule->regex_no))
+				k = i;
+		if (k < 0)
+			break;
+
+		candp = lists[k]->rule;
+		lists[k] = lists[k]->next;
+
+		/* the bucket is sorted by priority, so nothing left here can
+		 * beat the string rule which already matched */
+		if (string_res == 0 && candp->pr > rulep->pr)
+			break;
 
 		// Check for Time Period if Set
-		if(rrulep->parsed_timerec) {
-			LM_DBG("Timerec exists for rule checking: %.*s\n", rrulep->timerec.len, rrulep->timerec.s);
+		if(candp->parsed_timerec) {
+			LM_DBG("Timerec exists for rule checking: %.*s\n", candp->timerec.len, candp->timerec.s);
 			// Doesn't matches time period continue with next rule
-			if(!check_time(rrulep->parsed_timerec)) {
+			if(!check_time(candp->parsed_timerec)) {
 				LM_DBG("Time rule doesn't match: skip next!\n");
 				continue;
 			}
 		}
 
-		regexp_res = (test_match(input, rrulep->match_comp, matches, MAX_MATCHES)
+		regexp_res = (test_match(input, candp->match_comp, matches, MAX_MATCHES)
 					>= 0 ? 0 : -1);
 
 		LM_DBG("Regex operator testing. Got result: %d\n", regexp_res);
 
 		if (regexp_res == 0) {
+			rrulep = candp;
 			break;
 		}
 	}
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../../../str.h"
+#include "../../../hash_func.h"
+#include "../../../mem/shm_mem.h"
+
+#include "../dialplan.h"
+
+#define BENCH_RULES		5000
+#define BENCH_LOOPS		20000
+#define BENCH_LINEAR_LOOPS	200
+#define MAX_TEST_RULES	BENCH_RULES
+
+static dpl_node_t *test_rules[MAX_TEST_RULES];
+static int test_rules_no;
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static dpl_id_p new_dpid(void)
+{
+	dpl_id_p idp;
+
+	idp = shm_malloc(sizeof *idp);
+	if (!idp)
+		return NULL;
+	memset(idp, 0, sizeof *idp);
+
+	idp->rule_hash = shm_malloc((DP_INDEX_HASH_SIZE + 1) * sizeof(dpl_index_t));
+	if (!idp->rule_hash) {
+		shm_free(idp);
+		return NULL;
+	}
+	memset(idp->rule_hash, 0, (DP_INDEX_HASH_SIZE + 1) * sizeof(dpl_index_t));
+
+	test_rules_no = 0;
+	return idp;
+}
+
+static void free_dpid(dpl_id_p idp)
+{
+	int i;
+
+	for (i = 0; i < test_rules_no; i++) {
+		if (test_rules[i]->match_comp)
+			wrap_pcre_free(test_rules[i]->match_comp);
+		shm_free(test_rules[i]);
+	}
+
+	dp_pfx_destroy(idp);
+	shm_free(idp->rule_hash);
+	shm_free(idp);
+}
+
+/* same as add_rule2hash(), the rules must come in priority order; the
+ * index of the rule is kept in its attrs, to tell which one matched */
+static int add_rule(dpl_id_p idp, int matchop, char *exp, int flags, int pr)
+{
+	dpl_node_t *rule;
+	dpl_index_p indexp;
+	str key;
+	int len;
+
+	if (test_rules_no == MAX_TEST_RULES)
+		return -1;
+
+	len = strlen(exp);
+	rule = shm_malloc(sizeof *rule + len + 1 + 8);
+	if (!rule)
+		return -1;
+	memset(rule, 0, sizeof *rule);
+
+	rule->match_exp.s = (char *)(rule + 1);
+	rule->match_exp.len = len;
+	memcpy(rule->match_exp.s, exp, len + 1);
+	rule->attrs.s = rule->match_exp.s + len + 1;
+	rule->attrs.len = sprintf(rule->attrs.s, "%d", test_rules_no);
+
+	rule->matchop = matchop;
+	rule->match_flags = flags;
+	rule->pr = pr;
+	rule->table_id = test_rules_no;
+
+	if (matchop == REGEX_OP) {
+		rule->match_comp = wrap_pcre_compile(rule->match_exp.s, flags);
+		if (!rule->match_comp || dp_pfx_add_rule(idp, rule) != 0) {
+			shm_free(rule);
+			return -1;
+		}
+		indexp = &idp->rule_hash[DP_INDEX_HASH_SIZE];
+	} else {
+		key = rule->match_exp;
+		indexp = &idp->rule_hash[core_case_hash(&key, NULL,
+			DP_INDEX_HASH_SIZE)];
+	}
+
+	if (!indexp->first_rule)
+		indexp->first_rule = rule;
+	if (indexp->last_rule)
+		indexp->last_rule->next = rule;
+	indexp->last_rule = rule;
+
+	test_rules[test_rules_no] = rule;
+	return test_rules_no++;
+}
+
+/* the rule translate() should pick, by checking all of them */
+static int linear_match(str *input)
+{
+	static int ovector[3 * 3];
+	dpl_node_t *rule, *best = NULL;
+	int i, match;
+
+	for (i = 0; i < test_rules_no; i++) {
+		rule = test_rules[i];
+
+		if (rule->matchop == REGEX_OP)
+			match = test_match(*input, rule->match_comp, ovector, 9) >= 0;
+		else
+			match = rule->match_exp.len == input->len &&
+				!((rule->match_flags & DP_CASE_INSENSITIVE) ?
+				strncasecmp(rule->match_exp.s, input->s, input->len) :
+				strncmp(rule->match_exp.s, input->s, input->len));
+
+		if (match && (!best || rule->pr < best->pr))
+			best = rule;
+	}
+
+	return best ? best->table_id : -1;
+}
+
+static int indexed_match(dpl_id_p idp, str *input)
+{
+	str output, attrs;
+
+	if (translate(NULL, *input, &output, idp, &attrs) != 0)
+		return -1;
+
+	return atoi(attrs.s);
+}
+
+static void test_translate(void)
+{
+	static char *inputs[] = {"+40211234", "+4021999", "+40219", "+4031234",
+		"0015551234", "+15551234", "abc", "AbC1", "abc1", "+40.1",
+		"+40x1", "+4091234", "12345", "999", "x", "+4", "+4021", "+0219",
+		NULL};
+	dpl_id_p idp;
+	str input;
+	int i, bad;
+
+	idp = new_dpid();
+	if (!ok(idp != NULL, "dialplan: create a dpid"))
+		return;
+
+	bad = 0;
+	bad |= add_rule(idp, REGEX_OP, "^a|^\\+4021", 0, 1) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^\\+4?0219", 0, 2) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^ABC[0-9]", DP_CASE_INSENSITIVE, 3) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^\\+40\\.1", 0, 4) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^(\\+1|001)[0-9]+$", 0, 5) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^\\+4021[0-9]+$", 0, 10) < 0;
+	bad |= add_rule(idp, EQUAL_OP, "+40211234", 0, 15) < 0;
+	bad |= add_rule(idp, EQUAL_OP, "+4031234", 0, 16) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^\\+40[0-9]+$", 0, 20) < 0;
+	bad |= add_rule(idp, REGEX_OP, "[0-9]{5}$", 0, 30) < 0;
+	bad |= add_rule(idp, REGEX_OP, "^[[:digit:]]+$", 0, 40) < 0;
+	if (!ok(!bad, "dialplan: add the rules")) {
+		free_dpid(idp);
+		return;
+	}
+
+	for (i = 0, bad = 0; inputs[i]; i++) {
+		init_str(&input, inputs[i]);
+		if (indexed_match(idp, &input) != linear_match(&input)) {
+			diag("%s matched rule %d instead of %d", inputs[i],
+				indexed_match(idp, &input), linear_match(&input));
+			bad++;
+		}
+	}
+	ok(bad == 0, "dialplan: the prefix index picks the same rules");
+
+	free_dpid(idp);
+}
+
+static void bench_translate(void)
+{
+	char exp[32], hit_buf[16], miss_buf[16];
+	str hit, miss;
+	unsigned long long start, idx_ns, lin_ns;
+	dpl_id_p idp;
+	int i, bad = 0;
+
+	idp = new_dpid();
+	if (!ok(idp != NULL, "dialplan: create the bench dpid"))
+		return;
+
+	for (i = 0; i < BENCH_RULES; i++) {
+		snprintf(exp, sizeof exp, "^\\+4%04d[0-9]+$", i);
+		if (add_rule(idp, REGEX_OP, exp, 0, i) < 0)
+			bad++;
+	}
+	if (!ok(bad == 0, "dialplan: add %d regexp rules", BENCH_RULES)) {
+		free_dpid(idp);
+		return;
+	}
+
+	hit.s = hit_buf;
+	hit.len = sprintf(hit_buf, "+4%04d1234", BENCH_RULES - 1);
+	miss.s = miss_buf;
+	miss.len = sprintf(miss_buf, "+391234567");
+
+	start = now_ns();
+	for (i = 0; i < BENCH_LOOPS; i++)
+		if (indexed_match(idp, &hit) != BENCH_RULES - 1 ||
+		        indexed_match(idp, &miss) != -1)
+			bad++;
+	idx_ns = (now_ns() - start) / (2 * BENCH_LOOPS);
+
+	start = now_ns();
+	for (i = 0; i < BENCH_LINEAR_LOOPS; i++)
+		if (linear_match(&hit) != BENCH_RULES - 1 || linear_match(&miss) != -1)
+			bad++;
+	lin_ns = (now_ns() - start) / (2 * BENCH_LINEAR_LOOPS);
+
+	ok(bad == 0, "dialplan: %d rules - translate %llu ns, linear scan "
+		"%llu ns", BENCH_RULES, idx_ns, lin_ns);
+
+	free_dpid(idp);
+}
+
+void mod_tests(void)
+{
+	test_translate();
+	bench_translate();
+}
@@ -65,6 +65,8 @@
 #include "../../db/db_res.h"
 #include "../../str.h"
 #include "../../rw_locking.h"
+#include "../../rcu.h"
+#include "../../hash_func.h"
 
 #include "dispatch.h"
 #include "ds_fixups.h"
@@ -140,9 +142,15 @@ static void ds_destroy_data_set( ds_data_t *d)
 			}while(dest);
 			shm_free(sp_curr->dlist);
 		}
+		if (sp_curr->ring)
+			shm_free(sp_curr->ring);
 		shm_free(sp_curr);
 	}
 
+	/* the index buckets and entries are a single chunk */
+	if (d->ip_hash)
+		shm_free(d->ip_hash);
+
 	/* free the data holder */
 	shm_free(d);
 }
@@ -438,6 +446,174 @@ static inline void re_calculate_active_dsts(ds_set_p sp)
 }
 
 
+/* slots of the failover table, per destination */
+#define DS_RING_FACTOR 64
+
+static inline int ds_is_prime(unsigned int n)
+{
+	unsigned int d;
+
+	for (d = 2; d * d <= n; d++)
+		if (n % d == 0)
+			return 0;
+	return 1;
+}
+
+/*
+ * Build the (maglev like) consistent hashing table of the set: each
+ * destination walks its own permutation of the slots, given by the
+ * hash of its URI, and takes free slots in proportion to its weight.
+ * A hash falling on an inactive destination walks the table to the next
+ * active one, so the calls of a failed destination spread over all the
+ * others, while the calls of the active ones are not moved at all.
+ */
+int ds_build_ring(ds_set_p sp)
+{
+	unsigned int m, filled, j, h, maxw, w;
+	unsigned int *tmp, *skip, *next, *credit;
+
+	/* the table holds 16 bit indexes */
+	if (sp->nr >= 0xffff) {
+		LM_WARN("set %d is too large for a failover hashing table\n", sp->id);
+		return 0;
+	}
+
+	for (m = DS_RING_FACTOR * sp->nr; !ds_is_prime(m); m++);
+
+	sp->ring = (unsigned short *)shm_malloc(m * sizeof(unsigned short));
+	tmp = (unsigned int *)pkg_malloc(3 * sp->nr * sizeof(unsigned int));
+	if (sp->ring == NULL || tmp == NULL) {
+		LM_ERR("no more memory for the hashing table\n");
+		if (tmp)
+			pkg_free(tmp);
+		if (sp->ring) {
+			shm_free(sp->ring);
+			sp->ring = NULL;
+		}
+		return -1;
+	}
+	sp->ring_size = m;
+	skip = tmp;
+	next = tmp + sp->nr;
+	credit = tmp + 2 * sp->nr;
+
+	for (j = 0, maxw = 0; j < sp->nr; j++) {
+		h = core_hash(&sp->dlist[j].uri, NULL, 0);
+		skip[j] = (h >> 16 ^ h * 2654435761u) % (m - 1) + 1;
+		/* the slot to try next, walked incrementally (no overflow) */
+		next[j] = h % m;
+		credit[j] = 0;
+		if (sp->dlist[j].weight > maxw)
+			maxw = sp->dlist[j].weight;
+	}
+
+	memset(sp->ring, 0xff, m * sizeof(unsigned short));
+	for (filled = 0; ; ) {
+		for (j = 0; j < sp->nr; j++) {
+			/* no weights at all - all destinations are equal */
+			w = maxw ? sp->dlist[j].weight : 1;
+			for (credit[j] += w; credit[j] >= (maxw ? maxw : 1);
+			credit[j] -= (maxw ? maxw : 1)) {
+				do {
+					h = next[j];
+					next[j] = (next[j] + skip[j]) % m;
+				} while (sp->ring[h] != 0xffff);
+				sp->ring[h] = j;
+				if (++filled == m)
+					goto done;
+			}
+		}
+	}
+
+done:
+	pkg_free(tmp);
+	return 0;
+}
+
+
+/* returns the active destination owning the hash, probing over the
+ * inactive ones, or -1 if none; each hash probes the slots in its own
+ * order, so the share of a failed destination is evenly spread */
+int ds_ring_lookup(ds_set_p sp, unsigned int hash, int set_size)
+{
+	unsigned int k, slot, skip;
+	int i;
+
+	if (sp->ring == NULL)
+		return -1;
+
+	slot = hash % sp->ring_size;
+	skip = ((hash >> 16 ^ hash) * 2654435761u) % (sp->ring_size - 1) + 1;
+
+	for (k = 0; k < sp->ring_size; k++) {
+		i = sp->ring[slot];
+		if (i < set_size && dst_is_active(sp->dlist[i]))
+			return i;
+		slot = (slot + skip) % sp->ring_size;
+	}
+
+	return -1;
+}
+
+
+static inline unsigned int ds_ip_hash(struct ip_addr *ip, unsigned int size)
+{
+	str s = {(char *)ip->u.addr, ip->len};
+
+	return core_hash(&s, NULL, size);
+}
+
+/* index all the IPs of all the destinations, preserving their order
+ * (set, destination, IP) inside each bucket */
+static int ds_index_ips(ds_data_t *d_data)
+{
+	ds_set_p sp;
+	ds_ip_entry_p e, *last;
+	unsigned int cnt, size, h;
+	int j, k;
+
+	cnt = 0;
+	for (sp = d_data->sets; sp; sp = sp->next)
+		for (j = 0; j < sp->nr; j++)
+			cnt += sp->dlist[j].ips_cnt;
+
+	/* power of 2, about one IP per bucket */
+	for (size = 16; size < cnt; size <<= 1);
+
+	d_data->ip_hash = (ds_ip_entry_p *)shm_malloc(
+		2 * size * sizeof(ds_ip_entry_p) +
+		cnt * sizeof(ds_ip_entry_t));
+	if (d_data->ip_hash == NULL) {
+		LM_ERR("no more shm memory for the IP index\n");
+		return -1;
+	}
+	d_data->ip_hash_size = size;
+
+	/* the tails of the buckets are only needed while building */
+	last = d_data->ip_hash + size;
+	memset(d_data->ip_hash, 0, 2 * size * sizeof(ds_ip_entry_p));
+
+	e = (ds_ip_entry_p)(last + size);
+	for (sp = d_data->sets; sp; sp = sp->next)
+		for (j = 0; j < sp->nr; j++)
+			for (k = 0; k < sp->dlist[j].ips_cnt; k++, e++) {
+				e->set = sp;
+				e->dst = &sp->dlist[j];
+				e->idx = k;
+				e->next = NULL;
+
+				h = ds_ip_hash(&sp->dlist[j].ips[k], size);
+				if (d_data->ip_hash[h] == NULL)
+					d_data->ip_hash[h] = e;
+				else
+					last[h]->next = e;
+				last[h] = e;
+			}
+
+	return 0;
+}
+
+
 /* compact destinations from sets for fast access */
 int reindex_dests( ds_data_t *d_data)
 {
@@ -480,8 +656,14 @@ int reindex_dests( ds_data_t *d_data)
 
 		re_calculate_active_dsts(sp);
 
+		if (ds_build_ring(sp) != 0)
+			goto err1;
+
 	}
 
+	if (ds_index_ips(d_data) != 0)
+		goto err1;
+
 	LM_DBG("found [%d] dest sets\n", d_data->sets_no);
 	return 0;
 
@@ -490,6 +672,92 @@ err1:
 }
 
 
+/* free a copy made by ds_clone_data() - the strings, params and the
+ * FreeSWITCH sockets are still owned by the original data */
+static void ds_free_data_copy(void *data)
+{
+	ds_data_t *d = (ds_data_t *)data;
+	ds_set_p sp, sp_curr;
+
+	sp = d->sets;
+	while (sp) {
+		sp_curr = sp;
+		sp = sp->next;
+
+		if (sp_curr->dlist)
+			shm_free(sp_curr->dlist);
+		if (sp_curr->ring)
+			shm_free(sp_curr->ring);
+		shm_free(sp_curr);
+	}
+
+	if (d->ip_hash)
+		shm_free(d->ip_hash);
+
+	shm_free(d);
+}
+
+/* copy the sets and destinations of the data (sharing the strings, the
+ * params and the FreeSWITCH sockets), so they can be changed and
+ * published without touching the version the readers may still see */
+static ds_data_t *ds_clone_data(ds_data_t *old)
+{
+	ds_data_t *d;
+	ds_set_p sp, nsp, *last;
+	int j;
+
+	d = (ds_data_t *)shm_malloc(sizeof *d);
+	if (d == NULL) {
+		LM_ERR("no more shm memory\n");
+		return NULL;
+	}
+	memset(d, 0, sizeof *d);
+	d->sets_no = old->sets_no;
+
+	last = &d->sets;
+	for (sp = old->sets; sp; sp = sp->next) {
+		nsp = (ds_set_p)shm_malloc(sizeof *nsp);
+		if (nsp == NULL)
+			goto error;
+		memcpy(nsp, sp, sizeof *nsp);
+		nsp->dlist = NULL;
+		nsp->ring = NULL;
+		nsp->next = NULL;
+		*last = nsp;
+		last = &nsp->next;
+
+		if (sp->nr) {
+			nsp->dlist = (ds_dest_p)shm_malloc(sp->nr * sizeof(ds_dest_t));
+			if (nsp->dlist == NULL)
+				goto error;
+			memcpy(nsp->dlist, sp->dlist, sp->nr * sizeof(ds_dest_t));
+			for (j = 0; j < sp->nr; j++)
+				nsp->dlist[j].next = (j == sp->nr - 1) ?
+					NULL : &nsp->dlist[j + 1];
+		}
+
+		if (sp->ring) {
+			nsp->ring = (unsigned short *)shm_malloc(
+				sp->ring_size * sizeof(unsigned short));
+			if (nsp->ring == NULL)
+				goto error;
+			memcpy(nsp->ring, sp->ring,
+				sp->ring_size * sizeof(unsigned short));
+		}
+	}
+
+	if (ds_index_ips(d) != 0)
+		goto error;
+
+	return d;
+
+error:
+	LM_ERR("failed to copy the dispatching data\n");
+	ds_free_data_copy(d);
+	return NULL;
+}
+
+
 /* variables used to generate the pvar name */
 static int ds_has_pattern = 0;
 static str ds_pattern_prefix = str_init("");
@@ -985,12 +1253,15 @@ int ds_reload_db(ds_partition_t *partition)
 
 	lock_start_write( partition->lock );
 
-	/* no more activ readers -> do the swapping */
+	/* readers do not lock, so just do the swapping */
 	old_data = *partition->data;
 	*partition->data = new_data;
 
 	lock_stop_write( partition->lock );
 
+	/* wait for the readers which may still see the old data */
+	rcu_synchronize();
+
 	/* destroy old data */
 	if (old_data) {
 		/* copy the state of the destinations from the old set
@@ -1421,15 +1692,27 @@ static int is_default_destination_entry(ds_set_p idx,int i, int ds_use_default)
 }
 
 static int count_inactive_destinations(ds_set_p idx, int ds_use_default) {
-	int count = 0, i;
+	/* only count inactive entries that are not default */
+	return idx->nr - idx->active_nr - (
+		(is_default_destination_entry(idx, idx->nr-1, ds_use_default) &&
+		!dst_is_active(idx->dlist[idx->nr-1])) ? 1 : 0);
+}
+
+
+/* first destination whose running weight is above "w" */
+int ds_weight_lookup(ds_set_p idx, unsigned int w, int set_size)
+{
+	int l = 0, r = set_size, m;
 
-	for(i=0; i<idx->nr; i++)
-		if( !dst_is_active(idx->dlist[i]) )
-			/* only count inactive entries that are not default */
-			if(!is_default_destination_entry(idx, i, ds_use_default))
-				count++;
+	while (l < r) {
+		m = (l + r) / 2;
+		if (w < idx->dlist[m].running_weight)
+			r = m;
+		else
+			l = m + 1;
+	}
 
-	return count;
+	return l;
 }
 
 
@@ -1502,8 +1785,8 @@ int ds_select_dst(struct sip_msg *msg, ds_select_ctl_p ds_select_ctl,
 		return -1;
 	}
 
-	/* access ds data under reader's lock */
-	lock_start_read( ds_select_ctl->partition->lock );
+	/* access ds data as RCU reader */
+	rcu_read_lock();
 
 	/* get the index of the set */
 	if(ds_get_index(ds_select_ctl->set, &idx, ds_select_ctl->partition)!=0)
@@ -1647,9 +1930,7 @@ int ds_select_dst(struct sip_msg *msg, ds_select_ctl_p ds_select_ctl,
 			if (idx->dlist[set_size-1].running_weight) {
 				ds_rand = ds_hash % idx->dlist[set_size-1].running_weight;
 				/* get the ds id based on weights */
-				for( ds_id=0 ; ds_id<set_size ; ds_id++ )
-					if (ds_rand<idx->dlist[ds_id].running_weight)
-						break;
+				ds_id = ds_weight_lookup(idx, ds_rand, set_size);
 				if (ds_id==set_size) {
 					LM_CRIT("BUG - no node found with weight %d in set %d\n",
 						ds_rand,idx->id);
@@ -1670,39 +1951,26 @@ int ds_select_dst(struct sip_msg *msg, ds_select_ctl_p ds_select_ctl,
 			if (ds_hash==0) {
 				/* for algs with no hash, simple get the next in the list */
 				i = (i+1) % set_size;
-			} else {
-				/* use the hash and weights over active destinations only ;
-				 * if USE_DEFAULT is set, do a -1 if the default (last)
-				 * destination is active (we want to skip it) */
+			} else if ( (i=ds_ring_lookup(idx, ds_hash, set_size))<0 ) {
+				/* no active destination with a share of the hashing table
+				 * (only zero weights left) - use the hash over the active
+				 * destinations only ; if USE_DEFAULT is set, do a -1 if
+				 * the default (last) destination is active (we want to
+				 * skip it) */
+				i = ds_id;
 				cnt = idx->active_nr - ((ds_flags&DS_USE_DEFAULT &&
 					dst_is_active(idx->dlist[idx->nr-1]))?1:0);
 				if (cnt) {
-					/* weights or not ? */
-					if (idx->dlist[set_size-1].active_running_weight) {
-						ds_rand = ds_hash %
-							idx->dlist[set_size-1].active_running_weight;
-						/* get the ds id based on active weights */
-						for( i=0 ; i<set_size ; i++ )
-							if ( dst_is_active(idx->dlist[i]) &&
-							(ds_rand<idx->dlist[i].active_running_weight) )
-								break;
-						if (i==set_size) {
-							LM_CRIT("BUG - no active node found with "
-								"weight %d in set %d\n",ds_rand,idx->id);
-							goto error;
-						}
-					} else {
-						j = ds_hash % cnt;
-						/* translate this index to the full set of dsts */
-						for ( i=0 ; i<set_size ; i++ ) {
-							if ( dst_is_active(idx->dlist[i]) ) j--;
-							if (j<0) break;
-						}
-						if (i==set_size) {
-							LM_CRIT("BUG - no active node found with "
-								"in set %d\n",idx->id);
-							goto error;
-						}
+					j = ds_hash % cnt;
+					/* translate this index to the full set of dsts */
+					for ( i=0 ; i<set_size ; i++ ) {
+						if ( dst_is_active(idx->dlist[i]) ) j--;
+						if (j<0) break;
+					}
+					if (i==set_size) {
+						LM_CRIT("BUG - no active node found with "
+							"in set %d\n",idx->id);
+						goto error;
 					}
 				}
 				/* i reflects the new candidate */
@@ -1844,11 +2112,11 @@ done:
 				ds_select_ctl->partition->cnt_avp_name, avp_val)!=0)
 		goto error;
 
-	lock_stop_read( ds_select_ctl->partition->lock );
+	rcu_read_unlock();
 	return 1;
 
 error:
-	lock_stop_read( ds_select_ctl->partition->lock );
+	rcu_read_unlock();
 	return -1;
 }
 
@@ -1967,7 +2235,8 @@ int ds_set_state(int group, str *address, int state, int type,
 		return -1;
 	}
 
-	/* access ds data under reader's lock */
+	/* the reader lock keeps the set from being copied by
+	 * ds_update_weights() while its state changes */
 	lock_start_read( partition->lock );
 
 	/* get the index of the set */
@@ -2088,11 +2357,12 @@ int ds_is_in_list(struct sip_msg *_m, gparam_t *gp_ip, gparam_t *gp_port,
 					int set, int active_only, ds_partition_t *partition)
 {
 	pv_value_t val;
-	ds_set_p list;
+	ds_data_t *data;
+	ds_ip_entry_p e;
+	ds_dest_p dst;
 	struct ip_addr *ip;
 	int_str avp_val;
 	int port;
-	int j,k;
 
 	/* get the address to test */
 	if (fixup_get_svalue(_m, gp_ip, &val.rs) != 0) {
@@ -2120,47 +2390,45 @@ int ds_is_in_list(struct sip_msg *_m, gparam_t *gp_ip, gparam_t *gp_port,
 	memset(&val, 0, sizeof(pv_value_t));
 	val.flags = PV_VAL_INT|PV_TYPE_INT;
 
-	/* access ds data under reader's lock */
-	lock_start_read( partition->lock );
+	/* access ds data as RCU reader */
+	rcu_read_lock();
 
-	for(list = (*partition->data)->sets ; list!= NULL; list= list->next) {
-		if ((set == -1) || (set == list->id)) {
-			/* interate through all elements/destinations in the list */
-			for(j=0; j<list->nr; j++) {
-				/* interate through all IPs of each destination */
-				for(k=0 ; k<list->dlist[j].ips_cnt ; k++ ) {
-					if ( (list->dlist[j].ports[k]==0 || port==0
-					|| port==list->dlist[j].ports[k]) &&
-					ip_addr_cmp( ip, &list->dlist[j].ips[k]) ) {
-						/* matching destination */
-						if (active_only && !dst_is_active(list->dlist[j]) )
-							continue;
-						if(set==-1 && ds_setid_pvname.s!=0) {
-							val.ri = list->id;
-							if(pv_set_value(_m, &ds_setid_pv,
-									(int)EQ_T, &val)<0)
-							{
-								LM_ERR("setting PV failed\n");
-								goto error;
-							}
-						}
-						if (partition->attrs_avp_name>= 0) {
-							avp_val.s = list->dlist[j].attrs;
-							if(add_avp(AVP_VAL_STR|partition->attrs_avp_type,
-										partition->attrs_avp_name,avp_val)!=0)
-								goto error;
-						}
+	data = *partition->data;
+	if (data == NULL || data->ip_hash == NULL)
+		goto error;
 
-						lock_stop_read( partition->lock );
-						return 1;
-					}
+	/* the bucket keeps the IPs in the (set, destination) order, so the
+	 * first hit is the same one a walk through all the sets would find */
+	for (e = data->ip_hash[ds_ip_hash(ip, data->ip_hash_size)]; e;
+	e = e->next) {
+		dst = e->dst;
+		if ((set == -1 || set == e->set->id) &&
+		(dst->ports[e->idx]==0 || port==0 || port==dst->ports[e->idx]) &&
+		ip_addr_cmp(ip, &dst->ips[e->idx])) {
+			/* matching destination */
+			if (active_only && !dst_is_active(*dst))
+				continue;
+			if(set==-1 && ds_setid_pvname.s!=0) {
+				val.ri = e->set->id;
+				if(pv_set_value(_m, &ds_setid_pv, (int)EQ_T, &val)<0) {
+					LM_ERR("setting PV failed\n");
+					goto error;
 				}
 			}
+			if (partition->attrs_avp_name>= 0) {
+				avp_val.s = dst->attrs;
+				if(add_avp(AVP_VAL_STR|partition->attrs_avp_type,
+							partition->attrs_avp_name,avp_val)!=0)
+					goto error;
+			}
+
+			rcu_read_unlock();
+			return 1;
 		}
 	}
 
 error:
-	lock_stop_read( partition->lock );
+	rcu_read_unlock();
 	return -1;
 }
 
@@ -2180,8 +2448,8 @@ int ds_print_mi_list(struct mi_node* rpl, ds_partition_t *partition, int flags)
 		return  0;
 	}
 
-	/* access ds data under reader's lock */
-	lock_start_read( partition->lock );
+	/* access ds data as RCU reader */
+	rcu_read_lock();
 
 	for(list = (*partition->data)->sets ; list!= NULL; list= list->next) {
 		p = int2str(list->id, &len);
@@ -2256,10 +2524,10 @@ int ds_print_mi_list(struct mi_node* rpl, ds_partition_t *partition, int flags)
 		}
 	}
 
-	lock_stop_read( partition->lock );
+	rcu_read_unlock();
 	return 0;
 error:
-	lock_stop_read( partition->lock );
+	rcu_read_unlock();
 	return -1;
 }
 
@@ -2351,8 +2619,8 @@ void ds_check_timer(unsigned int ticks, void* param)
 		if ( (*partition->data)->sets==NULL )
 			continue;
 
-		/* access ds data under reader's lock */
-		lock_start_read( partition->lock );
+		/* access ds data as RCU reader */
+		rcu_read_lock();
 
 		/* Iterate over the groups and the entries of each group: */
 		for( list=(*partition->data)->sets ; list!= NULL ; list= list->next)
@@ -2408,23 +2676,74 @@ void ds_check_timer(unsigned int ticks, void* param)
 			}
 		}
 
-		lock_stop_read( partition->lock );
+		rcu_read_unlock();
 	}
 }
 
 void ds_update_weights(unsigned int ticks, void *param)
 {
 	ds_partition_t *part;
-	ds_set_p sp;
+	ds_data_t *old_data, *new_data;
+	ds_set_p sp, osp;
+	int j;
 
 	for (part = partitions; part; part = part->next) {
+		/* the writer lock keeps the reloads and the state changes
+		 * away while the copy is done */
 		lock_start_write(part->lock);
-		for (sp = (*part->data)->sets; sp; sp = sp->next) {
-			if (sp->redo_weights) {
-				re_calculate_active_dsts(sp);
+
+		old_data = *part->data;
+		if (old_data == NULL) {
+			lock_stop_write(part->lock);
+			continue;
+		}
+
+		for (sp = old_data->sets; sp && !sp->redo_weights; sp = sp->next);
+		if (sp == NULL) {
+			lock_stop_write(part->lock);
+			continue;
+		}
+
+		/* the readers do not lock, so never change the weights in
+		 * place - work on a copy and publish it */
+		new_data = ds_clone_data(old_data);
+		if (new_data == NULL) {
+			lock_stop_write(part->lock);
+			LM_ERR("skipping the weights update for partition %.*s\n",
+				part->name.len, part->name.s);
+			continue;
+		}
+
+		for (sp = new_data->sets, osp = old_data->sets; sp;
+		sp = sp->next, osp = osp->next) {
+			if (!sp->redo_weights)
+				continue;
+
+			re_calculate_active_dsts(sp);
+
+			/* the failover table follows the weights, so redo it
+			 * if any of them changed */
+			for (j = 0; j < sp->nr &&
+				sp->dlist[j].weight == osp->dlist[j].weight; j++);
+			if (j == sp->nr)
+				continue;
+
+			if (sp->ring) {
+				shm_free(sp->ring);
+				sp->ring = NULL;
+				sp->ring_size = 0;
 			}
+			if (ds_build_ring(sp) != 0)
+				LM_ERR("failed to rebuild the hashing table of set %d\n",
+					sp->id);
 		}
+
+		*part->data = new_data;
+
 		lock_stop_write(part->lock);
+
+		/* a timer must not block, so let the old copy go later */
+		rcu_defer_free(old_data, ds_free_data_copy);
 	}
 }
 
@@ -2438,12 +2757,12 @@ int ds_count(struct sip_msg *msg, int set_id, const char *cmp, pv_spec_p ret,
 
 	LM_DBG("Searching for set: %d, filtering: %d\n", set_id, *cmp);
 
-	/* access ds data under reader's lock */
-	lock_start_read( partition->lock );
+	/* access ds data as RCU reader */
+	rcu_read_lock();
 
 	if ( ds_get_index( set_id, &set, partition)!=0 ) {
 		LM_ERR("INVALID SET %d (not found)!\n",set_id);
-		lock_stop_read( partition->lock );
+		rcu_read_unlock();
 		return -1;
 	}
 
@@ -2463,7 +2782,7 @@ int ds_count(struct sip_msg *msg, int set_id, const char *cmp, pv_spec_p ret,
 		}
 	}
 
-	lock_stop_read( partition->lock );
+	rcu_read_unlock();
 
 	switch (*cmp)
 	{
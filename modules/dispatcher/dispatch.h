@@ -107,13 +107,26 @@ typedef struct _ds_set
 	int last;			/* last used item in dst set */
 	int redo_weights;   /* whether at least one item has dynamic weight */
 	ds_dest_p dlist;
+	unsigned short *ring;     /* consistent hashing table, for failover */
+	unsigned int ring_size;
 	struct _ds_set *next;
 } ds_set_t, *ds_set_p;
 
+/* an IP of a destination, as hooked in the IP index of the data */
+typedef struct _ds_ip_entry
+{
+	ds_set_p set;
+	ds_dest_p dst;
+	unsigned short idx;       /* position in the dst->ips[] array */
+	struct _ds_ip_entry *next;
+} ds_ip_entry_t, *ds_ip_entry_p;
+
 typedef struct _ds_data
 {
 	ds_set_t *sets;
 	unsigned int sets_no;
+	ds_ip_entry_p *ip_hash;   /* all the IPs of all the destinations */
+	unsigned int ip_hash_size;
 } ds_data_t;
 
 typedef struct _ds_pvar_param
@@ -132,7 +145,7 @@ typedef struct _ds_partition
 	db_con_t **db_handle;
 	db_func_t dbf;
 	ds_data_t **data;      /* dispatching data holder */
-	rw_lock_t *lock;       /* reader-writers lock for reloading the data */
+	rw_lock_t *lock;       /* serializes the data writers - readers use RCU */
 
 	int dst_avp_name;
 	unsigned short dst_avp_type;
@@ -214,6 +227,11 @@ int ds_reload_db(ds_partition_t *partition);
 int init_ds_data(ds_partition_t *partition);
 void ds_destroy_data(ds_partition_t *partition);
 
+/* selection structures of a set */
+int ds_build_ring(ds_set_p sp);
+int ds_ring_lookup(ds_set_p sp, unsigned int hash, int set_size);
+int ds_weight_lookup(ds_set_p idx, unsigned int w, int set_size);
+
 int ds_update_dst(struct sip_msg *msg, str *uri, struct socket_info *sock, int mode);
 int ds_select_dst(struct sip_msg *msg, ds_select_ctl_p ds_select_ctl, ds_selected_dst_p selected_dst, int ds_flags);
 int ds_next_dst(struct sip_msg *msg, int mode, ds_partition_t *partition);
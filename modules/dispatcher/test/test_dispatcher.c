@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../../../str.h"
+#include "../../../mem/shm_mem.h"
+
+#include "../dispatch.h"
+
+#define TEST_HASHES		100000
+#define BENCH_PICKS		1000000
+
+static unsigned int seed = 42;
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static ds_set_p new_set(int nr)
+{
+	ds_set_p sp;
+	char *uris;
+	int j;
+
+	sp = shm_malloc(sizeof *sp + nr * sizeof(ds_dest_t) + nr * 32);
+	if (!sp)
+		return NULL;
+	memset(sp, 0, sizeof *sp + nr * sizeof(ds_dest_t));
+
+	sp->nr = sp->active_nr = nr;
+	sp->dlist = (ds_dest_p)(sp + 1);
+	uris = (char *)(sp->dlist + nr);
+
+	for (j = 0; j < nr; j++) {
+		sp->dlist[j].uri.s = uris + 32 * j;
+		sp->dlist[j].uri.len = sprintf(sp->dlist[j].uri.s,
+			"sip:10.0.%d.%d:5060", j / 256, j % 256);
+		sp->dlist[j].weight = 1 + rand_r(&seed) % 4;
+		sp->dlist[j].running_weight = sp->dlist[j].weight +
+			(j ? sp->dlist[j - 1].running_weight : 0);
+	}
+
+	if (ds_build_ring(sp) != 0 || !sp->ring) {
+		shm_free(sp);
+		return NULL;
+	}
+
+	return sp;
+}
+
+static void free_set(ds_set_p sp)
+{
+	shm_free(sp->ring);
+	shm_free(sp);
+}
+
+/* every destination gets its weight's share of the table */
+static int check_ring_shares(ds_set_p sp)
+{
+	unsigned int *slots, k, total;
+	int j, bad = 0;
+	double exp;
+
+	slots = calloc(sp->nr, sizeof *slots);
+	if (!slots)
+		return -1;
+
+	for (k = 0; k < sp->ring_size; k++) {
+		if (sp->ring[k] >= sp->nr) {
+			free(slots);
+			return -1;
+		}
+		slots[sp->ring[k]]++;
+	}
+
+	total = sp->dlist[sp->nr - 1].running_weight;
+	for (j = 0; j < sp->nr; j++) {
+		exp = (double)sp->ring_size * sp->dlist[j].weight / total;
+		if (slots[j] < exp * 0.9 - 2 || slots[j] > exp * 1.1 + 2)
+			bad++;
+	}
+
+	free(slots);
+	return bad ? -1 : 0;
+}
+
+/* when a destination fails, only its own hashes move, and they spread
+ * over the other destinations */
+static int check_ring_failover(ds_set_p sp)
+{
+	static int before[TEST_HASHES];
+	unsigned int h, *got;
+	int i, j, failed, moved = 0, bad = 0, spread = 0;
+
+	for (h = 0; h < TEST_HASHES; h++)
+		before[h] = ds_ring_lookup(sp, h * 2654435761u, sp->nr);
+
+	failed = rand_r(&seed) % sp->nr;
+	sp->dlist[failed].flags |= DS_INACTIVE_DST;
+
+	got = calloc(sp->nr, sizeof *got);
+	if (!got)
+		return -1;
+
+	for (h = 0; h < TEST_HASHES; h++) {
+		i = ds_ring_lookup(sp, h * 2654435761u, sp->nr);
+		if (i < 0 || i == failed || (before[h] != failed && i != before[h]))
+			bad++;
+		if (before[h] == failed) {
+			moved++;
+			got[i]++;
+		}
+	}
+
+	for (j = 0; j < sp->nr; j++)
+		if (got[j])
+			spread++;
+
+	sp->dlist[failed].flags &= ~DS_INACTIVE_DST;
+	free(got);
+
+	/* a share of a few hundred hashes must reach most of the others */
+	if (bad || (moved > 20 * sp->nr && spread < (sp->nr - 1) * 3 / 4)) {
+		diag("dispatcher: %d bad lookups, %d moved hashes went to %d of "
+			"%d destinations", bad, moved, spread, sp->nr - 1);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int check_weight_lookup(ds_set_p sp)
+{
+	unsigned int w;
+	int j;
+
+	for (w = 0; w < sp->dlist[sp->nr - 1].running_weight; w++) {
+		for (j = 0; j < sp->nr; j++)
+			if (w < sp->dlist[j].running_weight)
+				break;
+		if (ds_weight_lookup(sp, w, sp->nr) != j)
+			return -1;
+	}
+
+	return 0;
+}
+
+static void bench_set(ds_set_p sp)
+{
+	unsigned long long start, ring_ns, bin_ns, lin_ns;
+	unsigned long sum = 0;
+	unsigned int total, w;
+	int i, j;
+
+	total = sp->dlist[sp->nr - 1].running_weight;
+	sp->dlist[0].flags |= DS_INACTIVE_DST;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PICKS; i++)
+		sum += ds_ring_lookup(sp, i * 2654435761u, sp->nr);
+	ring_ns = (now_ns() - start) / BENCH_PICKS;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PICKS; i++)
+		sum += ds_weight_lookup(sp, (i * 2654435761u) % total, sp->nr);
+	bin_ns = (now_ns() - start) / BENCH_PICKS;
+
+	/* the weighted pick as it used to be */
+	start = now_ns();
+	for (i = 0; i < BENCH_PICKS; i++) {
+		w = (i * 2654435761u) % total;
+		for (j = 0; j < sp->nr; j++)
+			if (w < sp->dlist[j].running_weight)
+				break;
+		sum += j;
+	}
+	lin_ns = (now_ns() - start) / BENCH_PICKS;
+
+	sp->dlist[0].flags &= ~DS_INACTIVE_DST;
+
+	ok(sum > 0, "dispatcher: %d destinations - hash failover %llu ns, "
+		"weighted pick %llu ns (linear scan %llu ns)", sp->nr, ring_ns,
+		bin_ns, lin_ns);
+}
+
+void mod_tests(void)
+{
+	static int sizes[] = {10, 100, 1000, 0};
+	ds_set_p sp;
+	int i;
+
+	for (i = 0; sizes[i]; i++) {
+		sp = new_set(sizes[i]);
+		if (!ok(sp != NULL, "dispatcher: build a set of %d destinations",
+		        sizes[i]))
+			continue;
+
+		ok(check_ring_shares(sp) == 0, "dispatcher: %d destinations - the "
+			"table is shared by weight", sizes[i]);
+		ok(check_ring_failover(sp) == 0, "dispatcher: %d destinations - a "
+			"failure only moves its own hashes", sizes[i]);
+		ok(check_weight_lookup(sp) == 0, "dispatcher: %d destinations - the "
+			"weighted pick matches the linear scan", sizes[i]);
+
+		bench_set(sp);
+		free_set(sp);
+	}
+}
@@ -634,6 +634,15 @@ rt_data_t* dr_load_routing_info(struct head_db *current_partition
 
 	LM_DBG("%d total records loaded from table %.*s\n", n,
 			drr_table->len, drr_table->s);
+
+	/* pack the prefix tree for the lookups; the building tree is
+	 * released, so only the packed one stays in memory */
+	if ( (rdata->pt_idx=build_ptree_idx(rdata->pt))==NULL ) {
+		LM_ERR("failed to pack the prefix tree\n");
+		goto error;
+	}
+	rdata->pt = NULL;
+
 	return rdata;
 error:
 	if (res)
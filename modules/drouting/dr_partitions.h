@@ -37,6 +37,7 @@
 #include "../../mem/mem.h"
 #include "../../mem/shm_mem.h"
 #include "../../rw_locking.h"
+#include "../../rcu.h"
 #include "../../action.h"
 #include "../../error.h"
 #include "../../ut.h"
@@ -76,7 +77,7 @@ struct head_db {
 	int rule_attrs_avp;
 	int carrier_attrs_avp;
 	rt_data_t **rdata;
-	rw_lock_t *ref_lock;
+	rw_lock_t *ref_lock; /* serializes the reloads - readers use RCU */
 	int ongoing_reload;
 	struct head_db *next;
 };
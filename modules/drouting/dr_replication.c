@@ -125,7 +125,7 @@ static int gw_status_update(bin_packet_t *packet)
 	if (part==NULL)
 		return -1;
 
-	lock_start_read(part->ref_lock);
+	rcu_read_lock();
 
 	gw = get_gw_by_id( (*part->rdata)->pgw_tree, &gw_id);
 	if (gw && ((gw->flags&DR_DST_STAT_MASK)!=flags)) {
@@ -135,11 +135,11 @@ static int gw_status_update(bin_packet_t *packet)
 		gw->flags |= DR_DST_STAT_DIRT_FLAG;
 		/* raise event for the status change */
 		dr_raise_event(part, gw);
-		lock_stop_read(part->ref_lock);
+		rcu_read_unlock();
 		return 0;
 	}
 
-	lock_stop_read(part->ref_lock);
+	rcu_read_unlock();
 
 	return -1;
 }
@@ -161,7 +161,7 @@ static int cr_status_update(bin_packet_t *packet)
 	if (part==NULL)
 		return -1;
 
-	lock_start_read(part->ref_lock);
+	rcu_read_lock();
 
 	cr = get_carrier_by_id( (*part->rdata)->carriers_tree, &cr_id);
 	if (cr && ((cr->flags&DR_CR_FLAG_IS_OFF)!=flags)) {
@@ -169,11 +169,11 @@ static int cr_status_update(bin_packet_t *packet)
 		cr->flags = ((~DR_CR_FLAG_IS_OFF)&cr->flags)|(DR_CR_FLAG_IS_OFF&flags);
 		/* set the DIRTY flag to force flushing to DB */
 		cr->flags |= DR_CR_FLAG_DIRTY;
-		lock_stop_read(part->ref_lock);
+		rcu_read_unlock();
 		return 0;
 	}
 
-	lock_stop_read(part->ref_lock);
+	rcu_read_unlock();
 
 	return -1;
 }
@@ -614,12 +614,12 @@ static int dr_disable_w_part(struct sip_msg *req, struct head_db *current_partit
 	int_str id_val;
 	pgw_t *gw;
 
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 	avp = search_first_avp( AVP_VAL_STR, current_partition->gw_id_avp, &id_val,0);
 	if (avp==NULL) {
 		LM_DBG(" no AVP ID ->nothing to disable\n");
-		lock_stop_read( current_partition->ref_lock );
+		rcu_read_unlock();
 		return -1;
 	}
 
@@ -631,7 +631,7 @@ static int dr_disable_w_part(struct sip_msg *req, struct head_db *current_partit
 		dr_gw_status_changed( current_partition, gw);
 	}
 
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 
 	return 1;
 }
@@ -659,7 +659,7 @@ static void dr_probing_callback( struct cell *t, int type,
 
 
 
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 	_id = ((param_prob_callback_t*)*ps->param)->_id;
 
@@ -686,7 +686,7 @@ static void dr_probing_callback( struct cell *t, int type,
 
 
 end:
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 
 	return;
 }
@@ -713,7 +713,7 @@ static void dr_prob_handler(unsigned int ticks, void* param)
 		if (it->rdata==NULL || *(it->rdata)==NULL)
 			return;
 
-		lock_start_read( it->ref_lock );
+		rcu_read_lock();
 
 		/* go through all destinations */
 		for (map_first( (*(it->rdata))->pgw_tree, &map_it);
@@ -769,7 +769,7 @@ static void dr_prob_handler(unsigned int ticks, void* param)
 
 		}
 
-		lock_stop_read( it->ref_lock );
+		rcu_read_unlock();
 		it = it->next;
 	}
 }
@@ -888,11 +888,11 @@ static void dr_state_timer(unsigned int ticks, void* param)
 	struct head_db * it;
 	it = head_db_start;
 	while( it!=NULL ) {
-		lock_start_read( it->ref_lock );
+		rcu_read_lock();
 
 		dr_state_flusher(it);
 
-		lock_stop_read( it->ref_lock );
+		rcu_read_unlock();
 		it = it->next;
 	}
 }
@@ -932,7 +932,7 @@ static inline int dr_reload_data_head( struct head_db *hd )
 
 	lock_start_write( hd->ref_lock );
 
-	/* no more activ readers -> do the swapping */
+	/* readers do not lock, so just do the swapping */
 	old_data = *(hd->rdata);
 	*(hd->rdata) = new_data;
 	/* update the time of the last reload for the current partition */
@@ -941,6 +941,9 @@ static inline int dr_reload_data_head( struct head_db *hd )
 
 	lock_stop_write( (hd->ref_lock) );
 
+	/* wait for the readers which may still see the old data */
+	rcu_synchronize();
+
 	/* destroy old data */
 	if (old_data) {
 		/* copy the state of gw/cr from old data */
@@ -2340,12 +2343,12 @@ static int use_next_gw_w_part(struct sip_msg* msg,
 		get_avp_val(avp, &val);
 
 		/* we have an ID, so we can check the GW state */
-		lock_start_read( current_partition->ref_lock );
+		rcu_read_lock();
 		dst = get_gw_by_id( (*current_partition->rdata)->pgw_tree, &val.s);
 		if (dst && (dst->flags & DR_DST_STAT_DSBL_FLAG) == 0)
 			ok = 1;
 
-		lock_stop_read( current_partition->ref_lock );
+		rcu_read_unlock();
 
 		if ( ok )
 			break;
@@ -2813,7 +2816,7 @@ static int do_routing(struct sip_msg* msg, dr_part_group_t * part_group,
 			grp_id,rule_idx,username.len,username.s);
 
 	/* ref the data for reading */
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 search_again:
 
@@ -2832,7 +2835,7 @@ search_again:
 	}
 
 	/* search a prefix */
-	rt_info = get_prefix( (*(current_partition->rdata))->pt, &username,
+	rt_info = get_prefix_idx( (*(current_partition->rdata))->pt_idx, &username,
 			(unsigned int)grp_id,&prefix_len, &rule_idx);
 
 	if (flags & DR_PARAM_STRICT_LEN) {
@@ -3065,7 +3068,7 @@ no_gws:
 	}
 
 	/* we are done reading -> unref the data */
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 
 	/* prepare/update data for fallback */
 	if ( flags & DR_PARAM_RULE_FALLBACK ) {
@@ -3141,7 +3144,7 @@ no_gws:
 error2:
 	if (wl_list) pkg_free(wl_list);
 	/* we are done reading -> unref the data */
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 error1:
 	if (ruri_buf) pkg_free(ruri_buf);
 	return ret;
@@ -3228,7 +3231,7 @@ static int route2_carrier(struct sip_msg* msg, char* part_carrier,
 	}
 
 	/* ref the data for reading */
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 	cr = get_carrier_by_id( (*current_partition->rdata)->carriers_tree, &id );
 	if (cr==NULL) {
@@ -3316,13 +3319,13 @@ static int route2_carrier(struct sip_msg* msg, char* part_carrier,
 no_gws:
 
 	/* we are done reading -> unref the data */
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 	if (ruri_buf) pkg_free(ruri_buf);
 
 	return 1;
 error:
 	/* we are done reading -> unref the data */
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 error_free:
 	if (ruri_buf) pkg_free(ruri_buf);
 	return -1;
@@ -3402,7 +3405,7 @@ static int route2_gw(struct sip_msg* msg, char* ch_part_gw, char* gw_att_pv)
 	}
 
 	/* ref the data for reading */
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 
 	idx = 0;
@@ -3417,7 +3420,7 @@ static int route2_gw(struct sip_msg* msg, char* ch_part_gw, char* gw_att_pv)
 		str_trim_spaces_lr(id);
 		if (id.len<=0) {
 			LM_ERR("empty slot\n");
-			lock_stop_read( current_partition->ref_lock );
+			rcu_read_unlock();
 			return -1;
 		} else {
 			LM_DBG("found and looking for gw id <%.*s>,len=%d\n",id.len, id.s, id.len);
@@ -3438,7 +3441,7 @@ static int route2_gw(struct sip_msg* msg, char* ch_part_gw, char* gw_att_pv)
 	} while(ids.len>0);
 
 	/* we are done reading -> unref the data */
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 
 	if ( idx==0 ) {
 		LM_ERR("no GW added at all\n");
@@ -4404,7 +4407,7 @@ static struct mi_root* mi_dr_gw_status(struct mi_root *cmd, void *param)
 	if( (rpl_tree = mi_w_partition(&node, &current_partition))!=NULL )
 		return rpl_tree; /* something went wrong: bad command format */
 
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 	if (current_partition->rdata==NULL || *current_partition->rdata==NULL) {
 		rpl_tree = init_mi_tree( 404, MI_SSTR("No Data available yet"));
@@ -4516,10 +4519,10 @@ static struct mi_root* mi_dr_gw_status(struct mi_root *cmd, void *param)
 	rpl_tree = init_mi_tree( 200, MI_OK_S, MI_OK_LEN);
 
 done:
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 	return rpl_tree;
 error:
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 	if(rpl_tree) free_mi_tree(rpl_tree);
 	return NULL;
 }
@@ -4546,7 +4549,7 @@ static struct mi_root* mi_dr_cr_status(struct mi_root *cmd, void *param)
 		return rpl_tree;
 	}
 
-	lock_start_read( current_partition->ref_lock );
+	rcu_read_lock();
 
 	if (current_partition->rdata==NULL || *current_partition->rdata==NULL) {
 		rpl_tree = init_mi_tree( 404, MI_SSTR("No Data available yet"));
@@ -4633,10 +4636,10 @@ static struct mi_root* mi_dr_cr_status(struct mi_root *cmd, void *param)
 	rpl_tree = init_mi_tree( 200, MI_OK_S, MI_OK_LEN);
 
 done:
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 	return rpl_tree;
 error:
-	lock_stop_read( current_partition->ref_lock );
+	rcu_read_unlock();
 	if(rpl_tree) free_mi_tree(rpl_tree);
 	return NULL;
 }
@@ -4892,6 +4895,7 @@ static struct mi_root* mi_dr_number_routing(struct mi_root *cmd_tree, void *para
 	str s;
 	int grp_id;
 	unsigned int matched_len;
+	unsigned int rule_idx = 0;
 	struct mi_node *prefix_node;
 	rt_info_t *route;
 
@@ -4922,17 +4926,23 @@ static struct mi_root* mi_dr_number_routing(struct mi_root *cmd_tree, void *para
 		node = node->next;
 	}
 
-	lock_start_read( partition->ref_lock );
-	route = find_rule_by_prefix_unsafe((*(partition->rdata))->pt,
-			&(*(partition->rdata))->noprefix, node->value, grp_id, &matched_len);
+	rcu_read_lock();
+	route = get_prefix_idx((*(partition->rdata))->pt_idx, &node->value,
+			grp_id, &matched_len, &rule_idx);
+	if (route == NULL) {
+		LM_DBG("no matching for prefix \"%.*s\"\n",
+				node->value.len, node->value.s);
+		/* try prefixless rules */
+		route = check_rt( &(*(partition->rdata))->noprefix, grp_id);
+	}
 	if (route == NULL){
-		lock_stop_read( partition->ref_lock );
+		rcu_read_unlock();
 		return init_mi_tree(200, MI_OK_S, MI_OK_LEN);
 	}
 
 	struct mi_root* rpl_tree = init_mi_tree(200, MI_OK_S, MI_OK_LEN);
 	if (rpl_tree == NULL){
-		lock_stop_read( partition->ref_lock );
+		rcu_read_unlock();
 		return 0;
 	}
 
@@ -4945,7 +4955,7 @@ static struct mi_root* mi_dr_number_routing(struct mi_root *cmd_tree, void *para
 	if ((prefix_node = add_mi_node_child(&rpl_tree->node, 0, matched_str.s,
 		matched_str.len, node->value.s, matched_len)) == NULL) {
 		LM_ERR("failed to add node\n");
-		lock_stop_read( partition->ref_lock );
+		rcu_read_unlock();
 		free_mi_tree(rpl_tree);
 		return 0;
 	}
@@ -4966,12 +4976,12 @@ static struct mi_root* mi_dr_number_routing(struct mi_root *cmd_tree, void *para
 					chosen_desc.len, chosen_id.s, chosen_id.len) == NULL) {
 
 			LM_ERR("failed to add node\n");
-			lock_stop_read( partition->ref_lock );
+			rcu_read_unlock();
 			free_mi_tree(rpl_tree);
 			return 0;
 		}
 	}
-	lock_stop_read( partition->ref_lock );
+	rcu_read_unlock();
 
 	return rpl_tree;
 }
@@ -4994,7 +5004,7 @@ static struct mi_root* mi_dr_reload_status(struct mi_root *cmd_tree, void *param
 				return init_mi_tree(400, MI_BAD_PARM_S, MI_BAD_PARM_LEN);
 			}
 			/* display just for given partition */
-			lock_start_read(partition->ref_lock);
+			rcu_read_lock();
 			ch_time = ctime(&partition->time_last_update);
 			if((ans = add_mi_node_child(&rpl_tree->node, MI_DUP_VALUE,
 						MI_PART_NAME_S, MI_PART_NAME_LEN, partition->partition.s,
@@ -5007,7 +5017,7 @@ static struct mi_root* mi_dr_reload_status(struct mi_root *cmd_tree, void *param
 				LM_ERR("failed to add mi_attr\n");
 				goto error;
 			}
-			lock_stop_read(partition->ref_lock);
+			rcu_read_unlock();
 		} else {
 			return init_mi_tree(400, MI_NO_PART_S, MI_NO_PART_LEN);
 		}
@@ -5017,7 +5027,7 @@ static struct mi_root* mi_dr_reload_status(struct mi_root *cmd_tree, void *param
 
 		/* display for all partitions */
 		for(partition = head_db_start; partition; partition = partition->next) {
-			lock_start_read(partition->ref_lock);
+			rcu_read_lock();
 			ch_time = ctime(&partition->time_last_update);
 			LM_DBG("partition  %.*s was last updated:%s\n",
 					partition->partition.len, partition->partition.s,
@@ -5033,26 +5043,26 @@ static struct mi_root* mi_dr_reload_status(struct mi_root *cmd_tree, void *param
 				LM_ERR("failed to add attr to mi_node\n");
 				goto error;
 			}
-			lock_stop_read(partition->ref_lock);
+			rcu_read_unlock();
 		}
 	}
 	else {
 		/* just one partition */
 		partition = head_db_start;
 
-		lock_start_read(partition->ref_lock);
+		rcu_read_lock();
 		ch_time = ctime(&partition->time_last_update);
 		if((ans = add_mi_node_child(&rpl_tree->node, 0, MI_LAST_UPDATE_S,
 						MI_LAST_UPDATE_LEN, ch_time, strlen(ch_time))) == NULL) {
 			LM_ERR("failed to add mi_node\n");
 			goto error;
 		}
-		lock_stop_read(partition->ref_lock);
+		rcu_read_unlock();
 
 	}
 	return rpl_tree;
 error:
-	lock_stop_read(partition->ref_lock);
+	rcu_read_unlock();
 	free_mi_tree(rpl_tree);
 	return 0;
 }
@@ -69,21 +69,16 @@ check_time(
 
 
 static inline rt_info_t*
-internal_check_rt(
-		ptree_node_t *ptn,
+internal_check_rg(
+		rg_entry_t *rg,
+		int rg_pos,
 		unsigned int rgid,
 		unsigned int *rgidx
 		)
 {
 	int i,j;
-	int rg_pos=0;
-	rg_entry_t* rg=NULL;
 	rt_info_wrp_t* rtlw=NULL;
 
-	if((NULL==ptn) || (NULL==ptn->rg))
-		goto err_exit;
-	rg_pos = ptn->rg_pos;
-	rg=ptn->rg;
 	for(i=0;(i<rg_pos) && (rg[i].rgid!=rgid);i++);
 	if(i<rg_pos) {
 		LM_DBG("found rgid %d (rule list %p)\n",
@@ -98,7 +93,6 @@ internal_check_rt(
 			rtlw=rtlw->next;
 		}
 	}
-err_exit:
 	return NULL;
 
 ok_exit:
@@ -108,6 +102,20 @@ ok_exit:
 }
 
 
+static inline rt_info_t*
+internal_check_rt(
+		ptree_node_t *ptn,
+		unsigned int rgid,
+		unsigned int *rgidx
+		)
+{
+	if((NULL==ptn) || (NULL==ptn->rg))
+		return NULL;
+
+	return internal_check_rg( ptn->rg, ptn->rg_pos, rgid, rgidx);
+}
+
+
 rt_info_t*
 check_rt(
 	ptree_node_t *ptn,
@@ -182,6 +190,171 @@ err_exit:
 	return NULL;
 }
 
+rt_info_t*
+get_prefix_idx(
+	ptree_idx_t *idx,
+	str* prefix,
+	unsigned int rgid,
+	unsigned int *matched_len,
+	unsigned int *rgidx
+	)
+{
+	rt_info_t *rt = NULL;
+	ptree_cnode_t *n;
+	unsigned int len, d;
+
+	if(NULL == idx || NULL == prefix)
+		return NULL;
+
+	/* go the tree down to the last digit in the
+	 * prefix string or down to a leaf */
+	n = idx->nodes;
+	for( len=0 ; len<prefix->len && n->kids_mask ; len++ ) {
+		if( !IS_DECIMAL_DIGIT(prefix->s[len]) ) {
+			/* unknown character in the prefix string */
+			return NULL;
+		}
+		d = prefix->s[len] - '0';
+		if( !(n->kids_mask & (1<<d)) )
+			break;
+		n = &idx->nodes[n->kids +
+			__builtin_popcount(n->kids_mask & ((1<<d)-1))];
+	}
+
+	/* go in the tree up to the root trying to match the
+	 * prefix */
+	for( ; n!=idx->nodes ; n=&idx->nodes[n->bp], len-- ) {
+		if( n->rg_len && NULL != (rt = internal_check_rg( idx->rg + n->rg,
+		n->rg_len, rgid, rgidx)) )
+			break;
+	}
+
+	if (matched_len) *matched_len = len;
+	return rt;
+}
+
+
+static void
+count_ptree(
+	ptree_t *t,
+	unsigned int *nodes_no,
+	unsigned int *rg_no
+	)
+{
+	int i;
+
+	for(i=0; i<PTREE_CHILDREN; i++) {
+		if( t->ptnode[i].rg==NULL && t->ptnode[i].next==NULL )
+			continue;
+		(*nodes_no)++;
+		if( t->ptnode[i].rg )
+			*rg_no += t->ptnode[i].rg_pos;
+		if( t->ptnode[i].next )
+			count_ptree( t->ptnode[i].next, nodes_no, rg_no);
+	}
+}
+
+
+/* lay out the children of node "n", found in "t", one after the other,
+ * then descend into each of them */
+static void
+pack_ptree(
+	ptree_idx_t *idx,
+	unsigned int n,
+	ptree_t *t
+	)
+{
+	ptree_cnode_t *c;
+	unsigned int k;
+	int i;
+
+	idx->nodes[n].kids = k = idx->nodes_no;
+	for(i=0; i<PTREE_CHILDREN; i++)
+		if( t->ptnode[i].rg || t->ptnode[i].next ) {
+			idx->nodes[n].kids_mask |= 1<<i;
+			idx->nodes_no++;
+		}
+
+	for(i=0; i<PTREE_CHILDREN; i++) {
+		if( t->ptnode[i].rg==NULL && t->ptnode[i].next==NULL )
+			continue;
+
+		c = &idx->nodes[k];
+		c->bp = n;
+		c->rg = idx->rg_no;
+		if( t->ptnode[i].rg ) {
+			c->rg_len = t->ptnode[i].rg_pos;
+			memcpy( idx->rg + idx->rg_no, t->ptnode[i].rg,
+				c->rg_len * sizeof(rg_entry_t));
+			idx->rg_no += c->rg_len;
+			/* the rule lists now belong to the packed tree */
+			memset( t->ptnode[i].rg, 0, c->rg_len * sizeof(rg_entry_t));
+		}
+		if( t->ptnode[i].next )
+			pack_ptree( idx, k, t->ptnode[i].next);
+		k++;
+	}
+}
+
+
+ptree_idx_t*
+build_ptree_idx(
+	ptree_t *ptree
+	)
+{
+	ptree_idx_t *idx;
+	unsigned int nodes_no = 1, rg_no = 0;
+
+	if(NULL==ptree) {
+		LM_ERR("ptree is null\n");
+		return NULL;
+	}
+
+	count_ptree( ptree, &nodes_no, &rg_no);
+
+	idx = (ptree_idx_t*)shm_malloc( sizeof(ptree_idx_t) +
+		nodes_no*sizeof(ptree_cnode_t) + rg_no*sizeof(rg_entry_t));
+	if (NULL==idx) {
+		LM_ERR("no more shm mem for the packed tree (%u nodes, %u groups)\n",
+			nodes_no, rg_no);
+		return NULL;
+	}
+	memset( idx, 0, sizeof(ptree_idx_t) + nodes_no*sizeof(ptree_cnode_t));
+	idx->nodes = (ptree_cnode_t*)(idx + 1);
+	idx->rg = (rg_entry_t*)(idx->nodes + nodes_no);
+
+	/* the root is the only node with no digit */
+	idx->nodes_no = 1;
+	pack_ptree( idx, 0, ptree);
+
+	LM_DBG("packed prefix tree: %u nodes, %u groups, %lu bytes\n",
+		idx->nodes_no, idx->rg_no, (unsigned long)(sizeof(ptree_idx_t) +
+		nodes_no*sizeof(ptree_cnode_t) + rg_no*sizeof(rg_entry_t)));
+
+	del_tree(ptree);
+
+	return idx;
+}
+
+
+void
+del_ptree_idx(
+	ptree_idx_t *idx
+	)
+{
+	unsigned int i;
+
+	if(NULL == idx)
+		return;
+
+	for(i=0; i<idx->rg_no; i++)
+		if(idx->rg[i].rtlw != NULL)
+			del_rt_list(idx->rg[i].rtlw);
+
+	shm_free(idx);
+}
+
+
 pgw_t*
 get_gw_by_internal_id(
 		map_t gw_tree,
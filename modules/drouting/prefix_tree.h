@@ -162,6 +162,29 @@ typedef struct ptree_ {
 	ptree_node_t ptnode[PTREE_CHILDREN];
 } ptree_t;
 
+/* node of the packed (read-only) form of a prefix tree */
+typedef struct ptree_cnode_ {
+	/* index of the parent node */
+	unsigned int bp;
+	/* index of the first child - the children are stored one after
+	 * the other, in the order of their digits */
+	unsigned int kids;
+	/* digits having a child node */
+	unsigned short kids_mask;
+	/* routing groups of the node, as a slice of the rg array */
+	unsigned int rg_len;
+	unsigned int rg;
+} ptree_cnode_t;
+
+/* packed prefix tree - nodes and routing groups in a single shm chunk,
+ * nodes[0] being the root (the empty prefix) */
+typedef struct ptree_idx_ {
+	unsigned int nodes_no;
+	unsigned int rg_no;
+	ptree_cnode_t *nodes;
+	rg_entry_t *rg;
+} ptree_idx_t;
+
 void
 print_interim(
 		int,
@@ -192,6 +215,27 @@ get_prefix(
 	unsigned int *matched_len
 	);
 
+/* pack the tree; on success, the tree is released and its routing
+ * info is moved into the packed one */
+ptree_idx_t*
+build_ptree_idx(
+	ptree_t *ptree
+	);
+
+rt_info_t*
+get_prefix_idx(
+	ptree_idx_t *idx,
+	str* prefix,
+	unsigned int rgid,
+	unsigned int *matched_len,
+	unsigned int *rgidx
+	);
+
+void
+del_ptree_idx(
+	ptree_idx_t *idx
+	);
+
 int
 add_rt_info(
 	ptree_node_t*,
@@ -667,6 +667,8 @@ free_rt_data(
 		/* del prefix tree */
 		del_tree(rt_data->pt);
 		rt_data->pt = 0 ;
+		del_ptree_idx(rt_data->pt_idx);
+		rt_data->pt_idx = 0 ;
 		/* del prefixless rules */
 		if(NULL!=rt_data->noprefix.rg) {
 			for(j=0;j<rt_data->noprefix.rg_pos;j++) {
@@ -61,8 +61,10 @@ typedef struct rt_data_ {
 
 	/* default routing list for prefixless rules */
 	ptree_node_t noprefix;
-	/* tree with routing prefixes */
+	/* tree with routing prefixes, only used while loading */
 	ptree_t *pt;
+	/* packed form of the tree, used for the lookups */
+	ptree_idx_t *pt_idx;
 }rt_data_t;
 
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../../../str.h"
+#include "../../../mem/shm_mem.h"
+
+#include "../prefix_tree.h"
+
+#define TEST_PREFIXES	200000
+#define TEST_LOOKUPS	100000
+#define TEST_GROUPS		4
+#define NUMBER_LEN		11
+
+static unsigned int seed = 42;
+
+static char prefix_buf[TEST_PREFIXES][NUMBER_LEN];
+static str prefixes[TEST_PREFIXES];
+static char number_buf[TEST_LOOKUPS][NUMBER_LEN];
+static str numbers[TEST_LOOKUPS];
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void gen_numbers(void)
+{
+	str *p;
+	int i, j, len;
+
+	for (i = 0; i < TEST_PREFIXES; i++) {
+		len = 2 + rand_r(&seed) % 9;
+		for (j = 0; j < len; j++)
+			prefix_buf[i][j] = '0' + rand_r(&seed) % 10;
+		prefixes[i].s = prefix_buf[i];
+		prefixes[i].len = len;
+	}
+
+	/* most of the numbers start with a known prefix */
+	for (i = 0; i < TEST_LOOKUPS; i++) {
+		j = 0;
+		if (rand_r(&seed) % 8) {
+			p = &prefixes[rand_r(&seed) % TEST_PREFIXES];
+			memcpy(number_buf[i], p->s, p->len);
+			j = p->len;
+		}
+		for (; j < NUMBER_LEN; j++)
+			number_buf[i][j] = '0' + rand_r(&seed) % 10;
+		numbers[i].s = number_buf[i];
+		numbers[i].len = NUMBER_LEN;
+	}
+}
+
+/* shm taken by the digit nodes and the routing group arrays */
+static unsigned long tree_mem(ptree_t *t)
+{
+	unsigned long size = sizeof(ptree_t);
+	int i;
+
+	for (i = 0; i < PTREE_CHILDREN; i++) {
+		size += t->ptnode[i].rg_len * sizeof(rg_entry_t);
+		if (t->ptnode[i].next)
+			size += tree_mem(t->ptnode[i].next);
+	}
+
+	return size;
+}
+
+static ptree_t *build_tree(rt_info_t **rules)
+{
+	ptree_t *tree;
+	int i;
+
+	tree = shm_malloc(sizeof *tree);
+	if (!tree)
+		return NULL;
+	memset(tree, 0, sizeof *tree);
+
+	for (i = 0; i < TEST_PREFIXES; i++)
+		if (add_prefix(tree, &prefixes[i], rules[i],
+		        rand_r(&seed) % TEST_GROUPS) < 0) {
+			del_tree(tree);
+			return NULL;
+		}
+
+	return tree;
+}
+
+void mod_tests(void)
+{
+	static rt_info_t *rules[TEST_PREFIXES];
+	ptree_t *tree, *ptree;
+	ptree_idx_t *idx;
+	rt_info_t *rt, *prt;
+	unsigned long long start, load_ns, pack_ns, look_ns, plook_ns;
+	unsigned long mem, pmem;
+	unsigned int len, plen, rgidx, prgidx, rgid;
+	unsigned int tree_seed;
+	int i, bad = 0;
+
+	gen_numbers();
+
+	for (i = 0; i < TEST_PREFIXES; i++) {
+		rules[i] = shm_malloc(sizeof(rt_info_t));
+		if (!rules[i])
+			return;
+		memset(rules[i], 0, sizeof(rt_info_t));
+		rules[i]->id = i;
+		rules[i]->priority = rand_r(&seed) % 4;
+	}
+
+	/* two trees with the same rules, one of them gets packed */
+	tree_seed = seed;
+	start = now_ns();
+	tree = build_tree(rules);
+	load_ns = now_ns() - start;
+
+	seed = tree_seed;
+	ptree = build_tree(rules);
+	if (!ok(tree && ptree, "drouting: load %d prefixes", TEST_PREFIXES))
+		return;
+
+	mem = tree_mem(ptree);
+
+	start = now_ns();
+	idx = build_ptree_idx(ptree);
+	pack_ns = now_ns() - start;
+	if (!ok(idx != NULL, "drouting: pack the prefix tree")) {
+		del_tree(ptree);
+		del_tree(tree);
+		return;
+	}
+
+	pmem = sizeof(ptree_idx_t) + idx->nodes_no * sizeof(ptree_cnode_t) +
+		idx->rg_no * sizeof(rg_entry_t);
+
+	for (i = 0; i < TEST_LOOKUPS; i++) {
+		rgid = i % TEST_GROUPS;
+		rgidx = prgidx = 0;
+		len = plen = 0;
+
+		/* walk all the rules the fallback would try, in order */
+		do {
+			rt = get_prefix(tree, &numbers[i], rgid, &len, &rgidx);
+			prt = get_prefix_idx(idx, &numbers[i], rgid, &plen, &prgidx);
+			if (rt != prt || (rt && (len != plen || rgidx != prgidx))) {
+				bad++;
+				break;
+			}
+		} while (rt && rgidx);
+	}
+	ok(bad == 0, "drouting: the packed tree finds the same rules");
+
+	start = now_ns();
+	for (i = 0; i < TEST_LOOKUPS; i++) {
+		rgidx = 0;
+		get_prefix(tree, &numbers[i], i % TEST_GROUPS, &len, &rgidx);
+	}
+	look_ns = (now_ns() - start) / TEST_LOOKUPS;
+
+	start = now_ns();
+	for (i = 0; i < TEST_LOOKUPS; i++) {
+		rgidx = 0;
+		get_prefix_idx(idx, &numbers[i], i % TEST_GROUPS, &len, &rgidx);
+	}
+	plook_ns = (now_ns() - start) / TEST_LOOKUPS;
+
+	ok(1, "drouting: %d prefixes - load %llu ms, pack %llu ms", TEST_PREFIXES,
+		load_ns / 1000000, pack_ns / 1000000);
+	ok(pmem < mem, "drouting: bytes per prefix - tree %lu, packed %lu",
+		mem / TEST_PREFIXES, pmem / TEST_PREFIXES);
+	ok(1, "drouting: lookup - tree %llu ns, packed %llu ns",
+		look_ns, plook_ns);
+
+	del_ptree_idx(idx);
+	del_tree(tree);
+}
@@ -41,6 +41,7 @@
 #include "../../parser/parse_from.h"
 #include "../../mod_fix.h"
 #include "../../resolve.h"
+#include "../../rcu.h"
 
 #include "permissions.h"
 #include "hash.h"
@@ -72,7 +73,7 @@ int reload_address_table(struct pm_part_struct *part_struct)
 	db_val_t* val;
 
 	struct address_list **new_hash_table;
-	struct subnet *new_subnet_table;
+	struct subnet_table *new_subnet_table;
 	int i, mask, proto, group, port, id;
     struct ip_addr *ip_addr;
 	struct net *subnet;
@@ -101,6 +102,10 @@ int reload_address_table(struct pm_part_struct *part_struct)
 		return -1;
 	}
 
+	/* readers do not lock - make sure none of them is still
+	 * walking through the tables we are about to empty */
+	rcu_synchronize();
+
 	/* Choose new hash table and free its old contents */
 	if (*part_struct->hash_table == part_struct->hash_table_1) {
 		empty_hash(part_struct->hash_table_2);
@@ -267,6 +272,11 @@ int reload_address_table(struct pm_part_struct *part_struct)
 
 	part_struct->perm_dbf.free_result(part_struct->db_handle, res);
 
+	if (subnet_table_index(new_subnet_table) < 0) {
+		LM_ERR("failed to index the subnet table\n");
+		return -1;
+	}
+
 	*part_struct->hash_table = new_hash_table;
 	*part_struct->subnet_table = new_subnet_table;
 	LM_DBG("address table reloaded successfully.\n");
@@ -347,7 +357,8 @@ int init_address(struct pm_partition *partition)
     part_struct->subnet_table_2 = new_subnet_table();
     if (!part_struct->subnet_table_2) goto error;
 
-	part_struct->subnet_table = (struct subnet **)shm_malloc(sizeof(struct subnet *));
+	part_struct->subnet_table = (struct subnet_table **)shm_malloc(
+		sizeof(struct subnet_table *));
 	if (!part_struct->subnet_table) goto error;
 
 	*part_struct->subnet_table = part_struct->subnet_table_1;
@@ -565,6 +576,7 @@ int check_addr_6(struct sip_msg* msg,
 	LM_DBG("Looking for : <%d, %.*s, %.*s, %d, %s>\n", group, str_ip.len,
 			str_ip.s, str_proto.len, str_proto.s, port, ZSW(pattern) );
 
+	rcu_read_lock();
 	hash_ret = hash_match(msg, *part_struct->hash_table, group, ip, port,
 				proto, pattern, info);
 	if (hash_ret < 0) {
@@ -572,6 +584,7 @@ int check_addr_6(struct sip_msg* msg,
 				ip, port, proto, pattern, info);
 	    ret = (hash_ret > subnet_ret) ? hash_ret : subnet_ret;
 	}
+	rcu_read_unlock();
 
 	if (pattern)
 		pkg_free(pattern);
@@ -678,6 +691,7 @@ int check_src_addr_3(struct sip_msg *msg,
 		pattern[pattern_s.len] = 0;
 	}
 
+	rcu_read_lock();
 	hash_ret = hash_match(msg, *part_struct->hash_table, group,
 				ip,
 				msg->rcv.src_port,
@@ -693,6 +707,7 @@ int check_src_addr_3(struct sip_msg *msg,
 				info);
             ret = (hash_ret > subnet_ret) ? hash_ret : subnet_ret;
         }
+	rcu_read_unlock();
 
 	if (pattern)
 		pkg_free(pattern);
@@ -755,6 +770,7 @@ int get_source_group(struct sip_msg* msg, char *arg) {
 
 	ip = str2ip(&str_ip);
 
+	rcu_read_lock();
 	group = find_group_in_hash_table(*ps->hash_table,
 				ip,
 				msg->rcv.src_port);
@@ -766,11 +782,13 @@ int get_source_group(struct sip_msg* msg, char *arg) {
 		group = find_group_in_subnet_table(*ps->subnet_table,
 				ip,
 				msg->rcv.src_port);
-		if (group == -1) {
-			LM_DBG("IP <%.*s:%u> not found in any group\n",
-					str_ip.len, str_ip.s, msg->rcv.src_port);
-			return -1;
-		}
+	}
+	rcu_read_unlock();
+
+	if (group == -1) {
+		LM_DBG("IP <%.*s:%u> not found in any group\n",
+				str_ip.len, str_ip.s, msg->rcv.src_port);
+		return -1;
 	}
 	LM_DBG("Found <%d>\n", group);
 
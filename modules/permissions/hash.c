@@ -43,13 +43,13 @@ struct address_list** hash_create(void) {
 
 	/* Initializing hash tables and hash table variable */
 	ptr = (struct address_list **)shm_malloc
-		(sizeof(struct address_list*) * PERM_HASH_SIZE);
+		(sizeof(struct address_list*) * (PERM_HASH_SIZE + 1));
 	if (!ptr) {
 		LM_ERR("no shm memory for hash table\n");
 		return 0;
 	}
 
-	memset(ptr, 0, sizeof(struct address_list*) * PERM_HASH_SIZE);
+	memset(ptr, 0, sizeof(struct address_list*) * (PERM_HASH_SIZE + 1));
 	return ptr;
 }
 
@@ -63,6 +63,23 @@ void hash_destroy(struct address_list** table) {
 	shm_free(table);
 }
 
+/*
+ * Look for the group in the groups bucket, so that checking a group
+ * does not require walking through the whole table
+ */
+static inline struct address_list *hash_find_group(
+		struct address_list** table, unsigned int grp)
+{
+	struct address_list *node;
+
+	for (node = table[PERM_GROUPS_BUCKET]; node; node = node->next)
+		if (node->grp == grp)
+			return node;
+
+	return NULL;
+}
+
+
 int hash_insert(struct address_list** table, struct ip_addr *ip,
 		  unsigned int grp, unsigned int port, int proto, str* pattern,
 		  str* info) {
@@ -71,6 +88,18 @@ int hash_insert(struct address_list** table, struct ip_addr *ip,
 	unsigned int hash_val;
 	str str_ip;
 
+	if (!hash_find_group(table, grp)) {
+		node = (struct address_list*) shm_malloc(sizeof(struct address_list));
+		if (!node) {
+			LM_ERR("no shm memory left\n");
+			return -1;
+		}
+		memset(node, 0, sizeof(struct address_list));
+		node->grp = grp;
+		node->next = table[PERM_GROUPS_BUCKET];
+		table[PERM_GROUPS_BUCKET] = node;
+	}
+
 	node = (struct address_list*) shm_malloc (sizeof(struct address_list));
 	if (!node) {
 		LM_ERR("no shm memory left\n");
@@ -140,26 +169,13 @@ int hash_match(struct sip_msg *msg, struct address_list** table,
 	str str_ip;
 	pv_spec_t *pvs;
 	pv_value_t pvt;
-	int i, match_res;
+	int match_res;
 
-	if (grp != GROUP_ANY) {
-		for (i = 0; i < PERM_HASH_SIZE; i++) {
-			for (node = table[i]; node; node = node->next) {
-				if (node->grp == grp) {
-					goto grp_found;
-				}
-			}
-		}
-
-		/* group not found */
-		if (!node) {
-			LM_DBG("specified group %u does not exist in hash table\n", grp);
-			return -2;
-		}
+	if (grp != GROUP_ANY && !hash_find_group(table, grp)) {
+		LM_DBG("specified group %u does not exist in hash table\n", grp);
+		return -2;
 	}
 
-grp_found:
-
 	str_ip.len = ip->len;
 	str_ip.s = (char*)ip->u.addr;
 
@@ -320,7 +336,7 @@ void empty_hash(struct address_list** table) {
 
 	struct address_list *node = NULL, *next = NULL;
 
-    for (i = 0; i < PERM_HASH_SIZE; i++) {
+    for (i = 0; i <= PERM_GROUPS_BUCKET; i++) {
 	    for (node = table[i]; node; node = next) {
 	    	next = node->next;
 			if (node->ip) shm_free(node->ip);
@@ -336,208 +352,451 @@ void empty_hash(struct address_list** table) {
 /*
  * Create and initialize a subnet table
  */
-struct subnet* new_subnet_table(void)
+struct subnet_table* new_subnet_table(void)
 {
-    struct subnet* ptr;
-
-    /* subnet record [PERM_MAX_SUBNETS] contains in its grp field
-       the number of subnet records in the subnet table */
-    ptr = (struct subnet *)shm_malloc
-	(sizeof(struct subnet) * (PERM_MAX_SUBNETS + 1));
+	struct subnet_table* ptr;
 
-    if (!ptr) {
+	ptr = (struct subnet_table *)shm_malloc(sizeof(struct subnet_table));
+	if (!ptr) {
 		LM_ERR("no shm memory for subnet table\n");
 		return 0;
-    }
+	}
 
-    ptr[PERM_MAX_SUBNETS].grp = 0;
-    return ptr;
+	memset(ptr, 0, sizeof(struct subnet_table));
+	return ptr;
 }
 
 
 /*
- * Add <grp, subnet, mask, port> into subnet table so that table is
- * kept in increasing ordered according to grp.
+ * Add <grp, subnet, mask, port> at the end of the subnet table; the
+ * table gets ordered (and indexed) later on, by subnet_table_index()
  */
-int subnet_table_insert(struct subnet* table, unsigned int grp,
+int subnet_table_insert(struct subnet_table* table, unsigned int grp,
 			struct net *subnet,
 			unsigned int port, int proto, str* pattern, str *info)
 {
-    int i;
-    unsigned int count;
-
-    count = table[PERM_MAX_SUBNETS].grp;
-
-    if (count == PERM_MAX_SUBNETS) {
-		LM_CRIT("subnet table is full\n");
-		return 0;
-    }
-
-    i = count - 1;
+	struct subnet *subnets, *s;
+	unsigned int size;
+
+	if (table->count == table->size) {
+		size = table->size ? 2 * table->size : 32;
+		subnets = (struct subnet *)shm_realloc(table->subnets,
+			size * sizeof(struct subnet));
+		if (!subnets) {
+			LM_ERR("no more shm memory for the subnet table\n");
+			return -1;
+		}
+		table->subnets = subnets;
+		table->size = size;
+	}
 
-    while (i >= 0 && table[i].grp > grp) {
-		table[i + 1] = table[i];
-		i--;
-    }
+	s = &table->subnets[table->count];
+	memset(s, 0, sizeof(struct subnet));
 
-    table[i + 1].grp = grp;
-    table[i + 1].port = port;
-	table[i + 1].proto = proto;
+	s->grp = grp;
+	s->port = port;
+	s->proto = proto;
 
 	if (subnet) {
-		table[i + 1].subnet = (struct net*) shm_malloc(sizeof(struct net));
-		if (!table[i + 1].subnet) {
+		s->subnet = (struct net*) shm_malloc(sizeof(struct net));
+		if (!s->subnet) {
 			LM_ERR("cannot allocate shm memory for table subnet\n");
-			return -1;
+			goto error;
 		}
-		memcpy(table[i + 1].subnet, subnet, sizeof(struct net));
+		memcpy(s->subnet, subnet, sizeof(struct net));
 	}
-	else
-		table[i + 1].subnet = NULL;
 
 	if (info->len) {
-		table[i + 1].info = (char*) shm_malloc(info->len + 1);
-		if (!table[i + 1].info) {
+		s->info = (char*) shm_malloc(info->len + 1);
+		if (!s->info) {
 			LM_ERR("cannot allocate shm memory for table info\n");
-			return -1;
+			goto error;
 		}
-		memcpy(table[i + 1].info, info->s, info->len);
-		table[i + 1].info[info->len] = 0;
+		memcpy(s->info, info->s, info->len);
+		s->info[info->len] = 0;
 	}
-	else
-		table[i + 1].info = NULL;
 
 	if (pattern->len) {
-		table[i + 1].pattern = (char*) shm_malloc(pattern->len + 1);
-		if (!table[i + 1].pattern) {
+		s->pattern = (char*) shm_malloc(pattern->len + 1);
+		if (!s->pattern) {
 			LM_ERR("cannot allocate shm memory for table pattern\n");
-			return -1;
+			goto error;
 		}
-		memcpy(table[i + 1].pattern, pattern->s, pattern->len);
-		table[i + 1].pattern[ pattern->len ] = 0;
+		memcpy(s->pattern, pattern->s, pattern->len);
+		s->pattern[ pattern->len ] = 0;
 	}
-	else
-		table[i + 1].pattern = NULL;
 
+	table->count++;
+
+	return 1;
+error:
+	if (s->subnet)
+		shm_free(s->subnet);
+	if (s->info)
+		shm_free(s->info);
+	return -1;
+}
 
-    table[PERM_MAX_SUBNETS].grp = count + 1;
 
-    return 1;
+static inline int subnet_bit(const unsigned char *key, unsigned int bit)
+{
+	return (key[bit >> 3] >> (7 - (bit & 7))) & 1;
 }
 
 
-/*
- * Check if an entry exists in subnet table that matches given group, ip_addr,
- * and port.  Port 0 in subnet table matches any port.
- */
-int match_subnet_table(struct sip_msg *msg, struct subnet* table, unsigned int grp,
-			struct ip_addr *ip, unsigned int port, int proto,
-			char *pattern, char *info)
+/* number of leading bits (at most "max") the two keys have in common */
+static inline unsigned int subnet_common_bits(const unsigned char *a,
+		const unsigned char *b, unsigned int max)
 {
-        unsigned int count, i;
-	pv_value_t pvt;
-	pv_spec_t *pvs;
-	int match_res, found_group = 0;
+	unsigned int i;
+	unsigned char x;
+
+	for (i = 0; i < max; i += 8) {
+		x = a[i >> 3] ^ b[i >> 3];
+		if (x) {
+			for (; !(x & 0x80); x <<= 1)
+				i++;
+			return i < max ? i : max;
+		}
+	}
 
-	count = table[PERM_MAX_SUBNETS].grp;
+	return max;
+}
 
-	if (count == 0) {
-		LM_DBG("subnet table is empty\n");
-		return -2;
+
+static struct subnet_node *subnet_node_new(const unsigned char *key,
+		unsigned int bits)
+{
+	struct subnet_node *node;
+
+	node = (struct subnet_node *)shm_malloc(sizeof(struct subnet_node));
+	if (!node) {
+		LM_ERR("no more shm memory for the subnet tree\n");
+		return NULL;
 	}
 
-	if (grp != GROUP_ANY) {
-		for (i = 0; i < count; i++) {
-			if (table[i].grp == grp) {
-				found_group = 1;
-				break;
-			} else if (table[i].grp > grp) {
-				break;
-			}
-		}
+	memset(node, 0, sizeof(struct subnet_node));
+	memcpy(node->key, key, (bits + 7) / 8);
+	node->bits = bits;
+
+	return node;
+}
+
+
+static int subnet_node_add(struct subnet_node *node, unsigned int idx)
+{
+	unsigned int *p;
+
+	p = (unsigned int *)shm_realloc(node->idx,
+		(node->idx_no + 1) * sizeof(unsigned int));
+	if (!p) {
+		LM_ERR("no more shm memory for the subnet tree\n");
+		return -1;
+	}
+
+	p[node->idx_no++] = idx;
+	node->idx = p;
+
+	return 0;
+}
+
+
+/* hook the "idx" subnet of the table into the tree, under its prefix */
+static int subnet_tree_insert(struct subnet_node **root,
+		const unsigned char *key, unsigned int bits, unsigned int idx)
+{
+	struct subnet_node **np, *n, *mid, *leaf;
+	unsigned int common;
 
-		if (!found_group) {
-			LM_DBG("specified group %u does not exist in hash table\n", grp);
-			return -2;
+	for (np = root; (n = *np); np = &n->kid[subnet_bit(key, n->bits)]) {
+		common = subnet_common_bits(n->key, key,
+			n->bits < bits ? n->bits : bits);
+
+		if (common < n->bits) {
+			/* the node is off our path - split it at the common prefix */
+			mid = subnet_node_new(key, common);
+			if (!mid)
+				return -1;
+			mid->kid[subnet_bit(n->key, common)] = n;
+			*np = mid;
+
+			if (common == bits)
+				return subnet_node_add(mid, idx);
+
+			leaf = subnet_node_new(key, bits);
+			if (!leaf)
+				return -1;
+			mid->kid[subnet_bit(key, common)] = leaf;
+			return subnet_node_add(leaf, idx);
 		}
+
+		if (n->bits == bits)
+			return subnet_node_add(n, idx);
 	}
 
-	i = 0;
-	do {
-		if ((table[i].grp == grp || table[i].grp == GROUP_ANY
-				|| grp == GROUP_ANY) &&
-			(table[i].port == port || table[i].port == PORT_ANY
-				|| port == PORT_ANY) &&
-			(table[i].proto == proto || table[i].proto == PROTO_NONE
-			 	|| proto == PROTO_NONE))
-			{
+	*np = subnet_node_new(key, bits);
+	if (!*np)
+		return -1;
 
-				match_res = matchnet(ip, table[i].subnet);
+	return subnet_node_add(*np, idx);
+}
 
-				if (match_res != 1) {
-					i++;
-					continue;
-				}
 
-				if (table[i].pattern && pattern) {
-					match_res = fnmatch(table[i].pattern, pattern, FNM_PERIOD);
+static void subnet_tree_free(struct subnet_node *node)
+{
+	if (!node)
+		return;
 
-					if (match_res) {
-						i++;
-						continue;
-					}
-				}
+	subnet_tree_free(node->kid[0]);
+	subnet_tree_free(node->kid[1]);
 
-				if (info) {
-					pvs = (pv_spec_t *)info;
-					memset(&pvt, 0, sizeof(pv_value_t));
-					pvt.flags = PV_VAL_STR;
-					pvt.rs.s = table[i].info;
-					pvt.rs.len = table[i].info ? strlen(table[i].info) : 0;
-
-					if (pv_set_value(msg, pvs, (int)EQ_T, &pvt) < 0) {
-						LM_ERR("setting of avp failed\n");
-						return -1;
-	    			}
-				}
+	if (node->idx)
+		shm_free(node->idx);
+	shm_free(node);
+}
+
+
+typedef int (subnet_match_f)(struct subnet *s, void *param);
+
+/*
+ * Walk down the tree of the ip's family and return the lowest table index
+ * of the subnets containing the ip and accepted by "match", or -1 if none.
+ * It is the same result a linear scan of the table would give.
+ */
+static int subnet_tree_lookup(struct subnet_table *table, struct ip_addr *ip,
+		subnet_match_f *match, void *param)
+{
+	struct subnet_node *node;
+	unsigned int best, k;
 
-				LM_DBG("match found in the subnet table\n");
-				return 1;
+	best = table->count;
+
+	node = table->tree[ip->af == AF_INET6];
+	while (node) {
+		if (subnet_common_bits(node->key, ip->u.addr, node->bits) < node->bits)
+			break;
+
+		/* indexes are ascending - stop at the first acceptable one */
+		for (k = 0; k < node->idx_no && node->idx[k] < best; k++)
+			if (match(&table->subnets[node->idx[k]], param)) {
+				best = node->idx[k];
+				break;
 			}
 
-		if (table[i].grp > grp && grp != GROUP_ANY)
+		if (node->bits >= ip->len * 8)
 			break;
-		i++;
+		node = node->kid[subnet_bit(ip->u.addr, node->bits)];
+	}
+
+	return best == table->count ? -1 : (int)best;
+}
+
+
+static struct subnet *sort_subnets;
+
+static int subnet_order_cmp(const void *a, const void *b)
+{
+	unsigned int i = *(const unsigned int *)a, j = *(const unsigned int *)b;
+	unsigned int gi = sort_subnets[i].grp, gj = sort_subnets[j].grp;
+
+	/* ties are broken by the insertion order, as the old table did */
+	if (gi != gj)
+		return gi < gj ? -1 : 1;
+	return i < j ? -1 : (i > j);
+}
+
+
+/* number of bits set in the mask of the subnet */
+static unsigned int subnet_mask_bits(struct net *net)
+{
+	unsigned int i, bits = 0;
+	unsigned char m;
+
+	for (i = 0; i < net->mask.len; i++)
+		for (m = net->mask.u.addr[i]; m; m <<= 1)
+			bits++;
+
+	return bits;
+}
+
+
+int subnet_table_index(struct subnet_table* table)
+{
+	struct subnet *subnets = NULL;
+	unsigned int *order, i;
+
+	if (table->count == 0)
+		return 0;
+
+	order = (unsigned int *)pkg_malloc(table->count * sizeof(unsigned int));
+	if (!order) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+
+	subnets = (struct subnet *)shm_malloc(
+		table->count * sizeof(struct subnet));
+	if (!subnets) {
+		LM_ERR("no more shm memory for the subnet table\n");
+		goto error;
+	}
+
+	for (i = 0; i < table->count; i++)
+		order[i] = i;
+	sort_subnets = table->subnets;
+	qsort(order, table->count, sizeof(unsigned int), subnet_order_cmp);
+
+	for (i = 0; i < table->count; i++)
+		subnets[i] = table->subnets[order[i]];
+
+	shm_free(table->subnets);
+	table->subnets = subnets;
+	table->size = table->count;
+
+	for (i = 0; i < table->count; i++) {
+		/* a subnet which could not be built never matched anything */
+		if (!subnets[i].subnet)
+			continue;
+
+		if (subnet_tree_insert(
+		&table->tree[subnets[i].subnet->ip.af == AF_INET6],
+		subnets[i].subnet->ip.u.addr, subnet_mask_bits(subnets[i].subnet),
+		i) < 0)
+			goto error;
+	}
+
+	pkg_free(order);
+	return 0;
+error:
+	pkg_free(order);
+	return -1;
+}
+
+
+/* the table is ordered by grp, so a binary search will do */
+static int subnet_find_group(struct subnet_table *table, unsigned int grp)
+{
+	unsigned int l = 0, r = table->count, m;
+
+	while (l < r) {
+		m = (l + r) / 2;
+		if (table->subnets[m].grp == grp)
+			return 1;
+		if (table->subnets[m].grp < grp)
+			l = m + 1;
+		else
+			r = m;
+	}
+
+	return 0;
+}
+
+
+struct subnet_match_param {
+	unsigned int grp;
+	unsigned int port;
+	int proto;
+	char *pattern;
+};
+
+static int subnet_match(struct subnet *s, void *param)
+{
+	struct subnet_match_param *p = (struct subnet_match_param *)param;
+
+	if (!((s->grp == p->grp || s->grp == GROUP_ANY
+			|| p->grp == GROUP_ANY) &&
+		(s->port == p->port || s->port == PORT_ANY
+			|| p->port == PORT_ANY) &&
+		(s->proto == p->proto || s->proto == PROTO_NONE
+			|| p->proto == PROTO_NONE)))
+		return 0;
+
+	if (s->pattern && p->pattern &&
+	fnmatch(s->pattern, p->pattern, FNM_PERIOD))
+		return 0;
+
+	return 1;
+}
+
+
+/*
+ * Check if an entry exists in subnet table that matches given group, ip_addr,
+ * and port.  Port 0 in subnet table matches any port.
+ */
+int match_subnet_table(struct sip_msg *msg, struct subnet_table* table,
+			unsigned int grp, struct ip_addr *ip, unsigned int port, int proto,
+			char *pattern, char *info)
+{
+	struct subnet_match_param param;
+	struct subnet *s;
+	pv_value_t pvt;
+	pv_spec_t *pvs;
+	int i;
 
-	} while (i < count);
+	if (table->count == 0) {
+		LM_DBG("subnet table is empty\n");
+		return -2;
+	}
 
-	LM_DBG("no match in the subnet table\n");
-    return -1;
+	if (grp != GROUP_ANY && !subnet_find_group(table, grp)) {
+		LM_DBG("specified group %u does not exist in hash table\n", grp);
+		return -2;
+	}
+
+	param.grp = grp;
+	param.port = port;
+	param.proto = proto;
+	param.pattern = pattern;
+
+	i = subnet_tree_lookup(table, ip, subnet_match, &param);
+	if (i < 0) {
+		LM_DBG("no match in the subnet table\n");
+		return -1;
+	}
+
+	s = &table->subnets[i];
+
+	if (info) {
+		pvs = (pv_spec_t *)info;
+		memset(&pvt, 0, sizeof(pv_value_t));
+		pvt.flags = PV_VAL_STR;
+		pvt.rs.s = s->info;
+		pvt.rs.len = s->info ? strlen(s->info) : 0;
+
+		if (pv_set_value(msg, pvs, (int)EQ_T, &pvt) < 0) {
+			LM_ERR("setting of avp failed\n");
+			return -1;
+		}
+	}
+
+	LM_DBG("match found in the subnet table\n");
+	return 1;
 }
 
 
 /*
  * Print subnets stored in subnet table
  */
-int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl,
+int subnet_table_mi_print(struct subnet_table* table, struct mi_node* rpl,
 		struct pm_part_struct *pm)
 {
-    unsigned int count, i;
+    unsigned int i;
 	char *p, *ip, *mask, prbuf[PROTO_NAME_MAX_SIZE];
 	int len;
 	static char ip_buff[IP_ADDR_MAX_STR_SIZE];
 	struct mi_node *net;
+	struct subnet *s;
 
-    count = table[PERM_MAX_SUBNETS].grp;
+    for (i = 0; i < table->count; i++) {
+		s = &table->subnets[i];
 
-    for (i = 0; i < count; i++) {
-		ip = ip_addr2a(&table[i].subnet->ip);
+		ip = ip_addr2a(&s->subnet->ip);
 		if (!ip) {
 			LM_ERR("cannot print ip address\n");
 			continue;
 		}
 		strcpy(ip_buff, ip);
-		mask = ip_addr2a(&table[i].subnet->mask);
+		mask = ip_addr2a(&s->subnet->mask);
 		if (!mask) {
 			LM_ERR("cannot print mask address\n");
 			continue;
@@ -549,7 +808,7 @@ int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl,
 			return -1;
 		}
 
-		p = int2str(table[i].grp, &len);
+		p = int2str(s->grp, &len);
 		if (!add_mi_attr(net, MI_DUP_VALUE, MI_SSTR("grp"), p, len)) {
 			goto out_free;
 		}
@@ -564,16 +823,16 @@ int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl,
 			goto out_free;
 		}
 
-		p = int2str(table[i].port, &len);
+		p = int2str(s->port, &len);
 		if (!add_mi_attr(net, MI_DUP_VALUE, MI_SSTR("port"), p, len)) {
 			goto out_free;
 		}
 
-		if (table[i].proto == PROTO_NONE) {
+		if (s->proto == PROTO_NONE) {
 			p = "any";
 			len = 3;
 		} else {
-			p = proto2str(table[i].proto, prbuf);
+			p = proto2str(s->proto, prbuf);
 			len = p - prbuf;
 			p = prbuf;
 		}
@@ -582,14 +841,14 @@ int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl,
 		}
 
 		if (!add_mi_attr(net, MI_DUP_VALUE, MI_SSTR("pattern"),
-		                 table[i].pattern,
-		                 table[i].pattern ? strlen(table[i].pattern) : 0)) {
+		                 s->pattern,
+		                 s->pattern ? strlen(s->pattern) : 0)) {
 			goto out_free;
 		}
 
 		if (!add_mi_attr(net, MI_DUP_VALUE, MI_SSTR("context_info"),
-		                 table[i].info,
-		                 table[i].info ? strlen(table[i].info) : 0)) {
+		                 s->info,
+		                 s->info ? strlen(s->info) : 0)) {
 			LM_ERR("oom!\n");
 			goto out_free;
 		}
@@ -603,68 +862,67 @@ out_free:
 }
 
 
+static int subnet_match_port(struct subnet *s, void *param)
+{
+	unsigned int port = *(unsigned int *)param;
+
+	return s->port == port || s->port == 0;
+}
+
+
 /*
  * Check if an entry exists in subnet table that matches given ip_addr,
  * and port.  Port 0 in subnet table matches any port.  Return group of
  * first match or -1 if no match is found.
  */
-int find_group_in_subnet_table(struct subnet* table,
+int find_group_in_subnet_table(struct subnet_table* table,
 		                   struct ip_addr *ip, unsigned int port)
 {
-	unsigned int count, i, match_res;
-
-	count = table[PERM_MAX_SUBNETS].grp;
-
-	i = 0;
-	while (i < count) {
-		if	(table[i].port == port || table[i].port == 0) {
-			match_res = matchnet(ip, table[i].subnet);
-
-			if (match_res == 1)
-		        return table[i].grp;
+	int i;
 
-		}
-	    i++;
-	}
+	i = subnet_tree_lookup(table, ip, subnet_match_port, &port);
 
-	return -1;
+	return i < 0 ? -1 : (int)table->subnets[i].grp;
 }
 
 
 /*
  * Empty contents of subnet table
  */
-void empty_subnet_table(struct subnet *table)
+void empty_subnet_table(struct subnet_table *table)
 {
-	int count, i;
+	unsigned int i;
 
 	if (!table)
 		return;
 
-	count = table[PERM_MAX_SUBNETS].grp;
-
-	for (i = 0; i < count; i++) {
-		if (table[i].info)
-    		        shm_free(table[i].info);
-		if (table[i].subnet)
-		        shm_free(table[i].subnet);
+	for (i = 0; i < table->count; i++) {
+		if (table->subnets[i].info)
+			shm_free(table->subnets[i].info);
+		if (table->subnets[i].pattern)
+			shm_free(table->subnets[i].pattern);
+		if (table->subnets[i].subnet)
+			shm_free(table->subnets[i].subnet);
 	}
+	table->count = 0;
 
-	table[PERM_MAX_SUBNETS].grp = 0;
+	subnet_tree_free(table->tree[0]);
+	subnet_tree_free(table->tree[1]);
+	table->tree[0] = table->tree[1] = NULL;
 }
 
 
 /*
  * Release memory allocated for a subnet table
  */
-void free_subnet_table(struct subnet* table)
+void free_subnet_table(struct subnet_table* table)
 {
+	if (!table)
+		return;
+
 	empty_subnet_table(table);
 
-	if (table)
-	    shm_free(table);
+	if (table->subnets)
+		shm_free(table->subnets);
+	shm_free(table);
 }
-
-
-
-
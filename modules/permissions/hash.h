@@ -35,6 +35,8 @@
 #include "partitions.h"
 
 #define PERM_HASH_SIZE 128
+/* extra bucket holding one (ip-less) entry for each group in the table */
+#define PERM_GROUPS_BUCKET PERM_HASH_SIZE
 
 #define GROUP_ANY 0
 #define MASK_ANY 32
@@ -102,13 +104,11 @@ int find_group_in_hash_table(struct address_list** table,
 
 
 
-#define PERM_MAX_SUBNETS 128
-
 /*
  * Structure used to store a subnet
  */
 struct subnet {
-	unsigned int grp;        /* address group, subnet count in last record */
+	unsigned int grp;        /* address group */
 	struct net *subnet;		 /* IP subnet + mask */
 	int proto;                  /* Protocol -- UDP, TCP, TLS, or SCTP */
 	char *pattern;              /* Pattern matching From header field */
@@ -116,18 +116,42 @@ struct subnet {
 	char *info;				 /* extra information */
 };
 
+/*
+ * Node of the path compressed binary radix tree indexing the subnets
+ * by their network address
+ */
+struct subnet_node {
+	unsigned char key[16];      /* network address of the node */
+	unsigned int bits;          /* significant bits of the key */
+	unsigned int *idx;          /* subnets having exactly this prefix, as
+	                               ascending indexes in the subnet table */
+	unsigned int idx_no;
+	struct subnet_node *kid[2];
+};
+
+/*
+ * Subnet table - the subnets are ordered by grp, with a radix tree
+ * for each address family on top of them
+ */
+struct subnet_table {
+	struct subnet *subnets;
+	unsigned int count;
+	unsigned int size;
+	struct subnet_node *tree[2];  /* IPv4 and IPv6 subnets */
+};
+
 
 /*
  * Create a subnet table
  */
-struct subnet* new_subnet_table(void);
+struct subnet_table* new_subnet_table(void);
 
 
 /*
  * Check if an entry exists in subnet table that matches given group, ip_addr,
  * and port.  Port 0 in subnet table matches any port.
  */
-int match_subnet_table(struct sip_msg *msg, struct subnet* table,
+int match_subnet_table(struct sip_msg *msg, struct subnet_table* table,
 		unsigned int group, struct ip_addr *ip, unsigned int port, int proto,
 		char *pattern, char* info);
 
@@ -137,36 +161,42 @@ int match_subnet_table(struct sip_msg *msg, struct subnet* table,
  * and port.  Port 0 in subnet table matches any port.  Returns group of
  * the first match or -1 if no match is found.
  */
-int find_group_in_subnet_table(struct subnet* table,
+int find_group_in_subnet_table(struct subnet_table* table,
 		struct ip_addr *ip, unsigned int port);
 
 /*
  * Empty contents of subnet table
  */
-void empty_subnet_table(struct subnet *table);
+void empty_subnet_table(struct subnet_table *table);
 
 
 /*
  * Release memory allocated for a subnet table
  */
-void free_subnet_table(struct subnet* table);
+void free_subnet_table(struct subnet_table* table);
 
 
 
 /*
- * Add <grp, subnet, mask, port> into subnet table so that table is
- * kept ordered according to subnet, port, grp.
+ * Add <grp, subnet, mask, port> into subnet table. The new entries are
+ * not visible to the lookups until subnet_table_index() is called.
  */
-int subnet_table_insert(struct subnet* table, unsigned int grp,
+int subnet_table_insert(struct subnet_table* table, unsigned int grp,
 		struct net *subnet, unsigned int port, int proto,
 		str* pattern, str *info);
 
 
+/*
+ * Order the subnet table according to grp and build its radix trees
+ */
+int subnet_table_index(struct subnet_table* table);
+
+
 /*
  * Print subnets stored in subnet table
  */
 /*void subnet_table_print(struct subnet* table, FILE* reply_file);*/
-int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl,
+int subnet_table_mi_print(struct subnet_table* table, struct mi_node* rpl,
 		struct pm_part_struct *pm);
 
 
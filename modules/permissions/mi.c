@@ -26,6 +26,7 @@
 
 
 #include "../../dprint.h"
+#include "../../rcu.h"
 #include "address.h"
 #include "hash.h"
 #include "mi.h"
@@ -85,6 +86,7 @@ struct mi_root* mi_address_dump(struct mi_root *cmd_tree, void *param)
 	struct mi_root* rpl_tree;
 	struct mi_node *node = NULL, *part_node;
 	struct pm_part_struct *it, *ps;
+	int ret;
 
 	if (cmd_tree)
 		node = cmd_tree->node.kids;
@@ -108,7 +110,10 @@ struct mi_root* mi_address_dump(struct mi_root *cmd_tree, void *param)
 				return NULL;
 			}
 
-			if(hash_mi_print(*it->hash_table, part_node, it)< 0) {
+			rcu_read_lock();
+			ret = hash_mi_print(*it->hash_table, part_node, it);
+			rcu_read_unlock();
+			if (ret < 0) {
 				LM_ERR("failed to add a node\n");
 				free_mi_tree(rpl_tree);
 				return 0;
@@ -128,7 +133,10 @@ struct mi_root* mi_address_dump(struct mi_root *cmd_tree, void *param)
 			       ps->name.len, ps->name.s);
 			return NULL;
 		}
-		if(hash_mi_print(*ps->hash_table, &rpl_tree->node, ps)< 0) {
+		rcu_read_lock();
+		ret = hash_mi_print(*ps->hash_table, &rpl_tree->node, ps);
+		rcu_read_unlock();
+		if (ret < 0) {
 			LM_ERR("failed to add a node\n");
 			free_mi_tree(rpl_tree);
 			return 0;
@@ -201,6 +209,7 @@ struct mi_root* mi_subnet_dump(struct mi_root *cmd_tree, void *param)
 	struct mi_root* rpl_tree;
 	struct mi_node *node = NULL, *part_node;
 	struct pm_part_struct *it, *ps;
+	int ret;
 
 	if (cmd_tree)
 		node = cmd_tree->node.kids;
@@ -224,7 +233,10 @@ struct mi_root* mi_subnet_dump(struct mi_root *cmd_tree, void *param)
 				return NULL;
 			}
 
-			if (subnet_table_mi_print(*it->subnet_table, part_node, it) <  0) {
+			rcu_read_lock();
+			ret = subnet_table_mi_print(*it->subnet_table, part_node, it);
+			rcu_read_unlock();
+			if (ret < 0) {
 				LM_ERR("failed to add a node\n");
 				free_mi_tree(rpl_tree);
 				return 0;
@@ -245,14 +257,20 @@ struct mi_root* mi_subnet_dump(struct mi_root *cmd_tree, void *param)
 			return NULL;
 		}
 
-		if (subnet_table_mi_print(*ps->subnet_table, part_node, ps) <  0) {
+		rcu_read_lock();
+		ret = subnet_table_mi_print(*ps->subnet_table, part_node, ps);
+		rcu_read_unlock();
+		if (ret < 0) {
 			LM_ERR("failed to add a node\n");
 			free_mi_tree(rpl_tree);
 			return 0;
 		}
 
 		/* dump requested subnet*/
-		if (subnet_table_mi_print(*ps->subnet_table, part_node, ps) <  0) {
+		rcu_read_lock();
+		ret = subnet_table_mi_print(*ps->subnet_table, part_node, ps);
+		rcu_read_unlock();
+		if (ret < 0) {
 			LM_ERR("failed to add a node\n");
 			 free_mi_tree(rpl_tree);
 			return 0;
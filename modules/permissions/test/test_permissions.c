@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../../../str.h"
+#include "../../../ip_addr.h"
+#include "../../../mem/shm_mem.h"
+
+#include "../hash.h"
+
+#define CHECK_SUBNETS	5000
+#define CHECK_LOOKUPS	20000
+#define BENCH_SUBNETS	60000
+#define BENCH_LOOKUPS	100000
+#define BENCH_LINEAR_LOOKUPS	200
+#define GROUPS			50
+
+static unsigned int seed = 42;
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void rand_ip(struct ip_addr *ip, int ipv6)
+{
+	unsigned int i;
+
+	memset(ip, 0, sizeof *ip);
+	ip->af = ipv6 ? AF_INET6 : AF_INET;
+	ip->len = ipv6 ? 16 : 4;
+	for (i = 0; i < ip->len; i++)
+		ip->u.addr[i] = rand_r(&seed);
+}
+
+static void mk_test_net(struct net *net, struct ip_addr *ip, unsigned int bits)
+{
+	unsigned int i;
+
+	net->ip = *ip;
+	net->mask = *ip;
+	for (i = 0; i < ip->len; i++, bits = bits > 8 ? bits - 8 : 0) {
+		net->mask.u.addr[i] = bits >= 8 ? 0xff : (0xff00 >> bits) & 0xff;
+		net->ip.u.addr[i] &= net->mask.u.addr[i];
+	}
+}
+
+/* an address inside a random subnet of the table, or a random one */
+static void rand_lookup_ip(struct subnet_table *table, struct ip_addr *ip)
+{
+	struct net *net;
+	unsigned int i;
+
+	net = table->subnets[rand_r(&seed) % table->count].subnet;
+	rand_ip(ip, net->ip.af == AF_INET6);
+	if (rand_r(&seed) % 4 == 0)
+		return;
+
+	for (i = 0; i < ip->len; i++)
+		ip->u.addr[i] = net->ip.u.addr[i] |
+			(ip->u.addr[i] & ~net->mask.u.addr[i]);
+}
+
+static struct subnet_table *build_table(int count, int ipv6_every)
+{
+	struct subnet_table *table;
+	struct ip_addr ip;
+	struct net net;
+	str empty = {NULL, 0};
+	int i, ipv6;
+
+	table = new_subnet_table();
+	if (!table)
+		return NULL;
+
+	for (i = 0; i < count; i++) {
+		ipv6 = ipv6_every && i % ipv6_every == 0;
+		rand_ip(&ip, ipv6);
+		mk_test_net(&net, &ip, ipv6 ? 16 + rand_r(&seed) % 113 :
+			8 + rand_r(&seed) % 25);
+
+		if (subnet_table_insert(table, 1 + rand_r(&seed) % GROUPS, &net,
+		rand_r(&seed) % 4 ? PORT_ANY : 5060, PROTO_NONE, &empty, &empty) < 0)
+			goto error;
+	}
+
+	if (subnet_table_index(table) < 0)
+		goto error;
+
+	return table;
+error:
+	free_subnet_table(table);
+	return NULL;
+}
+
+/* the group the old matcher returned, by scanning the whole table */
+static int linear_find_group(struct subnet_table *table, struct ip_addr *ip,
+		unsigned int grp, unsigned int port)
+{
+	struct subnet *s;
+	unsigned int i;
+
+	for (i = 0; i < table->count; i++) {
+		s = &table->subnets[i];
+		if ((s->grp == grp || grp == GROUP_ANY) &&
+		        (s->port == port || s->port == PORT_ANY) &&
+		        matchnet(ip, s->subnet) == 1)
+			return s->grp;
+	}
+
+	return -1;
+}
+
+static void test_subnet_lookup(void)
+{
+	struct subnet_table *table;
+	struct ip_addr ip;
+	unsigned int grp, port;
+	int i, exp, res, bad_find = 0, bad_match = 0, hits = 0;
+
+	table = build_table(CHECK_SUBNETS, 5);
+	if (!ok(table != NULL, "permissions: build a %d subnets table",
+	        CHECK_SUBNETS))
+		return;
+
+	for (i = 0; i < CHECK_LOOKUPS; i++) {
+		rand_lookup_ip(table, &ip);
+		port = rand_r(&seed) % 2 ? 5060 : 5061;
+		grp = rand_r(&seed) % (GROUPS + 1);
+
+		exp = linear_find_group(table, &ip, GROUP_ANY, port);
+		if (find_group_in_subnet_table(table, &ip, port) != exp)
+			bad_find++;
+		if (exp >= 0)
+			hits++;
+
+		/* a miss is -1, or -2 if the group is not in the table at all */
+		exp = linear_find_group(table, &ip, grp, port);
+		res = match_subnet_table(NULL, table, grp, &ip, port, PROTO_NONE,
+			NULL, NULL);
+		if (exp >= 0 ? res != 1 : res >= 0)
+			bad_match++;
+	}
+
+	ok(bad_find == 0, "permissions: find_group_in_subnet_table() as the "
+		"linear scan (%d of %d lookups hit)", hits, CHECK_LOOKUPS);
+	ok(bad_match == 0, "permissions: match_subnet_table() as the "
+		"linear scan");
+
+	free_subnet_table(table);
+}
+
+static void bench_subnet_lookup(void)
+{
+	static struct ip_addr ips[1024];
+	struct subnet_table *table;
+	unsigned long long start, idx_ns, lin_ns;
+	int i, bad = 0;
+
+	table = build_table(BENCH_SUBNETS, 0);
+	if (!ok(table != NULL, "permissions: build a %d subnets table",
+	        BENCH_SUBNETS))
+		return;
+
+	for (i = 0; i < 1024; i++)
+		rand_lookup_ip(table, &ips[i]);
+
+	start = now_ns();
+	for (i = 0; i < BENCH_LOOKUPS; i++)
+		if (find_group_in_subnet_table(table, &ips[i % 1024], 5060) < -1)
+			bad++;
+	idx_ns = (now_ns() - start) / BENCH_LOOKUPS;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_LINEAR_LOOKUPS; i++)
+		if (linear_find_group(table, &ips[i % 1024], GROUP_ANY, 5060) < -1)
+			bad++;
+	lin_ns = (now_ns() - start) / BENCH_LINEAR_LOOKUPS;
+
+	ok(bad == 0, "permissions: %d subnets - radix tree %llu ns, linear scan "
+		"%llu ns", BENCH_SUBNETS, idx_ns, lin_ns);
+
+	free_subnet_table(table);
+}
+
+void mod_tests(void)
+{
+	test_subnet_lookup();
+	bench_subnet_lookup();
+}
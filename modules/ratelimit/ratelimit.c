@@ -59,6 +59,7 @@ static int *rl_feedback_limit;
 
 int * rl_network_load;	/* network load */
 int * rl_network_count;	/* flag for counting network algo users */
+int * rl_cluster_nodes;	/* reachable instances of the cluster, this one included */
 
 /* these only change in the mod_init() process -- no locking needed */
 int rl_timer_interval = RL_TIMER_INTERVAL;
@@ -72,6 +73,9 @@ struct clusterer_binds clusterer_api;
 int rl_window_size=10;   /* how many seconds the window shall hold*/
 int rl_slot_period=200;  /* how many milisecs a slot from the window has  */
 
+/* how often the pipes' quotas are updated, in milliseconds; 0 disables it */
+int rl_quota_interval = 0;
+
 static str db_url = {0,0};
 str db_prefix = str_init("rl_pipe_");
 
@@ -144,6 +148,7 @@ static param_export_t params[] = {
 	{ "window_size",            INT_PARAM,  &rl_window_size},
 	{ "slot_period",            INT_PARAM,  &rl_slot_period},
 	{ "limit_per_interval",     INT_PARAM,  &rl_limit_per_interval},
+	{ "repl_quota_interval",    INT_PARAM,  &rl_quota_interval},
 	{ 0, 0, 0}
 };
 
@@ -324,6 +329,11 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if (rl_quota_interval < 0) {
+		LM_ERR("invalid repl_quota_interval\n");
+		return -1;
+	}
+
 	if (rl_repl_cluster < 0) {
 		LM_ERR("Invalid replication_cluster, must be 0 or a positive cluster id\n");
 		return -1;
@@ -342,6 +352,8 @@ static int mod_init(void)
 
 	RL_SHM_MALLOC(rl_network_count, sizeof(int));
 	RL_SHM_MALLOC(rl_network_load, sizeof(int));
+	RL_SHM_MALLOC(rl_cluster_nodes, sizeof(int));
+	*rl_cluster_nodes = 1;
 	RL_SHM_MALLOC(rl_load_value, sizeof(double));
 	RL_SHM_MALLOC(pid_kp, sizeof(double));
 	RL_SHM_MALLOC(pid_ki, sizeof(double));
@@ -376,6 +388,12 @@ static int mod_init(void)
 		LM_ERR("failed to register utimer\n");
 		return -1;
 	}
+	if (rl_repl_cluster && rl_quota_interval &&
+		register_utimer("rl-quota-utimer", rl_timer_quota, NULL,
+			rl_quota_interval * 1000, TIMER_FLAG_DELAY_ON_DELAY) < 0) {
+		LM_ERR("failed to register quota utimer\n");
+		return -1;
+	}
 
 	if (rl_hash_size <= 0) {
 		LM_ERR("Hash size must be a positive integer, power of 2!\n");
@@ -441,6 +459,7 @@ void mod_destroy(void)
 	}
 	RL_SHM_FREE(rl_network_count);
 	RL_SHM_FREE(rl_network_load);
+	RL_SHM_FREE(rl_cluster_nodes);
 	RL_SHM_FREE(rl_load_value);
 	RL_SHM_FREE(pid_kp);
 	RL_SHM_FREE(pid_ki);
@@ -564,6 +583,54 @@ static inline int hist_check(rl_pipe_t *pipe)
 	#undef S2MILI
 }
 
+/**
+ * Generic Cell Rate Algorithm: a token bucket holding up to "limit" requests,
+ * refilled at a constant rate of "limit" requests per second (or per
+ * timer_interval); unlike the counters reset by the timer, it does not let
+ * a second burst in right after a window boundary
+ *
+ * @param pipe   the pipe to check
+ * @return -1 if drop needed, 1 if allowed
+ */
+static inline int gcra_check(rl_pipe_t *pipe)
+{
+	unsigned long long now, tat, interval, emission;
+	struct timeval tv;
+	int limit = RL_PIPE_LIMIT(pipe);
+
+	if (limit <= 0)
+		return -1;
+
+	/* in ns, so that the emission interval does not round down to 0 for
+	 * the high limits, which would admit everything */
+	interval = (rl_limit_per_interval ? rl_timer_interval : 1) * 1000000000ULL;
+	emission = interval / limit;
+	if (emission == 0)
+		emission = 1;
+
+	gettimeofday(&tv, NULL);
+	now = (unsigned long long)tv.tv_sec * 1000000000 + tv.tv_usec * 1000;
+
+	tat = pipe->tat > now ? pipe->tat : now;
+	/* the bucket is empty */
+	if (tat + emission - now > interval)
+		return -1;
+
+	pipe->tat = tat + emission;
+	return 1;
+}
+
+/**
+ * checks whether the pipe can be dropped without losing any information,
+ * i.e. a GCRA pipe whose bucket has been refilled
+ * (expects the pipe's lock to be taken)
+ */
+int rl_pipe_idle(rl_pipe_t *pipe, unsigned long long now_ns)
+{
+	/* the pipes known by the other instances are kept for their demand */
+	return pipe->algo == PIPE_ALGO_GCRA && pipe->tat <= now_ns && !pipe->dsts;
+}
+
 /**
  * runs the pipe's algorithm
  * (expects rl_lock to be taken)
@@ -578,6 +645,10 @@ int rl_pipe_check(rl_pipe_t *pipe)
 			LM_ERR("no algorithm defined for this pipe\n");
 			return 1;
 		case PIPE_ALGO_TAILDROP:
+			/* only this instance's share of the limit is enforced here */
+			if (pipe->distributed)
+				return (pipe->counter <= RL_PIPE_LIMIT(pipe) *
+					(rl_limit_per_interval ? 1 : rl_timer_interval)) ? 1 : -1;
 			return (counter <= pipe->limit *
 				(rl_limit_per_interval ? 1 : rl_timer_interval)) ? 1 : -1;
 		case PIPE_ALGO_RED:
@@ -590,6 +661,8 @@ int rl_pipe_check(rl_pipe_t *pipe)
 			return (hash[counter % 100] < *drop_rate) ? -1 : 1;
 		case PIPE_ALGO_HISTORY:
 			return hist_check(pipe);
+		case PIPE_ALGO_GCRA:
+			return gcra_check(pipe);
 		default:
 			LM_ERR("ratelimit algorithm %d not implemented\n", pipe->algo);
 	}
@@ -44,12 +44,15 @@ typedef enum {
 	PIPE_ALGO_RED,
 	PIPE_ALGO_FEEDBACK,
 	PIPE_ALGO_NETWORK,
-	PIPE_ALGO_HISTORY
+	PIPE_ALGO_HISTORY,
+	PIPE_ALGO_GCRA
 } rl_algo_t;
 
 typedef struct rl_repl_counter {
 	int counter;
 	time_t update;
+	int demand;				/* requests per second seen by the node */
+	utime_t demand_update;
         int machine_id;
         struct rl_repl_counter *next;
 } rl_repl_counter_t;
@@ -76,8 +79,17 @@ typedef struct rl_pipe {
 	unsigned long last_used;	/* timestamp when the pipe was last accessed */
 	rl_repl_counter_t *dsts;	/* counters per destination */
 	rl_window_t rwin;			/* window of requests */
+	unsigned long long tat;		/* GCRA theoretical arrival time, in ns */
+	int distributed;			/* the limit is shared by quotas with the cluster */
+	int quota;					/* this instance's share of the limit */
+	int demand;					/* requests since the last quota update */
+	int rate;					/* averaged requests per second */
 } rl_pipe_t;
 
+/* the limit enforced locally by the pipe */
+#define RL_PIPE_LIMIT(_p) \
+	((_p)->distributed && (_p)->quota < (_p)->limit ? (_p)->quota : (_p)->limit)
+
 typedef struct rl_repl_dst {
 	int id;
 	str dst;
@@ -101,17 +113,20 @@ extern int rl_expire_time;
 extern unsigned int rl_hash_size;
 extern int *rl_network_count;
 extern int *rl_network_load;
+extern int *rl_cluster_nodes;
 extern str rl_default_algo_s;
 extern str db_prefix;
 extern int rl_repl_cluster;
 extern int rl_window_size;
 extern int rl_slot_period;
+extern int rl_quota_interval;
 
 extern struct clusterer_binds clusterer_api;
 
 /* helper funcs */
 void mod_destroy(void);
 int init_rl_table(unsigned int size);
+rl_pipe_t *rl_create_pipe(int limit, rl_algo_t algo);
 
 /* exported functions */
 int w_rl_check_2(struct sip_msg*, char *, char *);
@@ -121,6 +136,7 @@ int w_rl_reset(struct sip_msg*, char *);
 int w_rl_set_count(str, int);
 int rl_stats(struct mi_root *, str *);
 int rl_pipe_check(rl_pipe_t *);
+int rl_pipe_idle(rl_pipe_t *, unsigned long long);
 int rl_get_counter_value(str *);
 /* update load */
 int get_cpuload(void);
@@ -130,6 +146,7 @@ void pid_setpoint_limit(int);
 /* timer */
 void rl_timer(unsigned int, void *);
 void rl_timer_repl(utime_t, void *);
+void rl_timer_quota(utime_t, void *);
 
 /* cachedb functions */
 int init_cachedb(str*);
@@ -144,6 +161,9 @@ int rl_add_repl_dst(modparam_t type, void *val);
 int rl_bin_status(struct mi_node *root, int cluster_id, char *type, int type_len);
 
 #define RL_PIPE_COUNTER		0
+#define RL_PIPE_DEMAND		1
+/* after how many quota intervals the demand of a node is discarded */
+#define RL_DEMAND_EXPIRE	3
 #define RL_EXPIRE_TIMER		10
 #define RL_BUF_THRESHOLD	1400
 
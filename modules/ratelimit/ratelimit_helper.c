@@ -51,6 +51,7 @@ static rl_algo_t rl_default_algo = PIPE_ALGO_NOP;
 
 /* other functions */
 static rl_algo_t get_rl_algo(str);
+static void rl_free_destinations(rl_pipe_t *pipe);
 
 /* big hash table */
 rl_big_htable rl_htable;
@@ -85,7 +86,14 @@ static str pipe_repl_cap = str_init("ratelimit-pipe-repl");
 
 /* returns true if the pipe should use cachedb interface */
 #define RL_USE_CDB(_p) \
-	(cdbc && (_p)->algo!=PIPE_ALGO_NETWORK && (_p)->algo!=PIPE_ALGO_FEEDBACK)
+	(cdbc && (_p)->algo!=PIPE_ALGO_NETWORK && (_p)->algo!=PIPE_ALGO_FEEDBACK && \
+		(_p)->algo!=PIPE_ALGO_GCRA)
+
+/* returns true if the pipe's limit should be split in quotas with the
+ * other instances of the cluster */
+#define RL_USE_QUOTA(_p) \
+	(rl_repl_cluster && rl_quota_interval > 0 && !RL_USE_CDB(_p) && \
+		((_p)->algo==PIPE_ALGO_TAILDROP || (_p)->algo==PIPE_ALGO_GCRA))
 
 
 
@@ -281,6 +289,7 @@ struct {
 	{ str_init("FEEDBACK"), PIPE_ALGO_FEEDBACK},
 	{ str_init("NETWORK"), PIPE_ALGO_NETWORK},
 	{ str_init("SBT"), PIPE_ALGO_HISTORY},
+	{ str_init("GCRA"), PIPE_ALGO_GCRA},
 	{
 		{ 0, 0}, 0
 	},
@@ -334,6 +343,15 @@ rl_pipe_t *rl_create_pipe(int limit, rl_algo_t algo)
 
 	pipe->algo = algo;
 	pipe->limit = limit;
+	pipe->distributed = RL_USE_QUOTA(pipe);
+	/* until the demand of the others is known, assume an even split */
+	if (pipe->distributed && limit > 0) {
+		pipe->quota = limit / *rl_cluster_nodes;
+		if (pipe->quota < 1)
+			pipe->quota = 1;
+	} else {
+		pipe->quota = limit;
+	}
 
 	if (algo == PIPE_ALGO_HISTORY) {
 		pipe->rwin.window = (long int *)(pipe + 1);
@@ -427,6 +445,7 @@ int w_rl_check_3(struct sip_msg *_m, char *_n, char *_l, char *_a)
 
 	/* set the last used time */
 	(*pipe)->last_used = time(0);
+	(*pipe)->demand++;
 	if (RL_USE_CDB(*pipe)) {
 		/* release the counter for a while */
 		if (rl_change_counter(&name, *pipe, 1) < 0) {
@@ -463,6 +482,11 @@ void rl_timer(unsigned int ticks, void *param)
 	str *key;
 	void *value;
 	unsigned long now = time(0);
+	unsigned long long now_ns;
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	now_ns = (unsigned long long)tv.tv_sec * 1000000000 + tv.tv_usec * 1000;
 
 	/* get CPU load */
 	if (get_cpuload() < 0) {
@@ -500,8 +524,9 @@ void rl_timer(unsigned int ticks, void *param)
 				LM_ERR("cannot retrieve pipe key\n");
 				goto next_pipe;
 			}
-			/* check to see if it is expired */
-			if ((*pipe)->last_used + rl_expire_time < now) {
+			/* check to see if it is expired or it holds no state anymore */
+			if ((*pipe)->last_used + rl_expire_time < now ||
+					rl_pipe_idle(*pipe, now_ns)) {
 				/* this pipe is engaged in a transaction */
 				del = it;
 				if (iterator_next(&it) < 0)
@@ -515,8 +540,10 @@ void rl_timer(unsigned int ticks, void *param)
 					key->len, key->s);
 				value = iterator_delete(&del);
 				/* free resources */
-				if (value)
+				if (value) {
+					rl_free_destinations((rl_pipe_t *)value);
 					shm_free(value);
+				}
 				continue;
 			} else {
 				/* leave the lock if a cachedb query should be done*/
@@ -622,6 +649,12 @@ static int rl_map_print(void *param, str key, void *value)
 	if (!(attr = add_mi_attr(node, MI_DUP_VALUE, "counter", 7, p, len)))
 		return -1;
 
+	if (pipe->distributed) {
+		p = int2str((unsigned long)RL_PIPE_LIMIT(pipe), &len);
+		if (!(attr = add_mi_attr(node, MI_DUP_VALUE, "quota", 5, p, len)))
+			return -1;
+	}
+
 	if ((++rl_param->counter % 50) == 0) {
 		LM_DBG("flush mi tree - number %d\n", rl_param->counter);
 		flush_mi_tree(rl_param->root);
@@ -797,6 +830,7 @@ static rl_repl_counter_t* find_destination(rl_pipe_t *pipe, int machine_id)
 			LM_ERR("no more shm memory\n");
 			goto error;
 		}
+		memset(head, 0, sizeof(rl_repl_counter_t));
 		head->machine_id = machine_id;
 		head->next = pipe->dsts;
 		pipe->dsts = head;
@@ -808,6 +842,16 @@ error:
 	return NULL;
 }
 
+static void rl_free_destinations(rl_pipe_t *pipe)
+{
+	rl_repl_counter_t *d, *next;
+
+	for (d = pipe->dsts; d; d = next) {
+		next = d->next;
+		shm_free(d);
+	}
+}
+
 
 
 
@@ -820,15 +864,17 @@ void rl_rcv_bin(bin_packet_t *packet)
 	rl_pipe_t **pipe;
 	unsigned int hash_idx;
 	time_t now;
+	utime_t now_ut;
 	rl_repl_counter_t *destination;
 
-	if (packet->type != RL_PIPE_COUNTER) {
+	if (packet->type != RL_PIPE_COUNTER && packet->type != RL_PIPE_DEMAND) {
 		LM_WARN("Invalid binary packet command: %d (from node: %d in cluster: %d)\n",
 			packet->type, packet->src_id, rl_repl_cluster);
 		return;
 	}
 
 	now = time(0);
+	now_ut = get_uticks();
 
 	for (;;) {
 		if (bin_pop_str(packet, &name) == 1)
@@ -886,8 +932,13 @@ void rl_rcv_bin(bin_packet_t *packet)
 		destination = find_destination(*pipe, packet->src_id);
 		if (!destination)
 			goto release;
-		destination->counter = counter;
-		destination->update = now;
+		if (packet->type == RL_PIPE_DEMAND) {
+			destination->demand = counter;
+			destination->demand_update = now_ut;
+		} else {
+			destination->counter = counter;
+			destination->update = now;
+		}
 		RL_RELEASE_LOCK(hash_idx);
 	}
 	return;
@@ -1017,8 +1068,10 @@ void rl_timer_repl(utime_t ticks, void *param)
 				LM_ERR("[BUG] bogus map[%d] state\n", i);
 				goto next_pipe;
 			}
-			/* ignore cachedb replicated stuff */
-			if (RL_USE_CDB(*pipe))
+			/* ignore cachedb replicated stuff, the local only pipes and the
+			 * ones which exchange their demand instead of their counters */
+			if (RL_USE_CDB(*pipe) || (*pipe)->algo == PIPE_ALGO_GCRA ||
+					(*pipe)->distributed)
 				goto next_pipe;
 
 			key = iterator_key(&it);
@@ -1074,6 +1127,147 @@ error:
 	bin_free_packet(&packet);
 }
 
+/*
+ * Splits the limit of the pipe between the instances of the cluster,
+ * proportionally to the demand each of them has seen lately. Every instance
+ * also keeps a small reserve, so it can start accepting requests before the
+ * others learn about its demand. As all the instances use the same figures,
+ * the sum of the quotas tracks the configured limit.
+ * (expects the pipe's lock to be taken)
+ */
+static void rl_update_quota(rl_pipe_t *pipe, utime_t now)
+{
+	rl_repl_counter_t *d;
+	utime_t expire = (utime_t)RL_DEMAND_EXPIRE * rl_quota_interval * 1000;
+	long long total, reserve;
+	int nodes = 1;
+
+	/* requests per second, averaged with the previous value */
+	pipe->rate = (pipe->rate + pipe->demand * 1000 / rl_quota_interval) / 2;
+	pipe->demand = 0;
+
+	total = pipe->rate;
+	for (d = pipe->dsts; d; d = d->next) {
+		/* the node stopped sending its demand */
+		if (!d->demand_update || now - d->demand_update > expire)
+			continue;
+		total += d->demand;
+		nodes++;
+	}
+
+	if (pipe->limit <= 0) {
+		pipe->quota = 0;
+		return;
+	}
+
+	reserve = pipe->limit / (10 * nodes) + 1;
+	pipe->quota = (int)((long long)pipe->limit * (pipe->rate + reserve) /
+		(total + nodes * reserve));
+	/* a small limit split between many nodes must not block this one */
+	if (pipe->quota < 1)
+		pipe->quota = 1;
+}
+
+void rl_timer_quota(utime_t ticks, void *param)
+{
+	unsigned int i = 0;
+	map_iterator_t it;
+	rl_pipe_t **pipe;
+	str *key;
+	int nr = 0;
+	int ret, last_rate;
+	utime_t now = get_uticks();
+	bin_packet_t packet;
+	clusterer_node_t *cl_nodes, *cl_it;
+	int cl_nr;
+
+	/* refresh the number of instances the new pipes are initially split
+	 * between (not from the pipe creation, which may run in a clusterer
+	 * callback) */
+	cl_nodes = clusterer_api.get_nodes(rl_repl_cluster);
+	for (cl_nr = 1, cl_it = cl_nodes; cl_it; cl_it = cl_it->next)
+		cl_nr++;
+	if (cl_nodes)
+		clusterer_api.free_nodes(cl_nodes);
+	*rl_cluster_nodes = cl_nr;
+
+	if (bin_init(&packet, &pipe_repl_cap, RL_PIPE_DEMAND, BIN_VERSION, 0) < 0) {
+		LM_ERR("cannot initiate bin buffer\n");
+		return;
+	}
+
+	/* iterate through each map */
+	for (i = 0; i < rl_htable.size; i++) {
+		RL_GET_LOCK(i);
+		/* iterate through all the entries */
+		if (map_first(rl_htable.maps[i], &it) < 0) {
+			LM_ERR("map doesn't exist\n");
+			goto next_map;
+		}
+		for (; iterator_is_valid(&it);) {
+			pipe = (rl_pipe_t **) iterator_val(&it);
+			if (!pipe || !*pipe) {
+				LM_ERR("[BUG] bogus map[%d] state\n", i);
+				goto next_pipe;
+			}
+			if (!(*pipe)->distributed)
+				goto next_pipe;
+
+			last_rate = (*pipe)->rate;
+			rl_update_quota(*pipe, now);
+
+			/* the idle pipes are not advertised, except for the last
+			 * update, which lets the others know the demand is gone */
+			if (!(*pipe)->rate && !last_rate)
+				goto next_pipe;
+
+			key = iterator_key(&it);
+			if (!key) {
+				LM_ERR("cannot retrieve pipe key\n");
+				goto next_pipe;
+			}
+
+			if (bin_push_str(&packet, key) < 0)
+				goto error;
+
+			if (bin_push_int(&packet, (*pipe)->algo) < 0)
+				goto error;
+
+			if (bin_push_int(&packet, (*pipe)->limit) < 0)
+				goto error;
+
+			if ((ret = bin_push_int(&packet, (*pipe)->rate)) < 0)
+				goto error;
+			nr++;
+
+			if (ret > rl_buffer_th) {
+				/* send the buffer */
+				if (nr)
+					rl_replicate(&packet);
+				bin_reset_back_pointer(&packet);
+				nr = 0;
+			}
+
+next_pipe:
+			if (iterator_next(&it) < 0)
+				break;
+		}
+next_map:
+		RL_RELEASE_LOCK(i);
+	}
+	/* if there is anything else to send, do it now */
+	if (nr)
+		rl_replicate(&packet);
+	bin_free_packet(&packet);
+	return;
+error:
+	LM_ERR("cannot add pipe demand in buffer\n");
+	RL_RELEASE_LOCK(i);
+	if (nr)
+		rl_replicate(&packet);
+	bin_free_packet(&packet);
+}
+
 int rl_get_all_counters(rl_pipe_t *pipe)
 {
 	unsigned counter = 0;
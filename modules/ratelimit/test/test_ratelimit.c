@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../../../str.h"
+#include "../../../mod_fix.h"
+#include "../../../mem/shm_mem.h"
+
+#include "../ratelimit.h"
+
+#define BURST_LIMIT		1000
+#define BENCH_CHECKS	1000000
+#define BENCH_KEYS		100000
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* a full bucket lets a burst of "limit" requests in, then nothing until
+ * it refills; it holds no state once refilled */
+static void test_gcra_burst(void)
+{
+	rl_pipe_t *pipe;
+	int i, admitted = 0;
+
+	pipe = rl_create_pipe(BURST_LIMIT, PIPE_ALGO_GCRA);
+	if (!ok(pipe != NULL, "ratelimit: create a GCRA pipe"))
+		return;
+
+	for (i = 0; i < 2 * BURST_LIMIT; i++)
+		if (rl_pipe_check(pipe) == 1)
+			admitted++;
+
+	/* the bucket refills by one every ms meanwhile */
+	ok(admitted >= BURST_LIMIT && admitted <= BURST_LIMIT + 10,
+		"ratelimit: GCRA admits a burst of %d out of %d (limit %d)",
+		admitted, 2 * BURST_LIMIT, BURST_LIMIT);
+
+	ok(!rl_pipe_idle(pipe, (unsigned long long)time(NULL) * 1000000000ULL) &&
+		rl_pipe_idle(pipe, (unsigned long long)(time(NULL) + 2) * 1000000000ULL),
+		"ratelimit: an empty GCRA bucket is idle only once refilled");
+
+	shm_free(pipe);
+}
+
+/* checks per second through rl_check(), pipe lookup and locking included,
+ * spread over @keys pipes of their own */
+static void bench_check(char *algo, int keys)
+{
+	static char key_buf[BENCH_KEYS][24];
+	static str key[BENCH_KEYS];
+	gparam_t name, limit, algorithm;
+	unsigned long long start, elapsed;
+	int i, admitted = 0;
+
+	for (i = 0; i < keys; i++) {
+		key[i].s = key_buf[i];
+		key[i].len = sprintf(key_buf[i], "%.4s/10.%d.%d.%d", algo, i >> 16,
+			(i >> 8) & 0xff, i & 0xff);
+	}
+
+	name.type = GPARAM_TYPE_STR;
+	limit.type = GPARAM_TYPE_INT;
+	limit.v.ival = 1000000;
+	algorithm.type = GPARAM_TYPE_STR;
+	init_str(&algorithm.v.sval, algo);
+
+	start = now_ns();
+	for (i = 0; i < BENCH_CHECKS; i++) {
+		name.v.sval = key[i % keys];
+		if (w_rl_check_3(NULL, (char *)&name, (char *)&limit,
+		        (char *)&algorithm) == 1)
+			admitted++;
+	}
+	elapsed = now_ns() - start;
+
+	ok(admitted > 0, "ratelimit: %s, %d pipe(s) - %llu checks/s", algo, keys,
+		BENCH_CHECKS * 1000000000ULL / (elapsed ? elapsed : 1));
+}
+
+void mod_tests(void)
+{
+	if (!ok(init_rl_table(RL_HASHSIZE) == 0, "ratelimit: init the pipes table"))
+		return;
+
+	test_gcra_burst();
+
+	bench_check("TAILDROP", 1);
+	bench_check("GCRA", 1);
+	bench_check("TAILDROP", BENCH_KEYS);
+	bench_check("GCRA", BENCH_KEYS);
+
+	mod_destroy();
+}
@@ -37,6 +37,7 @@
 #include "../../config.h"
 #include "../../action.h"
 #include "../../mod_fix.h"
+#include "../../async.h"
 #include "../../parser/parse_rr.h"
 #include "../usrloc/usrloc.h"
 #include "../../parser/parse_from.h"
@@ -124,44 +125,23 @@ ucontact_t **sanitize_contacts(ucontact_t *contacts, int flags, int max_latency)
 	return sorted_cts;
 }
 
-/*! \brief
- * Lookup contact in the database and rewrite Request-URI
- * \return: -1 : not found
- *          -2 : found but method not allowed
- *          -3 : error
- */
-int lookup(struct sip_msg* _m, char* _t, char* _f, char* _s)
-{
+struct lookup_flags {
 	unsigned int flags;
-	urecord_t* r;
-	str aor, uri;
-	ucontact_t **ptr, **it;
-	int res;
-	int ret;
-	str path_dst;
+	int regexp_flags;
+	/* the user agent filter regexp - not null terminated */
+	char *ua;
+	int re_len;
+	int max_latency;
+};
+
+static int parse_lookup_flags(struct sip_msg* _m, char* _f,
+												struct lookup_flags *lf)
+{
 	str flags_s;
-	char* ua = NULL;
 	char* re_end = NULL;
-	int re_len = 0;
-	char tmp;
-	regex_t ua_re;
-	int regexp_flags = 0;
-	regmatch_t ua_match;
-	pv_value_t val;
-	int_str istr;
-	str sip_instance = STR_NULL, call_id = STR_NULL;
-	int max_latency = 0;
-
-	/* branch index */
-	int idx;
-
-	/* temporary branch values*/
-	int tlen;
-	char *turi;
-
-	qvalue_t tq;
+	int res;
 
-	flags = 0;
+	memset(lf, 0, sizeof *lf);
 	if (_f && _f[0]!=0) {
 		if (fixup_get_svalue( _m, (gparam_p)_f, &flags_s)!=0) {
 			LM_ERR("invalid owner uri parameter");
@@ -169,10 +149,10 @@ int lookup(struct sip_msg* _m, char* _t, char* _f, char* _s)
 		}
 		for( res=0 ; res< flags_s.len ; res++ ) {
 			switch (flags_s.s[res]) {
-				case 'm': flags |= REG_LOOKUP_METHODFILTER_FLAG; break;
-				case 'b': flags |= REG_LOOKUP_NOBRANCH_FLAG; break;
-				case 'l': flags |= REG_LOOKUP_LOCAL_ONLY_FLAG; break;
-				case 'r': flags |= REG_BRANCH_AOR_LOOKUP_FLAG; break;
+				case 'm': lf->flags |= REG_LOOKUP_METHODFILTER_FLAG; break;
+				case 'b': lf->flags |= REG_LOOKUP_NOBRANCH_FLAG; break;
+				case 'l': lf->flags |= REG_LOOKUP_LOCAL_ONLY_FLAG; break;
+				case 'r': lf->flags |= REG_BRANCH_AOR_LOOKUP_FLAG; break;
 				case 'u':
 					if (flags_s.s[res+1] != '/') {
 						LM_ERR("no regexp after 'u' flag");
@@ -184,58 +164,70 @@ int lookup(struct sip_msg* _m, char* _t, char* _f, char* _s)
 						break;
 					}
 					res++;
-					re_len = re_end-flags_s.s-res;
-					if (re_len == 0) {
+					lf->re_len = re_end-flags_s.s-res;
+					if (lf->re_len == 0) {
 						LM_ERR("empty regexp");
 						break;
 					}
-					ua = flags_s.s+res;
-					flags |= REG_LOOKUP_UAFILTER_FLAG;
-					LM_DBG("found regexp /%.*s/", re_len, ua);
-					res += re_len;
+					lf->ua = flags_s.s+res;
+					lf->flags |= REG_LOOKUP_UAFILTER_FLAG;
+					LM_DBG("found regexp /%.*s/", lf->re_len, lf->ua);
+					res += lf->re_len;
 					break;
-				case 'i': regexp_flags |= REG_ICASE; break;
-				case 'e': regexp_flags |= REG_EXTENDED; break;
+				case 'i': lf->regexp_flags |= REG_ICASE; break;
+				case 'e': lf->regexp_flags |= REG_EXTENDED; break;
 				case 'y':
-					max_latency = 0;
+					lf->max_latency = 0;
 					while (res<flags_s.len-1 && isdigit(flags_s.s[res+1])) {
-						max_latency = max_latency*10 + flags_s.s[res+1] - '0';
+						lf->max_latency = lf->max_latency*10 + flags_s.s[res+1] - '0';
 						res++;
 					}
 
-					if (max_latency)
-						flags |= REG_LOOKUP_MAX_LATENCY_FLAG;
+					if (lf->max_latency)
+						lf->flags |= REG_LOOKUP_MAX_LATENCY_FLAG;
 					else
-						flags &= ~REG_LOOKUP_MAX_LATENCY_FLAG;
+						lf->flags &= ~REG_LOOKUP_MAX_LATENCY_FLAG;
 					break;
-				case 'Y': flags |= REG_LOOKUP_LATENCY_SORT_FLAG; break;
+				case 'Y': lf->flags |= REG_LOOKUP_LATENCY_SORT_FLAG; break;
 				default: LM_WARN("unsupported flag %c \n",flags_s.s[res]);
 			}
 		}
 	}
 
-	if (flags&REG_BRANCH_AOR_LOOKUP_FLAG) {
-		/* extract all the branches for further usage */
-		nbranches = 0;
-		while (
-			(turi=get_branch(nbranches, &tlen, &tq, NULL, NULL, NULL, NULL))
-				) {
-			/* copy uri */
-			branch_uris[nbranches].s = urimem[nbranches];
-			if (tlen) {
-				memcpy(branch_uris[nbranches].s, turi, tlen);
-				branch_uris[nbranches].len = tlen;
-			} else {
-				*branch_uris[nbranches].s  = '\0';
-				branch_uris[nbranches].len = 0;
-			}
+	return 0;
+}
 
-			nbranches++;
+/* extract all the branches for further usage (the "r" flag) */
+static void save_branch_uris(void)
+{
+	int tlen;
+	char *turi;
+	qvalue_t tq;
+
+	nbranches = 0;
+	while (
+		(turi=get_branch(nbranches, &tlen, &tq, NULL, NULL, NULL, NULL))
+			) {
+		/* copy uri */
+		branch_uris[nbranches].s = urimem[nbranches];
+		if (tlen) {
+			memcpy(branch_uris[nbranches].s, turi, tlen);
+			branch_uris[nbranches].len = tlen;
+		} else {
+			*branch_uris[nbranches].s  = '\0';
+			branch_uris[nbranches].len = 0;
 		}
-		clear_branches();
-		idx=0;
+
+		nbranches++;
 	}
+	clear_branches();
+}
 
+static int get_lookup_aor(struct sip_msg* _m, char* _s, str *aor,
+									str *sip_instance, str *call_id)
+{
+	pv_value_t val;
+	str uri;
 
 	if (_s) {
 		if (pv_get_spec_value( _m, (pv_spec_p)_s, &val)!=0) {
@@ -252,27 +244,49 @@ int lookup(struct sip_msg* _m, char* _t, char* _f, char* _s)
 		else uri = _m->first_line.u.request.uri;
 	}
 
-	if (extract_aor(&uri, &aor, &sip_instance, &call_id) < 0) {
+	if (extract_aor(&uri, aor, sip_instance, call_id) < 0) {
 		LM_ERR("failed to extract address of record\n");
 		return -3;
 	}
 
-	update_act_time();
+	return 0;
+}
 
-	ul.lock_udomain((udomain_t*)_t, &aor);
-	res = ul.get_urecord((udomain_t*)_t, &aor, &r);
-	if (res > 0) {
-		LM_DBG("'%.*s' Not found in usrloc\n", aor.len, ZSW(aor.s));
-		ul.unlock_udomain((udomain_t*)_t, &aor);
-		return -1;
-	}
+/*! \brief
+ * The core of the lookup, once the record of the AOR is available - the
+ * domain must be locked and it is unlocked (and the record released)
+ * before returning
+ */
+static int lookup_contacts(struct sip_msg* _m, udomain_t* _t,
+		struct lookup_flags *lf, urecord_t* r, str *_aor,
+		str *_sip_instance, str *_call_id)
+{
+	unsigned int flags = lf->flags;
+	str aor = *_aor, uri;
+	ucontact_t **ptr, **it;
+	int res;
+	int ret;
+	str path_dst;
+	char* ua = lf->ua;
+	int re_len = lf->re_len;
+	char tmp;
+	regex_t ua_re;
+	regmatch_t ua_match;
+	int_str istr;
+	str sip_instance = *_sip_instance, call_id = *_call_id;
+	int max_latency = lf->max_latency;
+
+	/* branch index */
+	int idx = 0;
 
 	if (flags & REG_LOOKUP_UAFILTER_FLAG) {
 		tmp = *(ua+re_len);
 		*(ua+re_len) = '\0';
-		if (regcomp(&ua_re, ua, regexp_flags) != 0) {
+		if (regcomp(&ua_re, ua, lf->regexp_flags) != 0) {
 			LM_ERR("bad regexp '%s'\n", ua);
 			*(ua+re_len) = tmp;
+			ul.release_urecord(r, 0);
+			ul.unlock_udomain(_t, &aor);
 			return -1;
 		}
 		*(ua+re_len) = tmp;
@@ -504,7 +518,7 @@ have_contact:
 
 		/* relsease old aor lock */
 		ul.release_urecord(r, 0);
-		ul.unlock_udomain((udomain_t *)_t, &aor);
+		ul.unlock_udomain(_t, &aor);
 
 		/* idx starts from -1 */
 		uri = branch_uris[idx];
@@ -518,8 +532,8 @@ have_contact:
 		/* get lock on new aor */
 		LM_DBG("getting contacts from aor [%.*s] "
 		       "in branch %d\n", aor.len, aor.s, idx);
-		ul.lock_udomain((udomain_t*)_t, &aor);
-		res = ul.get_urecord((udomain_t*)_t, &aor, &r);
+		ul.lock_udomain(_t, &aor);
+		res = ul.get_urecord(_t, &aor, &r);
 
 		if (res > 0) {
 			LM_DBG("aor '%.*s' not found in usrloc\n", aor.len, aor.s);
@@ -535,13 +549,173 @@ have_contact:
 
 done:
 	ul.release_urecord(r, 0);
-	ul.unlock_udomain((udomain_t*)_t, &aor);
+	ul.unlock_udomain(_t, &aor);
 	if (flags & REG_LOOKUP_UAFILTER_FLAG) {
 		regfree(&ua_re);
 	}
 	return ret;
 }
 
+/*! \brief
+ * Lookup contact in the database and rewrite Request-URI
+ * \return: -1 : not found
+ *          -2 : found but method not allowed
+ *          -3 : error
+ */
+int lookup(struct sip_msg* _m, char* _t, char* _f, char* _s)
+{
+	struct lookup_flags lf;
+	urecord_t* r;
+	str aor, sip_instance = STR_NULL, call_id = STR_NULL;
+	int ret;
+
+	if (parse_lookup_flags(_m, _f, &lf) != 0)
+		return -1;
+
+	if (lf.flags & REG_BRANCH_AOR_LOOKUP_FLAG)
+		save_branch_uris();
+
+	if ((ret = get_lookup_aor(_m, _s, &aor, &sip_instance, &call_id)) != 0)
+		return ret;
+
+	update_act_time();
+
+	ul.lock_udomain((udomain_t*)_t, &aor);
+	if (ul.get_urecord((udomain_t*)_t, &aor, &r) > 0) {
+		LM_DBG("'%.*s' Not found in usrloc\n", aor.len, ZSW(aor.s));
+		ul.unlock_udomain((udomain_t*)_t, &aor);
+		return -1;
+	}
+
+	return lookup_contacts(_m, (udomain_t*)_t, &lf, r, &aor,
+		&sip_instance, &call_id);
+}
+
+
+struct lookup_async_param {
+	udomain_t *d;
+	struct lookup_flags lf;
+	str aor;
+	str sip_instance;
+	str call_id;
+	/* usrloc's own resume context */
+	void *ul_ctx;
+	/* the strings above are copied here, as the resumed message
+	 * is not the one the lookup was started with */
+	char buf[0];
+};
+
+static int resume_async_lookup(int fd, struct sip_msg *msg, void *_param)
+{
+	struct lookup_async_param *param = (struct lookup_async_param *)_param;
+	urecord_t *r;
+	int rc, ret;
+
+	rc = ul.resume_urecord_async(fd, param->ul_ctx, &r);
+	if (async_status == ASYNC_CONTINUE || async_status == ASYNC_CHANGE_FD)
+		return rc;
+
+	async_status = ASYNC_DONE;
+
+	if (rc != 0) {
+		LM_ERR("failed to load '%.*s' from usrloc\n",
+			param->aor.len, param->aor.s);
+		ret = -3;
+		goto out;
+	}
+
+	if (param->lf.flags & REG_BRANCH_AOR_LOOKUP_FLAG)
+		save_branch_uris();
+
+	update_act_time();
+
+	if (!r) {
+		LM_DBG("'%.*s' Not found in usrloc\n", param->aor.len,
+			ZSW(param->aor.s));
+		ret = -1;
+		goto out;
+	}
+
+	ul.lock_udomain(param->d, &param->aor);
+	ret = lookup_contacts(msg, param->d, &param->lf, r, &param->aor,
+		&param->sip_instance, &param->call_id);
+
+out:
+	pkg_free(param);
+	return ret;
+}
+
+int async_lookup(struct sip_msg* _m, async_ctx *ctx,
+									char* _t, char* _f, char* _s)
+{
+	struct lookup_async_param *param;
+	struct lookup_flags lf;
+	str aor, sip_instance = STR_NULL, call_id = STR_NULL;
+	char *p;
+	int ret, fd;
+
+	if (parse_lookup_flags(_m, _f, &lf) != 0)
+		return -1;
+
+	if ((ret = get_lookup_aor(_m, _s, &aor, &sip_instance, &call_id)) != 0)
+		return ret;
+
+	/* the UA regexp gets temporarily null terminated - one more byte */
+	param = pkg_malloc(sizeof *param + aor.len + sip_instance.len +
+		call_id.len + lf.re_len + 1);
+	if (!param) {
+		LM_ERR("no more pkg mem\n");
+		return -3;
+	}
+
+	param->d = (udomain_t *)_t;
+	param->lf = lf;
+	p = param->buf;
+
+	param->aor.s = p;
+	param->aor.len = aor.len;
+	memcpy(p, aor.s, aor.len);
+	p += aor.len;
+
+	param->sip_instance = sip_instance;
+	if (sip_instance.s) {
+		param->sip_instance.s = p;
+		memcpy(p, sip_instance.s, sip_instance.len);
+		p += sip_instance.len;
+	}
+
+	param->call_id = call_id;
+	if (call_id.s) {
+		param->call_id.s = p;
+		memcpy(p, call_id.s, call_id.len);
+		p += call_id.len;
+	}
+
+	if (lf.ua) {
+		param->lf.ua = p;
+		memcpy(p, lf.ua, lf.re_len);
+	}
+
+	fd = ul.get_urecord_async(param->d, &param->aor, &param->ul_ctx);
+	if (fd == -2) {
+		/* usrloc cannot do it (not sql-only or no async DB support) */
+		pkg_free(param);
+		ctx->resume_param = NULL;
+		ctx->resume_f = NULL;
+		async_status = ASYNC_NO_IO;
+		return lookup(_m, _t, _f, _s);
+	} else if (fd < 0) {
+		pkg_free(param);
+		return -3;
+	}
+
+	ctx->resume_param = param;
+	ctx->resume_f = resume_async_lookup;
+
+	async_status = fd;
+	return 1;
+}
+
 
 struct to_body* select_uri(struct sip_msg* _m)
 {
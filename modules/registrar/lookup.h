@@ -31,6 +31,7 @@
 #define LOOKUP_H
 
 #include "../../parser/msg_parser.h"
+#include "../../async.h"
 
 
 /*! \brief
@@ -38,6 +39,13 @@
  */
 int lookup(struct sip_msg* _m, char* _table, char* _flags, char* _aor);
 
+/*! \brief
+ * Same as lookup(), but in sql-only mode the AOR is loaded from the
+ * database without blocking the process
+ */
+int async_lookup(struct sip_msg* _m, async_ctx *ctx,
+		char* _table, char* _flags, char* _aor);
+
 /*! \brief the is_registered() function
  * Return 1 if the AOR is registered, -1 otherwise
  * AOR comes from:
@@ -140,6 +140,16 @@ struct sig_binds sigb;
 struct tm_binds tmb;
 
 
+/*! \brief
+ * Exported async functions
+ */
+static acmd_export_t acmds[] = {
+	{"lookup", (acmd_function)async_lookup, 1, registrar_fixup },
+	{"lookup", (acmd_function)async_lookup, 2, registrar_fixup },
+	{"lookup", (acmd_function)async_lookup, 3, registrar_fixup },
+	{0, 0, 0, 0}
+};
+
 /*! \brief
  * Exported functions
  */
@@ -246,7 +256,7 @@ struct module_exports exports = {
 	DEFAULT_DLFLAGS, /* dlopen flags */
 	&deps,           /* OpenSIPS module dependencies */
 	cmds,        /* Exported functions */
-	0,           /* Exported async functions */
+	acmds,       /* Exported async functions */
 	params,      /* Exported parameters */
 	mod_stats,   /* exported statistics */
 	0,           /* exported MI functions */
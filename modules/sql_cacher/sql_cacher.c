@@ -33,6 +33,8 @@
 #include "../../rw_locking.h"
 #include "../../timer.h"
 #include "../../ipc.h"
+#include "../../async.h"
+#include "../../mod_fix.h"
 #include "sql_cacher.h"
 
 static int mod_init(void);
@@ -46,12 +48,17 @@ static int parse_cache_entry(unsigned int type, void *val);
 
 static struct mi_root* mi_reload(struct mi_root *cmd_tree, void *param);
 
+static int fixup_sql_cacher_load(void **param, int param_no);
+static int w_sql_cacher_load(struct sip_msg *msg, async_ctx *ctx,
+								char *id_p, char *key_p);
+
 static str spec_delimiter = str_init(DEFAULT_SPEC_DELIM);
 static str pvar_delimiter = str_init(DEFAULT_PVAR_DELIM);
 static str columns_delimiter = str_init(DEFAULT_COLUMNS_DELIM);
 static int fetch_nr_rows = DEFAULT_FETCH_NR_ROWS;
 static int full_caching_expire = DEFAULT_FULL_CACHING_EXPIRE;
 static int reload_interval = DEFAULT_RELOAD_INTERVAL;
+static int delta_reload_interval = DEFAULT_DELTA_RELOAD_INTERVAL;
 
 static cache_entry_t **entry_list;
 static struct queried_key **queries_in_progress;
@@ -69,10 +76,17 @@ static param_export_t mod_params[] = {
 	{"sql_fetch_nr_rows", INT_PARAM, &fetch_nr_rows},
 	{"full_caching_expire", INT_PARAM, &full_caching_expire},
 	{"reload_interval", INT_PARAM, &reload_interval},
+	{"delta_reload_interval", INT_PARAM, &delta_reload_interval},
 	{"cache_table", STR_PARAM|USE_FUNC_PARAM, (void *)&parse_cache_entry},
 	{0,0,0}
 };
 
+static acmd_export_t acmds[] = {
+	{"sql_cacher_load", (acmd_function)w_sql_cacher_load, 2,
+		fixup_sql_cacher_load},
+	{0, 0, 0, 0}
+};
+
 static pv_export_t mod_items[] = {
 	{{"sql_cached_value", sizeof("sql_cached_value") - 1}, 1000,
 		pv_get_sql_cached_value, 0, pv_parse_name, 0, 0, 0},
@@ -105,7 +119,7 @@ struct module_exports exports = {
 	DEFAULT_DLFLAGS,			/* dlopen flags */
 	&deps,						/* OpenSIPS module dependencies */
 	0,							/* exported functions */
-	0,							/* exported async functions */
+	acmds,						/* exported async functions */
 	mod_params,					/* exported parameters */
 	0,							/* exported statistics */
 	mi_cmds,					/* exported MI functions */
@@ -152,6 +166,9 @@ static int parse_cache_entry(unsigned int type, void *val)
 		new_entry->columns = NULL;
 		new_entry->nr_columns = 0;
 		new_entry->on_demand = 0;
+		new_entry->updated_at.s = NULL;
+		new_entry->updated_at.len = 0;
+		new_entry->has_last_update = 0;
 		new_entry->expire = DEFAULT_ON_DEMAND_EXPIRE;
 		new_entry->nr_ints = 0;
 		new_entry->nr_strs = 0;
@@ -357,6 +374,42 @@ static int parse_cache_entry(unsigned int type, void *val)
 			}
 		}
 
+		/* parse updated_at parameter */
+		if (!memcmp(p1, UPDATED_AT_STR, UPDATED_AT_STR_LEN)) {
+			if (*(p1+UPDATED_AT_STR_LEN) != '=') {
+				LM_ERR("expected: '=' after: %.*s\n", UPDATED_AT_STR_LEN, UPDATED_AT_STR);
+				goto parse_err;
+			}
+			tmp = memchr(p2 + 1, spec_delimiter.s[0],
+					parse_str.len - (p2 - parse_str.s));
+			if (!tmp) /* delimiter not found, reached the end of the string to parse */
+				new_entry->updated_at.len = parse_str.len - (p2 - parse_str.s + 1);
+			else
+				new_entry->updated_at.len = tmp - p2 - 1;
+
+			if (new_entry->updated_at.len <= 0) {
+				LM_ERR("expected value of: %.*s\n", UPDATED_AT_STR_LEN, UPDATED_AT_STR);
+				goto parse_err;
+			}
+			new_entry->updated_at.s = shm_malloc(new_entry->updated_at.len);
+			if (!new_entry->updated_at.s) {
+				LM_ERR("No more shm memory\n");
+				goto parse_err;
+			}
+			memcpy(new_entry->updated_at.s, p2 + 1, new_entry->updated_at.len);
+
+			if (!tmp) /* delimiter not found, reached the end of the string to parse */
+				goto end_parsing;
+			else {
+				p1 = tmp + 1;
+				p2 = memchr(p1, '=', parse_str.len - (p1 - parse_str.s));
+				if (!p2) {
+					LM_ERR("expected: '='\n");
+					goto parse_err;
+				}
+			}
+		}
+
 		/* parse expire parameter */
 		if (!memcmp(p1, EXPIRE_STR, EXPIRE_STR_LEN)) {
 			str str_val;
@@ -402,6 +455,8 @@ parse_err:
 				}
 			shm_free(new_entry->columns);
 		}
+		if (new_entry->updated_at.s)
+			shm_free(new_entry->updated_at.s);
 		shm_free(new_entry);
 		pkg_free(parse_str_copy.s);
 
@@ -620,7 +675,7 @@ static db_handlers_t *db_init_test_conn(cache_entry_t *c_entry)
 	str test_query_key_str = str_init(TEST_QUERY_STR);
 	str cdb_test_key = str_init(CDB_TEST_KEY_STR);
 	str cdb_test_val = str_init(CDB_TEST_VAL_STR);
-	db_key_t query_key_col;
+	db_key_t query_key_col, updated_at_col;
 	db_val_t query_key_val;
 	db_res_t *sql_res;
 	str cachedb_res;
@@ -729,19 +784,74 @@ static db_handlers_t *db_init_test_conn(cache_entry_t *c_entry)
 	}
 
 	new_db_hdls->db_funcs.free_result(new_db_hdls->db_con, sql_res);
+
+	/* also verify the "updated_at" column, used for the delta reloads */
+	if (c_entry->updated_at.s) {
+		updated_at_col = &c_entry->updated_at;
+		if (new_db_hdls->db_funcs.query(new_db_hdls->db_con, &query_key_col, 0,
+			&query_key_val, &updated_at_col, 1, 1, 0, &sql_res) != 0) {
+			LM_ERR("Failure to issue test query for column: %.*s to SQL DB: "
+				"%.*s\n", c_entry->updated_at.len, c_entry->updated_at.s,
+				c_entry->db_url.len, c_entry->db_url.s);
+			new_db_hdls->db_funcs.close(new_db_hdls->db_con);
+			new_db_hdls->db_con = 0;
+			return NULL;
+		}
+		new_db_hdls->db_funcs.free_result(new_db_hdls->db_con, sql_res);
+	}
+
 	return new_db_hdls;
 }
 
+static void update_last_seen(cache_entry_t *c_entry, db_val_t *val)
+{
+	long long v;
+
+	if (VAL_NULL(val))
+		return;
+
+	switch (VAL_TYPE(val)) {
+		case DB_DATETIME:
+			v = (long long)VAL_TIME(val);
+			break;
+		case DB_INT:
+			v = VAL_INT(val);
+			break;
+		case DB_BIGINT:
+			v = VAL_BIGINT(val);
+			break;
+		default:
+			LM_ERR("Unsupported type: %d for column: %.*s\n", VAL_TYPE(val),
+				c_entry->updated_at.len, c_entry->updated_at.s);
+			return;
+	}
+
+	if (!c_entry->has_last_update || v > c_entry->last_update) {
+		c_entry->last_update = v;
+		c_entry->last_update_type = VAL_TYPE(val);
+		c_entry->has_last_update = 1;
+	}
+}
+
+/* with @delta set, only the rows changed since the last load are queried;
+ * the rows stamped in the very same second are loaded again, as they may
+ * have been changed after the previous load */
 static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
-								int reload_version)
+								int reload_version, int delta)
 {
 	db_key_t *query_cols = NULL;
+	db_key_t upd_col;
+	db_op_t upd_op = OP_GEQ;
+	db_val_t upd_val;
 	db_res_t *sql_res = NULL;
 	db_row_t *row;
 	db_val_t *values;
-	int i;
+	int i, nr_cols, nr_keys = 0;
 
-	query_cols = pkg_malloc((c_entry->nr_columns + 1) * sizeof(db_key_t));
+	/* the key, the cached columns and the "updated_at" column, if any */
+	nr_cols = c_entry->nr_columns + 1 + (c_entry->updated_at.s ? 1 : 0);
+
+	query_cols = pkg_malloc(nr_cols * sizeof(db_key_t));
 	if (!query_cols) {
 		LM_ERR("No more pkg memory\n");
 		return -1;
@@ -749,17 +859,34 @@ static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
 	query_cols[0] = &(c_entry->key);
 	for (i=0; i < c_entry->nr_columns; i++)
 		query_cols[i+1] = &((*c_entry->columns[i]));
+	if (c_entry->updated_at.s)
+		query_cols[nr_cols - 1] = &c_entry->updated_at;
+
+	if (delta && c_entry->has_last_update) {
+		upd_col = &c_entry->updated_at;
+		VAL_NULL(&upd_val) = 0;
+		VAL_TYPE(&upd_val) = c_entry->last_update_type;
+		if (c_entry->last_update_type == DB_DATETIME)
+			VAL_TIME(&upd_val) = (time_t)c_entry->last_update;
+		else if (c_entry->last_update_type == DB_INT)
+			VAL_INT(&upd_val) = (int)c_entry->last_update;
+		else
+			VAL_BIGINT(&upd_val) = c_entry->last_update;
+		nr_keys = 1;
+	}
 
 	/* query the entire table */
 	if (db_hdls->db_funcs.use_table(db_hdls->db_con, &c_entry->table) < 0) {
 		LM_ERR("Invalid table name: %.*s\n", c_entry->table.len, c_entry->table.s);
 		db_hdls->db_funcs.close(db_hdls->db_con);
 		db_hdls->db_con = 0;
+		pkg_free(query_cols);
 		return -1;
 	}
 	if (DB_CAPABILITY(db_hdls->db_funcs, DB_CAP_FETCH)) {
-		if (db_hdls->db_funcs.query(db_hdls->db_con, NULL, 0, NULL,
-						query_cols, 0, c_entry->nr_columns + 1, 0, 0) != 0) {
+		if (db_hdls->db_funcs.query(db_hdls->db_con, nr_keys ? &upd_col : NULL,
+						nr_keys ? &upd_op : NULL, nr_keys ? &upd_val : NULL,
+						query_cols, nr_keys, nr_cols, 0, 0) != 0) {
 			LM_ERR("Failure to issue query to SQL DB: %.*s\n",
 			c_entry->db_url.len, c_entry->db_url.s);
 			goto error;
@@ -771,8 +898,9 @@ static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
 			goto error;
 		}
 	} else {
-		if (db_hdls->db_funcs.query(db_hdls->db_con, NULL, 0, NULL,
-						query_cols, 0, c_entry->nr_columns + 1, 0, &sql_res) != 0) {
+		if (db_hdls->db_funcs.query(db_hdls->db_con, nr_keys ? &upd_col : NULL,
+						nr_keys ? &upd_op : NULL, nr_keys ? &upd_val : NULL,
+						query_cols, nr_keys, nr_cols, 0, &sql_res) != 0) {
 			LM_ERR("Failure to issue query to SQL DB: %.*s\n",
 			c_entry->db_url.len, c_entry->db_url.s);
 			goto error;
@@ -780,15 +908,17 @@ static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
 	}
 
 	pkg_free(query_cols);
+	query_cols = NULL;
 
 	if (RES_ROW_N(sql_res) == 0) {
-		LM_WARN("Table: %.*s is empty!\n", c_entry->table.len, c_entry->table.s);
+		if (!delta)
+			LM_WARN("Table: %.*s is empty!\n", c_entry->table.len, c_entry->table.s);
 		db_hdls->db_funcs.free_result(db_hdls->db_con, sql_res);
 		return 0;
 	}
 	row = RES_ROWS(sql_res);
 	values = ROW_VALUES(row);
-	if (get_column_types(c_entry, values + 1, ROW_N(row) - 1) < 0)
+	if (get_column_types(c_entry, values + 1, c_entry->nr_columns) < 0)
 		goto error;
 
 	/* load the rows into the cahchedb */
@@ -798,8 +928,11 @@ static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
 			values = ROW_VALUES(row);
 			if (!VAL_NULL(values))
 				if (insert_in_cachedb(c_entry, db_hdls, values ,values + 1,
-									reload_version, ROW_N(row) - 1) < 0)
-					return -1;
+									reload_version, c_entry->nr_columns) < 0)
+					goto error;
+
+			if (c_entry->updated_at.s)
+				update_last_seen(c_entry, values + nr_cols - 1);
 		}
 
 		if (DB_CAPABILITY(db_hdls->db_funcs, DB_CAP_FETCH)) {
@@ -817,11 +950,27 @@ static int load_entire_table(cache_entry_t *c_entry, db_handlers_t *db_hdls,
 	return 0;
 
 error:
+	if (query_cols)
+		pkg_free(query_cols);
 	if (sql_res)
 		db_hdls->db_funcs.free_result(db_hdls->db_con, sql_res);
 	return -1;
 }
 
+/* mark a key which is missing from the sql db, so it is not queried again */
+static int cache_null_key(cache_entry_t *c_entry, db_handlers_t *db_hdls,
+							str *src_key)
+{
+	str null_val = {NULL, 0};
+
+	if (db_hdls->cdbf.set(db_hdls->cdbcon, src_key, &null_val, c_entry->expire) < 0) {
+		LM_ERR("Failed to insert null in cachedb\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 /*  return:
  *  0 - succes
  * -1 - error
@@ -833,7 +982,7 @@ static int load_key(cache_entry_t *c_entry, db_handlers_t *db_hdls, str key,
 	db_key_t key_col;
 	db_row_t *row;
 	db_val_t key_val;
-	str src_key, null_val;
+	str src_key;
 
 	src_key.len = c_entry->id.len + key.len;
 	src_key.s = pkg_malloc(src_key.len);
@@ -866,10 +1015,7 @@ static int load_key(cache_entry_t *c_entry, db_handlers_t *db_hdls, str key,
 
 	if (RES_ROW_N(*sql_res) == 0) {
 		LM_DBG("key %.*s not found in SQL db\n", key.len, key.s);
-		null_val.len = 0;
-		null_val.s = NULL;
-		if (db_hdls->cdbf.set(db_hdls->cdbcon, &src_key, &null_val, c_entry->expire) < 0) {
-			LM_ERR("Failed to insert null in cachedb\n");
+		if (cache_null_key(c_entry, db_hdls, &src_key) < 0) {
 			pkg_free(src_key.s);
 			goto sql_error;
 		}
@@ -934,6 +1080,8 @@ void reload_timer(unsigned int ticks, void *param)
 
 	for (c_entry = *entry_list, db_hdls = db_hdls_list; c_entry;
 		c_entry = c_entry->next, db_hdls = db_hdls->next) {
+		/* the tables with an "updated_at" column are also fully reloaded,
+		 * so that the rows deleted meanwhile expire */
 		if (c_entry->on_demand)
 			continue;
 
@@ -944,7 +1092,7 @@ void reload_timer(unsigned int ticks, void *param)
 			continue;
 		}
 
-		if (load_entire_table(c_entry, db_hdls, rld_vers) < 0)
+		if (load_entire_table(c_entry, db_hdls, rld_vers, 0) < 0)
 			LM_ERR("Failed to reload table %.*s\n", c_entry->table.len,
 				c_entry->table.s);
 
@@ -952,6 +1100,32 @@ void reload_timer(unsigned int ticks, void *param)
 	}
 }
 
+void delta_reload_timer(unsigned int ticks, void *param)
+{
+	cache_entry_t *c_entry;
+	db_handlers_t *db_hdls;
+	int rld_vers;
+
+	for (c_entry = *entry_list, db_hdls = db_hdls_list; c_entry;
+		c_entry = c_entry->next, db_hdls = db_hdls->next) {
+		if (c_entry->on_demand || !c_entry->updated_at.s)
+			continue;
+
+		lock_start_write(c_entry->ref_lock);
+
+		if ((rld_vers = get_rld_vers_from_cache(c_entry, db_hdls)) < 0) {
+			lock_stop_write(c_entry->ref_lock);
+			continue;
+		}
+
+		if (load_entire_table(c_entry, db_hdls, rld_vers, 1) < 0)
+			LM_ERR("Failed to load the changes of table %.*s\n",
+				c_entry->table.len, c_entry->table.s);
+
+		lock_stop_write(c_entry->ref_lock);
+	}
+}
+
 static struct mi_root* mi_reload(struct mi_root *root, void *param)
 {
 	struct mi_node *node;
@@ -1058,18 +1232,34 @@ static struct mi_root* mi_reload(struct mi_root *root, void *param)
 		memcpy(rld_vers_key.s, c_entry->id.s, c_entry->id.len);
 		memcpy(rld_vers_key.s + c_entry->id.len, "_sql_cacher_reload_vers", 23);
 
+		/* only serializes the reloads, the readers are not blocked */
 		lock_start_write(c_entry->ref_lock);
 
-		if (db_hdls->cdbf.add(db_hdls->cdbcon, &rld_vers_key, 1, 0, &rld_vers) < 0) {
-			LM_DBG("Failed to increment reload version integer from cachedb\n");
+		if ((rld_vers = get_rld_vers_from_cache(c_entry, db_hdls)) < 0) {
+			lock_stop_write(c_entry->ref_lock);
+			pkg_free(rld_vers_key.s);
 			return init_mi_tree(500, MI_SSTR("ERROR Reloading SQL database\n"));
 		}
-		pkg_free(rld_vers_key.s);
 
-		if (load_entire_table(c_entry, db_hdls, rld_vers) < 0) {
+		/* load the table under the next version, while the readers still
+		 * see the old rows (a newer version is accepted by the readers too),
+		 * and only switch the version after that, in order to drop the
+		 * rows deleted meanwhile from the table */
+		c_entry->has_last_update = 0;
+		if (load_entire_table(c_entry, db_hdls, rld_vers + 1, 0) < 0) {
 			LM_DBG("Failed to reload table\n");
+			lock_stop_write(c_entry->ref_lock);
+			pkg_free(rld_vers_key.s);
+			return init_mi_tree(500, MI_SSTR("ERROR Reloading SQL database\n"));
+		}
+
+		if (db_hdls->cdbf.add(db_hdls->cdbcon, &rld_vers_key, 1, 0, &rld_vers) < 0) {
+			LM_DBG("Failed to increment reload version integer from cachedb\n");
+			lock_stop_write(c_entry->ref_lock);
+			pkg_free(rld_vers_key.s);
 			return init_mi_tree(500, MI_SSTR("ERROR Reloading SQL database\n"));
 		}
+		pkg_free(rld_vers_key.s);
 
 		lock_stop_write(c_entry->ref_lock);
 	}
@@ -1117,12 +1307,16 @@ static void cache_init_load(int sender, void *param)
 			return;
 		}
 
+		if (c_entry->on_demand)
+			continue;
+
 		/* cache the entire table in full caching mode */
-		if (!c_entry->on_demand && load_entire_table(c_entry, db_hdls, 0) < 0) {
+		lock_start_write(c_entry->ref_lock);
+		if (load_entire_table(c_entry, db_hdls, 0, 0) < 0)
 			LM_ERR("Failed to cache the entire table: %s\n", c_entry->table.s);
-			continue;
-		} else
+		else
 			LM_DBG("Cached table: %.*s\n", c_entry->table.len, c_entry->table.s);
+		lock_stop_write(c_entry->ref_lock);
 
 	}
 }
@@ -1131,7 +1325,7 @@ static int mod_init(void)
 {
 	cache_entry_t *c_entry;
 	db_handlers_t *db_hdls;
-	char use_timer = 0;
+	char use_timer = 0, use_delta_timer = 0;
 
 	if (full_caching_expire <= 0) {
 		full_caching_expire = DEFAULT_FULL_CACHING_EXPIRE;
@@ -1143,6 +1337,11 @@ static int mod_init(void)
 		LM_WARN("Invalid reload_interval parameter, "
 			"setting default value: %d sec\n", DEFAULT_RELOAD_INTERVAL);
 	}
+	if (delta_reload_interval <= 0) {
+		delta_reload_interval = DEFAULT_DELTA_RELOAD_INTERVAL;
+		LM_WARN("Invalid delta_reload_interval parameter, "
+			"setting default value: %d sec\n", DEFAULT_DELTA_RELOAD_INTERVAL);
+	}
 	if(!entry_list){
 		entry_list =  shm_malloc(sizeof(cache_entry_t*));
 		if (!entry_list) {
@@ -1172,7 +1371,13 @@ static int mod_init(void)
 		if ((db_hdls = db_init_test_conn(c_entry)) == NULL)
 			continue;
 
+		if (c_entry->on_demand && c_entry->updated_at.s)
+			LM_WARN("'%s' is ignored for the on demand entry: %.*s\n",
+				UPDATED_AT_STR, c_entry->id.len, c_entry->id.s);
+
 		if (!c_entry->on_demand) {
+			if (c_entry->updated_at.s)
+				use_delta_timer = 1;
 			use_timer = 1;
 			c_entry->expire = full_caching_expire;
 			c_entry->ref_lock = lock_init_rw();
@@ -1193,6 +1398,12 @@ static int mod_init(void)
 		LM_ERR("failed to register timer\n");
 		return -1;
 	}
+	if (use_delta_timer && register_timer("sql_cacher_delta-timer",
+		delta_reload_timer, NULL, delta_reload_interval,
+		TIMER_FLAG_DELAY_ON_DELAY) < 0) {
+		LM_ERR("failed to register timer\n");
+		return -1;
+	}
 
 	return 0;
 }
@@ -1255,6 +1466,19 @@ out_free:
 	return rc;
 }
 
+/* decode the reload version the value was cached with */
+static int cdb_val_version(str *cdb_val, int *version)
+{
+	char int_buf[4];
+
+	if (cdb_val->len < INT_B64_ENC_LEN || base64decode((unsigned char *)int_buf,
+		(unsigned char *)(cdb_val->s), INT_B64_ENC_LEN) != 4)
+		return -1;
+	memcpy(version, int_buf, 4);
+
+	return 0;
+}
+
 /*  return:
  *  0 - succes
  *  1 - succes, null value in db
@@ -1273,13 +1497,11 @@ static int cdb_val_decode(pv_name_fix_t *pv_name, str *cdb_val, int reload_versi
 		return 2;
 	}
 
-	/* decode the reload version */
-	if (base64decode((unsigned char *)int_buf,
-		(unsigned char *)(cdb_val->s), INT_B64_ENC_LEN) != 4)
+	if (cdb_val_version(cdb_val, &int_val) < 0)
 		goto error;
-	memcpy(&int_val, int_buf, 4);
 
-	if (reload_version != int_val)
+	/* a newer version belongs to a full reload which is still in progress */
+	if (int_val < reload_version)
 		return 3;
 
 	/* null integer value in db */
@@ -1695,21 +1917,17 @@ int pv_get_sql_cached_value(struct sip_msg *msg,  pv_param_t *param, pv_value_t
 		}
 	}
 
-	if (!pv_name->c_entry->on_demand)
-		lock_start_read(pv_name->c_entry->ref_lock);
-
+	/* no locking needed for reading, the full reloads write the rows under
+	 * a newer version and only switch to it once all the rows are loaded */
 	rc = cdb_fetch(pv_name, &cdb_res, &entry_rld_vers);
 	if (rc == -1) {
 		LM_ERR("Error fetching from cachedb\n");
-		if (!pv_name->c_entry->on_demand)
-			lock_stop_read(pv_name->c_entry->ref_lock);
 		return pv_get_null(msg, param, res);
 	}
 
 	if (!pv_name->c_entry->on_demand) {
 		if (rc == -2) {
 			LM_DBG("key: %.*s not found\n", pv_name->key.len, pv_name->key.s);
-			lock_stop_read(pv_name->c_entry->ref_lock);
 			return pv_get_null(msg, param, res);
 		} else {
 			if (cdb_res.len == 0 || !cdb_res.s) {
@@ -1722,8 +1940,6 @@ int pv_get_sql_cached_value(struct sip_msg *msg,  pv_param_t *param, pv_value_t
 			rc2 = cdb_val_decode(pv_name, &cdb_res, entry_rld_vers, &str_res,
 									&int_res);
 
-			lock_stop_read(pv_name->c_entry->ref_lock);
-
 			if (rc2 == 2)
 				goto out_free_null;
 			if (rc2 == 3) {
@@ -1801,6 +2017,253 @@ out_free_null:
 	return pv_get_null(msg, param, res);
 }
 
+struct sql_load_param {
+	cache_entry_t *c_entry;
+	db_handlers_t *db_hdls;
+	str key;
+	int rld_vers;
+	void *db_priv;
+};
+
+static int fixup_sql_cacher_load(void **param, int param_no)
+{
+	return fixup_spve_spve(param, param_no);
+}
+
+/* the key is put in the raw query as is, so only allow the chars which
+ * can not change its meaning */
+static int key_is_safe(str *key)
+{
+	int i;
+
+	for (i = 0; i < key->len; i++)
+		if (!key->s[i] || (!isalnum((unsigned char)key->s[i]) &&
+			!strchr("+-_.@:", key->s[i])))
+			return 0;
+
+	return 1;
+}
+
+static str *build_load_query(cache_entry_t *c_entry, str *key)
+{
+	static str query;
+	int i, len;
+	char *p;
+
+	len = sizeof("SELECT  FROM  WHERE =''") - 1 + c_entry->table.len +
+		c_entry->key.len + key->len;
+	for (i = 0; i < c_entry->nr_columns; i++)
+		len += (*c_entry->columns[i]).len + 1;
+
+	if (pkg_str_extend(&query, len) != 0) {
+		LM_ERR("No more pkg memory\n");
+		return NULL;
+	}
+
+	p = query.s;
+	memcpy(p, "SELECT ", 7);
+	p += 7;
+	for (i = 0; i < c_entry->nr_columns; i++) {
+		if (i)
+			*p++ = ',';
+		memcpy(p, (*c_entry->columns[i]).s, (*c_entry->columns[i]).len);
+		p += (*c_entry->columns[i]).len;
+	}
+	memcpy(p, " FROM ", 6);
+	p += 6;
+	memcpy(p, c_entry->table.s, c_entry->table.len);
+	p += c_entry->table.len;
+	memcpy(p, " WHERE ", 7);
+	p += 7;
+	memcpy(p, c_entry->key.s, c_entry->key.len);
+	p += c_entry->key.len;
+	*p++ = '=';
+	*p++ = '\'';
+	memcpy(p, key->s, key->len);
+	p += key->len;
+	*p++ = '\'';
+
+	query.len = p - query.s;
+	return &query;
+}
+
+static int resume_sql_cacher_load(int fd, struct sip_msg *msg, void *_param)
+{
+	struct sql_load_param *param = (struct sql_load_param *)_param;
+	db_handlers_t *db_hdls = param->db_hdls;
+	cache_entry_t *c_entry = param->c_entry;
+	db_res_t *res = NULL;
+	db_val_t key_val;
+	str src_key;
+	int rc, ret = -1;
+
+	rc = db_hdls->db_funcs.async_resume(db_hdls->db_con, fd, &res,
+		param->db_priv);
+	if (async_status == ASYNC_CONTINUE || async_status == ASYNC_CHANGE_FD)
+		return rc;
+
+	async_status = ASYNC_DONE;
+
+	if (rc != 0) {
+		LM_ERR("async query for key: %.*s returned error\n",
+			param->key.len, param->key.s);
+		goto out;
+	}
+
+	if (!res || RES_ROW_N(res) == 0) {
+		LM_DBG("key %.*s not found in SQL db\n", param->key.len, param->key.s);
+
+		src_key.len = c_entry->id.len + param->key.len;
+		src_key.s = pkg_malloc(src_key.len);
+		if (!src_key.s) {
+			LM_ERR("No more pkg memory\n");
+			goto out;
+		}
+		memcpy(src_key.s, c_entry->id.s, c_entry->id.len);
+		memcpy(src_key.s + c_entry->id.len, param->key.s, param->key.len);
+
+		if (cache_null_key(c_entry, db_hdls, &src_key) == 0)
+			ret = -2;
+		pkg_free(src_key.s);
+		goto out;
+	} else if (RES_ROW_N(res) > 1) {
+		LM_ERR("To many rows returned for key: %.*s\n",
+			param->key.len, param->key.s);
+		goto out;
+	}
+
+	if (c_entry->nr_ints + c_entry->nr_strs == 0 &&
+		get_column_types(c_entry, ROW_VALUES(RES_ROWS(res)),
+		c_entry->nr_columns) < 0)
+		goto out;
+
+	VAL_NULL(&key_val) = 0;
+	VAL_TYPE(&key_val) = DB_STR;
+	VAL_STR(&key_val) = param->key;
+
+	if (insert_in_cachedb(c_entry, db_hdls, &key_val, ROW_VALUES(RES_ROWS(res)),
+		param->rld_vers, c_entry->nr_columns) == 0)
+		ret = 1;
+
+out:
+	if (res)
+		db_hdls->db_funcs.async_free_result(db_hdls->db_con, res,
+			param->db_priv);
+	pkg_free(param);
+	return ret;
+}
+
+/* load a key of an on demand entry in the cache, without blocking the
+ * worker on the sql query, so the next $sql_cached_value() reads for this
+ * key are served straight from the cache */
+static int w_sql_cacher_load(struct sip_msg *msg, async_ctx *ctx,
+								char *id_p, char *key_p)
+{
+	struct sql_load_param *param;
+	cache_entry_t *c_entry;
+	db_handlers_t *db_hdls;
+	db_res_t *sql_res = NULL;
+	db_val_t *values;
+	str id, key, src_key, cdb_res, *query;
+	int rld_vers, version, rc, read_fd;
+
+	ctx->resume_f = NULL;
+	ctx->resume_param = NULL;
+	async_status = ASYNC_NO_IO;
+
+	if (fixup_get_svalue(msg, (gparam_p)id_p, &id) != 0 ||
+		fixup_get_svalue(msg, (gparam_p)key_p, &key) != 0) {
+		LM_ERR("Failed to get the caching id or the key\n");
+		return -1;
+	}
+
+	for (c_entry = *entry_list, db_hdls = db_hdls_list; c_entry;
+		c_entry = c_entry->next, db_hdls = db_hdls->next)
+		if (!str_strcmp(&c_entry->id, &id))
+			break;
+	if (!c_entry) {
+		LM_WARN("Unknown caching id %.*s\n", id.len, id.s);
+		return -1;
+	}
+
+	/* the entire table is already cached */
+	if (!c_entry->on_demand)
+		return 1;
+
+	if ((rld_vers = get_rld_vers_from_cache(c_entry, db_hdls)) < 0)
+		return -1;
+
+	src_key.len = c_entry->id.len + key.len;
+	src_key.s = pkg_malloc(src_key.len);
+	if (!src_key.s) {
+		LM_ERR("No more pkg memory\n");
+		return -1;
+	}
+	memcpy(src_key.s, c_entry->id.s, c_entry->id.len);
+	memcpy(src_key.s + c_entry->id.len, key.s, key.len);
+
+	rc = db_hdls->cdbf.get(db_hdls->cdbcon, &src_key, &cdb_res);
+	pkg_free(src_key.s);
+	if (rc == -1) {
+		LM_ERR("Error fetching from cachedb\n");
+		return -1;
+	}
+	if (rc != -2) {
+		if (cdb_res.len == 0 || !cdb_res.s) {
+			if (cdb_res.s)
+				pkg_free(cdb_res.s);
+			/* already known to be missing from the sql db */
+			return -2;
+		}
+
+		rc = cdb_val_version(&cdb_res, &version);
+		pkg_free(cdb_res.s);
+		if (rc == 0 && version >= rld_vers)
+			return 1;
+	}
+
+	if (!DB_CAPABILITY(db_hdls->db_funcs, DB_CAP_ASYNC_RAW_QUERY) ||
+		!key_is_safe(&key)) {
+		/* run the query in blocking mode */
+		rc = load_key(c_entry, db_hdls, key, &values, &sql_res, rld_vers);
+		if (rc == 0)
+			db_hdls->db_funcs.free_result(db_hdls->db_con, sql_res);
+
+		return rc == 0 ? 1 : rc;
+	}
+
+	if ((query = build_load_query(c_entry, &key)) == NULL)
+		return -1;
+
+	param = pkg_malloc(sizeof *param + key.len);
+	if (!param) {
+		LM_ERR("No more pkg memory\n");
+		return -1;
+	}
+	memset(param, 0, sizeof *param);
+
+	read_fd = db_hdls->db_funcs.async_raw_query(db_hdls->db_con, query,
+		&param->db_priv);
+	if (read_fd < 0) {
+		LM_ERR("Failed to start the query for key: %.*s\n", key.len, key.s);
+		pkg_free(param);
+		return -1;
+	}
+
+	param->c_entry = c_entry;
+	param->db_hdls = db_hdls;
+	param->rld_vers = rld_vers;
+	param->key.s = (char *)(param + 1);
+	param->key.len = key.len;
+	memcpy(param->key.s, key.s, key.len);
+
+	ctx->resume_param = param;
+	ctx->resume_f = resume_sql_cacher_load;
+
+	async_status = read_fd;
+	return 1;
+}
+
 static void destroy(void)
 {
 	db_handlers_t *db_hdls;
@@ -1840,6 +2303,8 @@ static void destroy(void)
 			shm_free(c_tmp->columns[i]);
 		}
 		shm_free(c_tmp->columns);
+		if (c_tmp->updated_at.s)
+			shm_free(c_tmp->updated_at.s);
 		lock_destroy_rw(c_tmp->ref_lock);
 		shm_free(c_tmp);
 	}
@@ -47,12 +47,15 @@
 #define COLUMNS_STR_LEN ((int)(sizeof(COLUMNS_STR) - 1))
 #define ONDEMAND_STR "on_demand"
 #define ONDEMAND_STR_LEN ((int)(sizeof(ONDEMAND_STR) - 1))
+#define UPDATED_AT_STR "updated_at"
+#define UPDATED_AT_STR_LEN ((int)(sizeof(UPDATED_AT_STR) - 1))
 #define EXPIRE_STR "expire"
 #define EXPIRE_STR_LEN ((int)(sizeof(EXPIRE_STR) - 1))
 
 #define DEFAULT_ON_DEMAND_EXPIRE 3600
 #define DEFAULT_FULL_CACHING_EXPIRE 86400 /* 24h */
 #define DEFAULT_RELOAD_INTERVAL 60
+#define DEFAULT_DELTA_RELOAD_INTERVAL 5
 #define DEFAULT_FETCH_NR_ROWS 100
 #define TEST_QUERY_STR "sql_cacher_test_query_key"
 #define CDB_TEST_KEY_STR "sql_cacher_cdb_test_key"
@@ -68,9 +71,14 @@ typedef struct _cache_entry {
 	str **columns;
 	unsigned int nr_columns;
 	unsigned int on_demand;
+	str updated_at;			/* column stamped on each change, for delta reloads */
 	unsigned int expire;
 	unsigned int nr_ints, nr_strs;
 	long long column_types;
+	/* the newest value seen in the "updated_at" column */
+	long long last_update;
+	db_type_t last_update_type;
+	char has_last_update;
 	rw_lock_t *ref_lock;
 	struct _cache_entry *next;
 } cache_entry_t;
@@ -1050,6 +1050,15 @@ unsigned long get_number_of_users(void* foo)
  * Run timer handler of all domains
  */
 int synchronize_all_udomains(void)
+{
+	return synchronize_udomains(0, 1);
+}
+
+
+/*! \brief
+ * Run timer handler of all domains, only over a part of their slots
+ */
+int synchronize_udomains(int part, int parts)
 {
 	int res = 0;
 	dlist_t* ptr;
@@ -1057,11 +1066,12 @@ int synchronize_all_udomains(void)
 	get_act_time(); /* Get and save actual time */
 
 	if (cluster_mode == CM_SQL_ONLY) {
-		for( ptr=root ; ptr ; ptr=ptr->next)
-			res |= db_timer_udomain(ptr->d);
+		if (part == 0)
+			for( ptr=root ; ptr ; ptr=ptr->next)
+				res |= db_timer_udomain(ptr->d);
 	} else if (have_mem_storage()) {
 		for( ptr=root ; ptr ; ptr=ptr->next)
-			res |= mem_timer_udomain(ptr->d);
+			res |= mem_timer_udomain(ptr->d, part, parts);
 	} /* TODO: add a form of cleanup here, or implement cache API TTLs */
 
 	return res;
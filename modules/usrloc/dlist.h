@@ -74,6 +74,11 @@ void free_all_udomains(void);
  */
 int synchronize_all_udomains(void);
 
+/*! \brief
+ * Same as above, for the given part (out of "parts") of the hash slots
+ */
+int synchronize_udomains(int part, int parts);
+
 
 /*! \brief
  * Get contacts to all registered users
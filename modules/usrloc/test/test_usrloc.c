@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "../../../str.h"
+#include "../../../pt.h"
+#include "../../../hash_func.h"
+#include "../../../statistics.h"
+#include "../../../mem/shm_mem.h"
+#include "../../../db/db.h"
+
+#include "../ul_mod.h"
+#include "../dlist.h"
+#include "../udomain.h"
+#include "../hslot.h"
+
+#define TEST_AORS		50000
+#define TEST_CONTACTS	(2 * TEST_AORS)		/* two contacts per AOR */
+#define TEST_HASH_SIZE	512
+
+extern int ul_locks_no;
+
+/* the location table, as the fake DB backend serves it */
+static char user_buf[TEST_AORS][16];
+static char contact_buf[TEST_CONTACTS][32];
+static uint64_t contact_ids[TEST_CONTACTS];
+
+/* the rows of the current query, and how far they were fetched */
+static uint64_t query_from, query_to;
+static int query_row;
+
+/* how many times each row was fetched, over all the processes */
+static unsigned char *served;
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void gen_table(void)
+{
+	str aor;
+	int i;
+
+	for (i = 0; i < TEST_AORS; i++) {
+		aor.s = user_buf[i];
+		aor.len = sprintf(user_buf[i], "u%d", i);
+
+		contact_ids[2 * i] = pack_indexes(
+			(unsigned short)core_hash(&aor, 0, 0), i + 1, 1);
+		contact_ids[2 * i + 1] = contact_ids[2 * i] + 1;
+
+		sprintf(contact_buf[2 * i], "sip:u%d@10.0.0.1:5060", i);
+		sprintf(contact_buf[2 * i + 1], "sip:u%d@10.0.0.2:5060", i);
+	}
+}
+
+static int fake_use_table(db_con_t *_h, const str *_t)
+{
+	return 0;
+}
+
+/* only the contact_id range filter of preload_udomain() is supported */
+static int fake_query(const db_con_t *_h, const db_key_t *_k,
+		const db_op_t *_op, const db_val_t *_v, const db_key_t *_c,
+		const int _n, const int _nc, const db_key_t _o, db_res_t **_r)
+{
+	query_from = _n > 0 ? (uint64_t)VAL_BIGINT(_v) : 0;
+	query_to = _n > 1 ? (uint64_t)VAL_BIGINT(_v + 1) : (uint64_t)-1;
+	query_row = 0;
+
+	return 0;
+}
+
+static void fill_row(db_val_t *vals, int i)
+{
+	int j;
+
+	memset(vals, 0, UL_COLS * sizeof *vals);
+	for (j = 0; j < UL_COLS; j++)
+		VAL_NULL(vals + j) = 1;
+
+	VAL_NULL(vals) = 0;
+	VAL_STRING(vals) = user_buf[i / 2];
+	VAL_NULL(vals + 1) = 0;
+	VAL_BIGINT(vals + 1) = (long long)contact_ids[i];
+	VAL_NULL(vals + 2) = 0;
+	VAL_STRING(vals + 2) = contact_buf[i];
+	VAL_NULL(vals + 3) = 0;
+	VAL_INT(vals + 3) = time(NULL) + 3600;
+	VAL_NULL(vals + 4) = 0;
+	VAL_DOUBLE(vals + 4) = 1;
+	VAL_NULL(vals + 5) = 0;
+	VAL_STRING(vals + 5) = contact_buf[i];
+	VAL_NULL(vals + 6) = 0;
+	VAL_INT(vals + 6) = 1;
+	VAL_NULL(vals + 7) = 0;
+	VAL_BITMAP(vals + 7) = 0;
+	VAL_NULL(vals + 9) = 0;
+	VAL_STRING(vals + 9) = "OpenSIPS (test)";
+}
+
+static int fake_fetch_result(const db_con_t *_h, db_res_t **_r, const int _n)
+{
+	db_res_t *res = *_r;
+	int i;
+
+	if (!res) {
+		res = malloc(sizeof *res + _n * (sizeof(db_row_t) +
+			UL_COLS * sizeof(db_val_t)));
+		if (!res)
+			return -1;
+		memset(res, 0, sizeof *res);
+		RES_ROWS(res) = (db_row_t *)(res + 1);
+		for (i = 0; i < _n; i++)
+			ROW_VALUES(RES_ROWS(res) + i) =
+				(db_val_t *)(RES_ROWS(res) + _n) + i * UL_COLS;
+		*_r = res;
+	}
+
+	for (RES_ROW_N(res) = 0; RES_ROW_N(res) < _n && query_row < TEST_CONTACTS;
+	        query_row++) {
+		if (contact_ids[query_row] < query_from ||
+		        contact_ids[query_row] >= query_to)
+			continue;
+
+		fill_row(ROW_VALUES(RES_ROWS(res) + RES_ROW_N(res)), query_row);
+		__sync_fetch_and_add(&served[query_row], 1);
+		RES_ROW_N(res)++;
+	}
+
+	return 0;
+}
+
+static int fake_free_result(db_con_t *_h, db_res_t *_r)
+{
+	free(_r);
+	return 0;
+}
+
+/* every row loaded once, and every AOR found with both its contacts */
+static int check_udomain(udomain_t *d)
+{
+	urecord_t *r;
+	ucontact_t *c;
+	str aor;
+	int i, n;
+
+	for (i = 0; i < TEST_CONTACTS; i++)
+		if (served[i] != 1)
+			return -1;
+
+	for (i = 0; i < TEST_AORS; i++) {
+		aor.s = user_buf[i];
+		aor.len = strlen(user_buf[i]);
+		if (get_urecord(d, &aor, &r) != 0)
+			return -1;
+
+		for (c = r->contacts, n = 0; c; c = c->next, n++)
+			if (c->contact_id != contact_ids[2 * i] &&
+			        c->contact_id != contact_ids[2 * i + 1])
+				return -1;
+		if (n != 2)
+			return -1;
+	}
+
+	return 0;
+}
+
+/* loads the table in @parts parts, by as many processes when @forked */
+static void test_preload(str *name, int parts, int forked)
+{
+	unsigned long long start, load_ns;
+	udomain_t *d;
+	pid_t pid;
+	int i, status, failed = 0;
+
+	if (!ok(new_udomain(name, TEST_HASH_SIZE, &d) == 0,
+	        "usrloc: create domain %.*s", name->len, name->s))
+		return;
+
+	memset(served, 0, TEST_CONTACTS);
+	start = now_ns();
+
+	for (i = 0; i < parts; i++) {
+		if (!forked) {
+			if (preload_udomain(NULL, d, i, parts) < 0)
+				failed = 1;
+			continue;
+		}
+
+		pid = fork();
+		if (pid < 0) {
+			failed = 1;
+			break;
+		}
+		if (pid == 0) {
+			process_no = i + 1;
+			_exit(preload_udomain(NULL, d, i, parts) < 0);
+		}
+	}
+
+	if (forked)
+		while (wait(&status) > 0)
+			if (!WIFEXITED(status) || WEXITSTATUS(status))
+				failed = 1;
+
+	load_ns = now_ns() - start;
+	preload_udomain_labels(d);
+
+	ok(!failed && check_udomain(d) == 0, "usrloc: %d contacts loaded in "
+		"%d part(s) by %d process(es) - %llu contacts/s", TEST_CONTACTS,
+		parts, forked ? parts : 1,
+		TEST_CONTACTS * 1000000000ULL / (load_ns ? load_ns : 1));
+
+	free_udomain(d);
+}
+
+void mod_tests(void)
+{
+	static str name_1 = str_init("preload_1");
+	static str name_4 = str_init("preload_4");
+	static str name_4p = str_init("preload_4p");
+	db_func_t dbf = ul_dbf;
+
+	gen_table();
+
+	served = shm_malloc(TEST_CONTACTS);
+	if (!ok(served != NULL, "usrloc: alloc the row counters"))
+		return;
+
+	ul_locks_no = TEST_HASH_SIZE;
+	if (!ok(ul_init_locks() == 0, "usrloc: init the slot locks"))
+		goto out;
+
+	if (!ok(ul_event_init() == 0, "usrloc: publish the events"))
+		goto out_locks;
+
+	if (!ok(register_stat("usrloc", "preloaded_contacts",
+	        &preloaded_contacts, STAT_NO_RESET) == 0,
+	        "usrloc: register the preload statistic"))
+		goto out_locks;
+
+	memset(&ul_dbf, 0, sizeof ul_dbf);
+	ul_dbf.cap = DB_CAP_FETCH;
+	ul_dbf.use_table = fake_use_table;
+	ul_dbf.query = fake_query;
+	ul_dbf.fetch_result = fake_fetch_result;
+	ul_dbf.free_result = fake_free_result;
+
+	test_preload(&name_1, 1, 0);
+	test_preload(&name_4, 4, 0);
+	test_preload(&name_4p, 4, 1);
+
+	ok(get_stat_val(preloaded_contacts) == 3 * TEST_CONTACTS,
+		"usrloc: preloaded_contacts counts all the loaded contacts");
+
+	ul_dbf = dbf;
+out_locks:
+	ul_destroy_locks();
+out:
+	shm_free(served);
+}
@@ -447,6 +447,7 @@ int db_insert_ucontact(ucontact_t* _c,query_list_t **ins_list, int update)
 
 	static db_ps_t myI_ps = NULL;
 	static db_ps_t myR_ps = NULL;
+	static db_ps_t myB_ps = NULL;
 	char* dom;
 	db_key_t keys[UL_COLS];
 	db_val_t vals[UL_COLS];
@@ -612,6 +613,27 @@ int db_insert_ucontact(ucontact_t* _c,query_list_t **ins_list, int update)
 			LM_ERR("inserting contact in db failed\n");
 			goto out_err;
 		}
+	} else if (ins_list) {
+		/* batched insert-update - queued along with the other
+		 * upserts of the table, unless the DB cannot do it */
+		CON_PS_REFERENCE(ul_dbh) = &myB_ps;
+		if (con_set_upsert_list(&ul_dbf,ul_dbh,ins_list,keys + start,
+					nr_vals) < 0)
+			CON_RESET_INSLIST(ul_dbh);
+
+		if (CON_HAS_INSLIST(ul_dbh)) {
+			if (ul_dbf.insert(ul_dbh, keys + start, vals + start, nr_vals) < 0) {
+				LM_ERR("queueing contact for db upsert failed\n");
+				goto out_err;
+			}
+		} else {
+			CON_PS_REFERENCE(ul_dbh) = &myR_ps;
+			if (ul_dbf.insert_update(ul_dbh, keys + start, vals + start,
+			nr_vals) < 0) {
+				LM_ERR("inserting contact in db failed\n");
+				goto out_err;
+			}
+		}
 	} else {
 		/* do insert-update / replace */
 		CON_PS_REFERENCE(ul_dbh) = &myR_ps;
@@ -235,7 +235,9 @@ int st_flush_ucontact(ucontact_t* _c);
 
 
 /*! \brief
- * Insert contact into the database
+ * Insert contact into the database (updating it on duplicate key, if
+ * "update" is set); a non-NULL ins_list queues the row for a multi-row
+ * statement, flushed with ql_flush_rows()
  */
 int db_insert_ucontact(ucontact_t* _c,query_list_t **ins_list, int update);
 
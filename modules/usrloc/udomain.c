@@ -33,6 +33,7 @@
  */
 
 #include <string.h>
+#include <ctype.h>
 #include <inttypes.h>
 #include "udomain.h"
 #include "dlist.h"
@@ -44,6 +45,7 @@
 #include "../../ut.h"
 #include "../../hash_func.h"
 #include "../../cachedb/cachedb.h"
+#include "../../async.h"
 
 #include "ul_mod.h"            /* usrloc module parameters */
 #include "utime.h"
@@ -721,7 +723,13 @@ static inline ucontact_info_t* dbrow2info(db_val_t *vals, str *contact)
 }
 
 
-int preload_udomain(db_con_t* _c, udomain_t* _d)
+/*! \brief
+ * Load the contacts of the @part-th out of @parts ranges of AOR hashes.
+ * As the AOR hash makes up the top bits of the contact id, each range
+ * maps onto a contact_id interval, so several processes may load
+ * distinct parts of the same table at the same time.
+ */
+int preload_udomain(db_con_t* _c, udomain_t* _d, int part, int parts)
 {
 	/* no use to try prepared statements here as this query is performed
 	   once at startup -bogdan */
@@ -730,6 +738,10 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 	ucontact_info_t *ci;
 	db_row_t *row;
 	db_key_t columns[UL_COLS];
+	db_key_t keys[2];
+	db_op_t ops[2];
+	db_val_t vals[2];
+	int keys_no = 0;
 	db_res_t* res = NULL;
 	str user, contact;
 	char* domain;
@@ -737,6 +749,7 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 	int n;
 	int ret;
 	int no_rows = 10;
+	int loaded;
 	unsigned short aorhash, clabel;
 	unsigned int   rlabel;
 	UNUSED(n);
@@ -768,6 +781,23 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 	columns[17] = &attr_col;
 	columns[UL_COLS - 1] = &domain_col; /* "domain" always stays last */
 
+	if (parts > 1) {
+		keys[0] = keys[1] = &contactid_col;
+		ops[0] = OP_GEQ;
+		ops[1] = OP_LT;
+		memset(vals, 0, sizeof vals);
+		VAL_TYPE(vals) = VAL_TYPE(vals+1) = DB_BIGINT;
+
+		VAL_BIGINT(vals) = (long long)pack_indexes(
+			(unsigned short)((part * 0x10000) / parts), 0, 0);
+		keys_no = 1;
+		if (part < parts - 1) {
+			VAL_BIGINT(vals+1) = (long long)pack_indexes(
+				(unsigned short)(((part + 1) * 0x10000) / parts), 0, 0);
+			keys_no = 2;
+		}
+	}
+
 	if (ul_dbf.use_table(_c, _d->name) < 0) {
 		LM_ERR("sql use_table failed\n");
 		return -1;
@@ -778,7 +808,8 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 #endif
 
 	if (DB_CAPABILITY(ul_dbf, DB_CAP_FETCH)) {
-		if (ul_dbf.query(_c, 0, 0, 0, columns, 0,
+		if (ul_dbf.query(_c, keys_no ? keys : 0, keys_no ? ops : 0,
+		                 keys_no ? vals : 0, columns, keys_no,
 		                 use_domain ? UL_COLS : UL_COLS - 1, 0, 0) < 0) {
 			LM_ERR("db_query (1) failed\n");
 			return -1;
@@ -791,7 +822,8 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 			return -1;
 		}
 	} else {
-		if (ul_dbf.query(_c, 0, 0, 0, columns, 0,
+		if (ul_dbf.query(_c, keys_no ? keys : 0, keys_no ? ops : 0,
+		                 keys_no ? vals : 0, columns, keys_no,
 		                 use_domain ? UL_COLS : UL_COLS - 1, 0, &res) < 0) {
 			LM_ERR("db_query failed\n");
 			return -1;
@@ -808,6 +840,7 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 	n = 0;
 	do {
 		LM_DBG("loading records - cycle [%d]\n", ++n);
+		loaded = 0;
 		for(i = 0; i < RES_ROW_N(res); i++) {
 			row = RES_ROWS(res) + i;
 
@@ -984,8 +1017,11 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 			}
 
 			unlock_udomain(_d, &user);
+			loaded++;
 		}
 
+		update_stat(preloaded_contacts, loaded);
+
 		if (DB_CAPABILITY(ul_dbf, DB_CAP_FETCH)) {
 			if(ul_dbf.fetch_result(_c, &res, no_rows)<0) {
 				LM_ERR("fetching rows (1) failed\n");
@@ -1009,13 +1045,6 @@ int preload_udomain(db_con_t* _c, udomain_t* _d)
 				" enable 'regen_broken_contactid' module parameter.\n");
 	}
 
-	/* for each not populated slot with record label
-	 * populate it*/
-	for (sl=0; sl < _d->size; sl++) {
-		if (_d->table[sl].next_label == 0)
-			_d->table[sl].next_label = rand();
-	}
-
 #ifdef EXTRA_DEBUG
 	LM_NOTICE("load end time [%d]\n", (int)time(NULL));
 #endif
@@ -1027,24 +1056,85 @@ error:
 }
 
 
+/*! \brief
+ * Seed the record labels of the slots left empty by the preload; to be
+ * run once all the parts of the domain are loaded
+ */
+void preload_udomain_labels(udomain_t* _d)
+{
+	int sl;
+
+	/* for each not populated slot with record label
+	 * populate it*/
+	for (sl=0; sl < _d->size; sl++) {
+		lock_ulslot(_d, sl);
+		if (_d->table[sl].next_label == 0)
+			_d->table[sl].next_label = rand();
+		unlock_ulslot(_d, sl);
+	}
+}
+
+
+/*! \brief
+ * builds the (static) urecord of an AOR out of its DB contacts
+ */
+static urecord_t* db_res2urecord(udomain_t* _d, str *_aor, db_res_t* res)
+{
+	ucontact_info_t *ci;
+	str contact;
+	int i;
+
+	urecord_t* r;
+	ucontact_t* c;
+
+	if (RES_ROW_N(res) == 0) {
+		LM_DBG("aor %.*s not found in table %.*s\n",_aor->len, _aor->s,
+			_d->name->len, _d->name->s);
+		return 0;
+	}
+
+	r = 0;
+
+	for(i = 0; i < RES_ROW_N(res); i++) {
+		ci = dbrow2info(  ROW_VALUES(RES_ROWS(res) + i), &contact);
+		if (ci==0) {
+			LM_ERR("skipping record for %.*s in table %s\n",
+					_aor->len, _aor->s, _d->name->s);
+			continue;
+		}
+
+		if ( r==0 )
+			get_static_urecord( _d, _aor, &r);
+
+		if ( (c=mem_insert_ucontact(r, &contact, ci)) == 0) {
+			LM_ERR("mem_insert failed\n");
+			free_urecord(r);
+			return 0;
+		}
+
+		/* We have to do this, because insert_ucontact sets state to CS_NEW
+		 * and we have the contact in the database already */
+		c->state = CS_SYNC;
+	}
+
+	return r;
+}
+
+
 /*! \brief
  * loads from DB all contacts for an AOR
  */
 urecord_t* db_load_urecord(db_con_t* _c, udomain_t* _d, str *_aor)
 {
 	/*static db_ps_t my_ps = NULL;*/
-	ucontact_info_t *ci;
 	db_key_t columns[UL_COLS - 2];
 	db_key_t keys[2];
 	db_val_t vals[2];
 	db_key_t order = &q_col;
 	db_res_t* res = NULL;
-	str contact;
 	char *domain;
-	int i;
 
 	urecord_t* r;
-	ucontact_t* c;
 
 	keys[0] = &user_col;
 	keys[1] = &domain_col;
@@ -1102,40 +1192,162 @@ urecord_t* db_load_urecord(db_con_t* _c, udomain_t* _d, str *_aor)
 		return 0;
 	}
 
-	if (RES_ROW_N(res) == 0) {
-		LM_DBG("aor %.*s not found in table %.*s\n",_aor->len, _aor->s,
-			_d->name->len, _d->name->s);
-		ul_dbf.free_result(_c, res);
-		return 0;
-	}
+	r = db_res2urecord(_d, _aor, res);
 
-	r = 0;
+	ul_dbf.free_result(_c, res);
+	return r;
+}
 
-	for(i = 0; i < RES_ROW_N(res); i++) {
-		ci = dbrow2info(  ROW_VALUES(RES_ROWS(res) + i), &contact);
-		if (ci==0) {
-			LM_ERR("skipping record for %.*s in table %s\n",
-					_aor->len, _aor->s, _d->name->s);
-			continue;
-		}
 
-		if ( r==0 )
-			get_static_urecord( _d, _aor, &r);
+struct ul_async_load {
+	udomain_t *d;
+	str *aor;
+	void *db_priv;
+};
 
-		if ( (c=mem_insert_ucontact(r, &contact, ci)) == 0) {
-			LM_ERR("mem_insert failed\n");
-			free_urecord(r);
-			ul_dbf.free_result(_c, res);
+/* the AoR goes into the raw query as is, so only allow the (ASCII) chars
+ * of a SIP user/host which can not change its meaning, whatever the
+ * charset or the SQL mode of the connection */
+static int ul_sql_safe(const str *s)
+{
+	int i;
+
+	for (i = 0; i < s->len; i++)
+		if (!isalnum((unsigned char)s->s[i]) && (!s->s[i] ||
+			!strchr("+-_.@:!~*()%&=$,;?/[]", s->s[i])))
 			return 0;
+
+	return 1;
+}
+
+int get_urecord_async(udomain_t* _d, str* _aor, void **_ctx)
+{
+	db_key_t columns[UL_COLS - 2];
+	struct ul_async_load *ctx;
+	str user, domain = STR_NULL, query;
+	db_key_t order;
+	char *p, *at;
+	int i, len, fd;
+
+	if (cluster_mode != CM_SQL_ONLY ||
+	!DB_CAPABILITY(ul_dbf, DB_CAP_ASYNC_RAW_QUERY))
+		return -2;
+
+	columns[0] = &contactid_col;
+	columns[1] = &contact_col;
+	columns[2] = &expires_col;
+	columns[3] = &q_col;
+	columns[4] = &callid_col;
+	columns[5] = &cseq_col;
+	columns[6] = &flags_col;
+	columns[7] = &cflags_col;
+	columns[8] = &user_agent_col;
+	columns[9] = &received_col;
+	columns[10] = &path_col;
+	columns[11] = &sock_col;
+	columns[12] = &methods_col;
+	columns[13] = &last_mod_col;
+	columns[14] = &sip_instance_col;
+	columns[15] = &kv_store_col;
+	columns[16] = &attr_col;
+
+	order = desc_time_order ? &last_mod_col : &q_col;
+
+	user = *_aor;
+	if (use_domain) {
+		at = q_memchr(_aor->s, '@', _aor->len);
+		if (!at) {
+			user.len = 0;
+			domain = *_aor;
+		} else {
+			user.len = at - _aor->s;
+			domain.s = at + 1;
+			domain.len = _aor->s + _aor->len - at - 1;
 		}
+	}
 
-		/* We have to do this, because insert_ucontact sets state to CS_NEW
-		 * and we have the contact in the database already */
-		c->state = CS_SYNC;
+	/* anything else is left to the blocking query, which escapes it */
+	if (!ul_sql_safe(&user) || !ul_sql_safe(&domain))
+		return -2;
+
+	/* the SQL keywords and quotes, plus the values */
+	len = 64 +
+		_d->name->len + user_col.len + domain_col.len + order->len +
+		user.len + domain.len;
+	for (i = 0; i < UL_COLS - 2; i++)
+		len += columns[i]->len + 1;
+
+	query.s = pkg_malloc(len);
+	if (!query.s) {
+		LM_ERR("oom\n");
+		return -1;
 	}
 
-	ul_dbf.free_result(_c, res);
-	return r;
+	p = query.s;
+	memcpy(p, "select ", 7); p += 7;
+	for (i = 0; i < UL_COLS - 2; i++) {
+		if (i)
+			*p++ = ',';
+		memcpy(p, columns[i]->s, columns[i]->len);
+		p += columns[i]->len;
+	}
+	p += sprintf(p, " from %.*s where %.*s='", _d->name->len, _d->name->s,
+		user_col.len, user_col.s);
+	memcpy(p, user.s, user.len); p += user.len;
+	*p++ = '\'';
+	if (use_domain) {
+		p += sprintf(p, " and %.*s='", domain_col.len, domain_col.s);
+		memcpy(p, domain.s, domain.len); p += domain.len;
+		*p++ = '\'';
+	}
+	p += sprintf(p, " order by %.*s", order->len, order->s);
+	query.len = p - query.s;
+
+	ctx = pkg_malloc(sizeof *ctx);
+	if (!ctx) {
+		LM_ERR("oom\n");
+		pkg_free(query.s);
+		return -1;
+	}
+
+	ctx->d = _d;
+	ctx->aor = _aor;
+
+	fd = ul_dbf.async_raw_query(ul_dbh, &query, &ctx->db_priv);
+	pkg_free(query.s);
+	if (fd < 0) {
+		LM_ERR("failed to start the query for AoR %.*s\n",
+			_aor->len, _aor->s);
+		pkg_free(ctx);
+		return -1;
+	}
+
+	*_ctx = ctx;
+	return fd;
+}
+
+int resume_urecord_async(int fd, void *_ctx, struct urecord** _r)
+{
+	struct ul_async_load *ctx = (struct ul_async_load *)_ctx;
+	db_res_t *res = NULL;
+	int rc;
+
+	rc = ul_dbf.async_resume(ul_dbh, fd, &res, ctx->db_priv);
+	if (async_status == ASYNC_CONTINUE || async_status == ASYNC_CHANGE_FD)
+		return rc;
+
+	*_r = NULL;
+	if (rc != 0) {
+		LM_ERR("async query for AoR %.*s failed\n",
+			ctx->aor->len, ctx->aor->s);
+	} else if (res) {
+		*_r = db_res2urecord(ctx->d, ctx->aor, res);
+	}
+
+	ul_dbf.async_free_result(ul_dbh, res, ctx->db_priv);
+	pkg_free(ctx);
+
+	return rc != 0 ? -1 : 0;
 }
 
 int
@@ -1427,15 +1639,23 @@ void mem_delete_urecord(udomain_t* _d, struct urecord* _r)
 }
 
 
-int mem_timer_udomain(udomain_t* _d)
+int mem_timer_udomain(udomain_t* _d, int part, int parts)
 {
 	struct urecord* ptr;
 	void ** dest;
 	int i,ret=0,flush=0;
+	int from,to;
 	map_iterator_t it,prev;
+	query_list_t **upd_list;
+
+	/* the slots are split in contiguous ranges, one per flushing process */
+	from = (int)((long long)_d->size * part / parts);
+	to = (int)((long long)_d->size * (part + 1) / parts);
+
+	upd_list = ul_batch_upsert ? &_d->upd_list : NULL;
 
 	cid_len = 0;
-	for(i=0; i<_d->size; i++)
+	for(i=from; i<to; i++)
 	{
 		lock_ulslot(_d, i);
 
@@ -1455,7 +1675,7 @@ int mem_timer_udomain(udomain_t* _d)
 			prev = it;
 			iterator_next(&it);
 
-			if ((ret =timer_urecord(ptr,&_d->ins_list)) < 0) {
+			if ((ret =timer_urecord(ptr,&_d->ins_list,upd_list)) < 0) {
 				LM_ERR("timer_urecord failed\n");
 				unlock_ulslot(_d, i);
 				return -1;
@@ -1484,6 +1704,7 @@ int mem_timer_udomain(udomain_t* _d)
 		LM_ERR("failed to delete contacts from database\n");
 		return -1;
 	}
+	update_stat( flushed_contacts, cid_len);
 
 	if (flush) {
 		LM_DBG("usrloc timer attempting to flush rows to DB\n");
@@ -1492,6 +1713,8 @@ int mem_timer_udomain(udomain_t* _d)
 		 * we are sure that DB updates will be successful */
 		if (ql_flush_rows(&ul_dbf,ul_dbh,_d->ins_list) < 0)
 			LM_ERR("failed to flush rows to DB\n");
+		if (upd_list && ql_flush_rows(&ul_dbf,ul_dbh,*upd_list) < 0)
+			LM_ERR("failed to flush updated rows to DB\n");
 	}
 
 	return 0;
@@ -55,6 +55,7 @@ struct ucontact;
 typedef struct udomain {
 	str* name;                 /*!< Domain name (NULL terminated) */
 	query_list_t *ins_list;    /*!< insert buffering list for this domain */
+	query_list_t *upd_list;    /*!< upsert buffering list (write-back) */
 	int size;                  /*!< Hash table size */
 	struct hslot* table;       /*!< Hash table - array of collision slots */
 	/* statistics */
@@ -85,7 +86,8 @@ void free_udomain(udomain_t* _d);
 /*! \brief
  * Load data from a database
  */
-int preload_udomain(db_con_t* _c, udomain_t* _d);
+int preload_udomain(db_con_t* _c, udomain_t* _d, int part, int parts);
+void preload_udomain_labels(udomain_t* _d);
 
 
 /*! \brief
@@ -101,9 +103,9 @@ int db_timer_udomain(udomain_t* _d);
 
 
 /*! \brief
- * Timer handler for given domain
+ * Timer handler for a part (out of "parts") of the slots of given domain
  */
-int mem_timer_udomain(udomain_t* _d);
+int mem_timer_udomain(udomain_t* _d, int part, int parts);
 
 /*! \brief
  * Insert record into domain
@@ -170,6 +172,28 @@ int insert_urecord(udomain_t* _d, str* _aor, struct urecord** _r,
 typedef int  (*get_urecord_t)(udomain_t* _d, str* _a, struct urecord** _r);
 int get_urecord(udomain_t* _d, str* _aor, struct urecord** _r);
 
+/*! \brief
+ * Start loading an AOR from the DB without blocking (sql-only mode only);
+ * the AOR must stay valid until the record is released
+ *
+ * Return: the fd to wait on for the result (and sets the context needed
+ *         to resume), -1 on error or -2 if async loading is not possible
+ *         (wrong cluster_mode or no async DB support) - use get_urecord()
+ */
+typedef int  (*get_urecord_async_t)(udomain_t* _d, str* _aor, void **_ctx);
+int get_urecord_async(udomain_t* _d, str* _aor, void **_ctx);
+
+/*! \brief
+ * Resume a get_urecord_async() load, once its fd is readable; async_status
+ * tells if the load is over or more data is needed (the context is
+ * released once over)
+ *
+ * Return: 0 if done (_r is NULL if the AOR is not found), -1 on error
+ */
+typedef int  (*resume_urecord_async_t)(int fd, void *_ctx,
+		struct urecord** _r);
+int resume_urecord_async(int fd, void *_ctx, struct urecord** _r);
+
 
 /*! \brief
  * Delete a urecord from domain
@@ -59,6 +59,7 @@
 #include "ul_mi.h"
 #include "ul_callback.h"
 #include "usrloc.h"
+#include "ul_snapshot.h"
 
 
 #define CONTACTID_COL  "contact_id"
@@ -84,6 +85,7 @@
 static int mod_init(void);        /*!< Module initialization */
 static void destroy(void);        /*!< Module destroy */
 static void update_db_state(unsigned int ticks, void* param); /*!< Timer */
+static unsigned long get_flush_rate(void *foo);
 static int child_init(int rank);  /*!< Per-child init function */
 static int mi_child_init(void);
 int check_runtime_config(void);
@@ -177,6 +179,29 @@ db_func_t ul_dbf;
 cachedb_funcs cdbf;
 cachedb_con *cdbc;
 
+/*!< Number of processes loading the location table in parallel */
+int preload_workers = 1;
+/*!< Parts of the location table still being loaded */
+static int *preload_pending;
+static utime_t *preload_start;
+stat_var *preloaded_contacts;
+
+/*!< Number of processes flushing the write-back changes in parallel */
+int flush_workers = 1;
+/*!< The write-back updates are queued as multi-row upserts */
+int ul_batch_upsert;
+stat_var *flushed_contacts;
+
+struct ul_flush_state {
+	/* parts of the running flush not completed yet */
+	int pending;
+	/* rows per second written by the last complete flush */
+	unsigned long rate;
+	utime_t start;
+	unsigned long start_rows;
+};
+static struct ul_flush_state *flush_state;
+
 int mi_dump_kv_store;
 int latency_event_min_us_delta;
 int latency_event_min_us;
@@ -238,12 +263,19 @@ static param_export_t params[] = {
 	{ "skip_replicated_db_ops", INT_PARAM, &skip_replicated_db_ops   },
 	{ "max_contact_delete", INT_PARAM, &max_contact_delete },
 	{ "regen_broken_contactid", INT_PARAM, &cid_regen},
+	{ "preload_workers",    INT_PARAM, &preload_workers  },
+	{ "flush_workers",      INT_PARAM, &flush_workers    },
+	{ "snapshot_file",      STR_PARAM, &snapshot_file.s  },
+	{ "snapshot_interval",  INT_PARAM, &snapshot_interval },
 	{0, 0, 0}
 };
 
 
 static stat_export_t mod_stats[] = {
 	{"registered_users" ,  STAT_IS_FUNC, (stat_var**)get_number_of_users  },
+	{"preloaded_contacts", STAT_NO_RESET, &preloaded_contacts             },
+	{"flushed_contacts",   0,             &flushed_contacts               },
+	{"flush_rows_per_sec", STAT_IS_FUNC, (stat_var**)get_flush_rate      },
 	{0,0,0}
 };
 
@@ -457,6 +489,42 @@ static int mod_init(void)
 				LM_ERR("cannot init rw lock\n");
 				return -1;
 			}
+
+			if (preload_workers < 1) {
+				LM_WARN("invalid preload_workers %d, using 1\n",
+					preload_workers);
+				preload_workers = 1;
+			} else if (preload_workers > 0x10000) {
+				preload_workers = 0x10000;
+			}
+
+			preload_pending = shm_malloc(sizeof *preload_pending +
+				sizeof *preload_start);
+			if (!preload_pending) {
+				LM_ERR("no more shm memory\n");
+				return -1;
+			}
+			*preload_pending = preload_workers;
+			preload_start = (utime_t *)(preload_pending + 1);
+
+			if (flush_workers < 1) {
+				LM_WARN("invalid flush_workers %d, using 1\n", flush_workers);
+				flush_workers = 1;
+			} else if (flush_workers > ul_hash_size) {
+				flush_workers = ul_hash_size;
+			}
+
+			flush_state = shm_malloc(sizeof *flush_state);
+			if (!flush_state) {
+				LM_ERR("no more shm memory\n");
+				return -1;
+			}
+			memset(flush_state, 0, sizeof *flush_state);
+
+			/* with insert buffering on, batch the updates too */
+			ul_batch_upsert = query_buffer_size > 1 &&
+				DB_CAPABILITY(ul_dbf,
+					DB_CAP_MULTIPLE_INSERT|DB_CAP_INSERT_UPDATE);
 		}
 	}
 
@@ -478,6 +546,25 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if (snapshot_file.s) {
+		if (!have_mem_storage()) {
+			LM_ERR("snapshot_file requires the contacts to be kept in memory\n");
+			return -1;
+		}
+
+		if (ul_snapshot_init() < 0) {
+			LM_ERR("failed to init the usrloc snapshots\n");
+			return -1;
+		}
+
+		if (snapshot_interval > 0 && register_timer("ul-snapshot",
+			ul_snapshot_timer, 0, snapshot_interval,
+			TIMER_FLAG_SKIP_ON_DELAY) < 0) {
+			LM_ERR("failed to register the snapshot timer\n");
+			return -1;
+		}
+	}
+
 	if (location_cluster < 0) {
 		LM_ERR("Invalid cluster id to replicate contacts to, must be 0 or "
 			"a positive number\n");
@@ -507,17 +594,68 @@ static int mod_init(void)
 }
 
 
-static void ul_rpc_data_load(int sender_id, void *unsused)
+static void ul_rpc_data_load(int sender_id, void *param)
 {
 	dlist_t* ptr;
+	int part = (int)(long)param;
 
 	for( ptr=root ; ptr ; ptr=ptr->next) {
-		if (preload_udomain(ul_dbh, ptr->d) < 0) {
-			LM_ERR("failed to preload domain '%.*s'\n",
-				ptr->name.len, ZSW(ptr->name.s));
+		if (preload_udomain(ul_dbh, ptr->d, part, preload_workers) < 0) {
+			LM_ERR("failed to preload part %d/%d of domain '%.*s'\n",
+				part + 1, preload_workers, ptr->name.len, ZSW(ptr->name.s));
 			/* continue with the other ul domains */;
 		}
 	}
+
+	/* the last part to complete finishes up the load */
+	if (__sync_sub_and_fetch(preload_pending, 1) != 0)
+		return;
+
+	for( ptr=root ; ptr ; ptr=ptr->next)
+		preload_udomain_labels(ptr->d);
+
+	LM_INFO("preloaded %lu contacts in %llu ms using %d workers\n",
+		(unsigned long)get_stat_val(preloaded_contacts),
+		(unsigned long long)(get_uticks() - *preload_start) / 1000,
+		preload_workers);
+
+	if (snapshot_file.s)
+		ul_snapshot_set_ready();
+}
+
+static int ul_preload_from_db(void)
+{
+	int i;
+
+	*preload_start = get_uticks();
+
+	if (preload_workers == 1) {
+		if (ipc_send_rpc( process_no, ul_rpc_data_load, NULL)<0) {
+			LM_ERR("failed to fire RPC for data load\n");
+			return -1;
+		}
+	} else {
+		/* spread the parts of the table over the available workers,
+		 * each one streaming its part through its own DB connection */
+		for (i = 0; i < preload_workers; i++)
+			if (ipc_dispatch_rpc(ul_rpc_data_load, (void *)(long)i)<0) {
+				LM_ERR("failed to dispatch RPC for data load\n");
+				return -1;
+			}
+	}
+
+	return 0;
+}
+
+static void ul_rpc_snapshot_load(int sender_id, void *unused)
+{
+	if (ul_snapshot_load() != 0 && rr_persist == RRP_LOAD_FROM_SQL) {
+		/* the DB load enables the snapshots once done */
+		if (ul_preload_from_db() == 0)
+			return;
+	}
+
+	ul_snapshot_set_ready();
 }
 
 int init_cachedb(void)
@@ -544,6 +682,15 @@ static int child_init(int _rank)
 	    return -1;
 	}
 
+	/* _rank==1 is used even when fork is disabled; the snapshot load
+	 * falls back to the DB preload, if any */
+	if (_rank==1 && snapshot_file.s) {
+		if (ipc_send_rpc( process_no, ul_rpc_snapshot_load, NULL)<0) {
+			LM_ERR("failed to fire RPC for snapshot load\n");
+			return -1;
+		}
+	}
+
 	if (!have_db_conns())
 		return 0;
 
@@ -557,12 +704,10 @@ static int child_init(int _rank)
 		return -1;
 	}
 	/* _rank==1 is used even when fork is disabled */
-	if (_rank==1 && rr_persist == RRP_LOAD_FROM_SQL) {
+	if (_rank==1 && rr_persist == RRP_LOAD_FROM_SQL && !snapshot_file.s) {
 		/* if cache is used, populate domains from DB */
-		if (ipc_send_rpc( process_no, ul_rpc_data_load, NULL)<0) {
-			LM_ERR("failed to fire RPC for data load\n");
+		if (ul_preload_from_db() < 0)
 			return -1;
-		}
 	}
 
 	return 0;
@@ -595,6 +740,8 @@ static int mi_child_init(void)
  */
 static void destroy(void)
 {
+	int clean = 1;
+
 	if (cdbc)
 		cdbf.destroy(cdbc);
 	cdbc = NULL;
@@ -606,6 +753,7 @@ static void destroy(void)
 			lock_start_read(sync_lock);
 		if (synchronize_all_udomains() != 0) {
 			LM_ERR("flushing cache failed\n");
+			clean = 0;
 		}
 		if (sync_lock) {
 			lock_stop_read(sync_lock);
@@ -615,6 +763,14 @@ static void destroy(void)
 		ul_dbf.close(ul_dbh);
 	}
 
+	/* dump the contacts after the last DB flush, if any */
+	if (snapshot_file.s) {
+		if (!ul_dbh)
+			ul_unlock_locks();
+		ul_snapshot_write(clean);
+		ul_snapshot_destroy();
+	}
+
 	free_all_udomains();
 	ul_destroy_locks();
 
@@ -626,15 +782,73 @@ static void destroy(void)
 /*! \brief
  * Timer handler
  */
-static void update_db_state(unsigned int ticks, void* param)
+static void ul_flush_part(int part, int parts)
 {
+	utime_t elapsed;
+	unsigned long rows;
+
 	if (sync_lock)
 		lock_start_read(sync_lock);
-	if (synchronize_all_udomains() != 0) {
+	if (synchronize_udomains(part, parts) != 0) {
 		LM_ERR("synchronizing cache failed\n");
 	}
 	if (sync_lock)
 		lock_stop_read(sync_lock);
+
+	/* the last part to complete accounts for the whole flush */
+	if (!flush_state || __sync_sub_and_fetch(&flush_state->pending, 1) != 0)
+		return;
+
+	elapsed = get_uticks() - flush_state->start;
+	rows = get_stat_val(flushed_contacts);
+	/* the counter may have been reset in the meantime */
+	rows = rows >= flush_state->start_rows ? rows - flush_state->start_rows : 0;
+
+	flush_state->rate = elapsed ?
+		(unsigned long)((unsigned long long)rows * 1000000 / elapsed) : rows;
+}
+
+static void ul_rpc_flush(int sender_id, void *param)
+{
+	ul_flush_part((int)(long)param, flush_workers);
+}
+
+static void update_db_state(unsigned int ticks, void* param)
+{
+	int i;
+
+	if (!flush_state) {
+		ul_flush_part(0, 1);
+		return;
+	}
+
+	if (flush_state->pending) {
+		LM_WARN("previous flush still in progress, skipping this run\n");
+		return;
+	}
+
+	flush_state->pending = flush_workers;
+	flush_state->start = get_uticks();
+	flush_state->start_rows = get_stat_val(flushed_contacts);
+
+	if (flush_workers == 1) {
+		ul_flush_part(0, 1);
+		return;
+	}
+
+	/* each worker flushes its own range of hash slots, through
+	 * its own DB connection */
+	for (i = 0; i < flush_workers; i++)
+		if (ipc_dispatch_rpc(ul_rpc_flush, (void *)(long)i) < 0) {
+			LM_ERR("failed to dispatch part %d of the flush, "
+				"doing it inline\n", i);
+			ul_flush_part(i, flush_workers);
+		}
+}
+
+static unsigned long get_flush_rate(void *foo)
+{
+	return flush_state ? flush_state->rate : 0;
 }
 
 int check_runtime_config(void)
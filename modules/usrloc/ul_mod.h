@@ -35,6 +35,7 @@
 #include "../../db/db.h"
 #include "../../str.h"
 #include "../../cachedb/cachedb.h"
+#include "../../statistics.h"
 
 #include "usrloc.h"
 
@@ -121,6 +122,11 @@ extern int cseq_delay;
 extern int ul_hash_size;
 extern int latency_event_min_us_delta;
 extern int latency_event_min_us;
+extern int preload_workers;
+extern stat_var *preloaded_contacts;
+extern int flush_workers;
+extern int ul_batch_upsert;
+extern stat_var *flushed_contacts;
 
 extern db_con_t* ul_dbh;   /* Database connection handle */
 extern db_func_t ul_dbf;
@@ -0,0 +1,647 @@
+/*
+ * Usrloc snapshot file, for fast restarts
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../../mem/mem.h"
+#include "../../mem/shm_mem.h"
+#include "../../dprint.h"
+#include "../../ut.h"
+#include "../../socket_info.h"
+#include "../../resolve.h"
+
+#include "ul_snapshot.h"
+#include "ul_mod.h"
+#include "dlist.h"
+#include "udomain.h"
+#include "urecord.h"
+#include "ucontact.h"
+#include "kv_store.h"
+
+str snapshot_file;
+int snapshot_interval = 0;
+
+/* set once the startup load is over, the periodic dumps wait for it */
+static int *snapshot_ready;
+
+struct snap_buf {
+	char *s;
+	unsigned int len;
+	unsigned int size;
+};
+
+#define SNAP_BUF_INIT  (64 * 1024)
+
+
+int ul_snapshot_init(void)
+{
+	snapshot_file.len = strlen(snapshot_file.s);
+
+	snapshot_ready = shm_malloc(sizeof *snapshot_ready);
+	if (!snapshot_ready) {
+		LM_ERR("no more shm memory\n");
+		return -1;
+	}
+	*snapshot_ready = 0;
+
+	return 0;
+}
+
+void ul_snapshot_destroy(void)
+{
+	if (snapshot_ready) {
+		shm_free(snapshot_ready);
+		snapshot_ready = NULL;
+	}
+}
+
+void ul_snapshot_set_ready(void)
+{
+	*snapshot_ready = 1;
+}
+
+
+static int snap_reserve(struct snap_buf *b, unsigned int len)
+{
+	unsigned int size;
+	char *p;
+
+	if (b->len + len <= b->size)
+		return 0;
+
+	for (size = b->size ? b->size : SNAP_BUF_INIT; size < b->len + len; )
+		size *= 2;
+
+	p = pkg_realloc(b->s, size);
+	if (!p) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+
+	b->s = p;
+	b->size = size;
+	return 0;
+}
+
+static inline int snap_push(struct snap_buf *b, const void *data,
+															unsigned int len)
+{
+	if (snap_reserve(b, len) < 0)
+		return -1;
+
+	memcpy(b->s + b->len, data, len);
+	b->len += len;
+	return 0;
+}
+
+static inline int snap_push_str(struct snap_buf *b, const str *s)
+{
+	unsigned int len = (s && s->s) ? s->len : 0;
+
+	if (snap_push(b, &len, sizeof len) < 0)
+		return -1;
+
+	return len ? snap_push(b, s->s, len) : 0;
+}
+
+#define snap_push_val(_b, _v) snap_push(_b, &(_v), sizeof (_v))
+
+static inline int snap_push_tag(struct snap_buf *b, char tag)
+{
+	return snap_push(b, &tag, 1);
+}
+
+static int snap_push_contact(struct snap_buf *b, ucontact_t *c)
+{
+	str kv = STR_NULL;
+	int ret;
+
+	if (c->kv_storage && map_size(c->kv_storage) != 0)
+		kv = store_serialize(c->kv_storage);
+
+	ret = snap_push_tag(b, 'c') |
+		snap_push_val(b, c->contact_id) |
+		snap_push_str(b, &c->c) |
+		snap_push_str(b, &c->received) |
+		snap_push_str(b, &c->path) |
+		snap_push_str(b, &c->callid) |
+		snap_push_str(b, &c->user_agent) |
+		snap_push_str(b, &c->attr) |
+		snap_push_str(b, &c->instance) |
+		snap_push_str(b, c->sock ? &c->sock->sock_str : NULL) |
+		snap_push_str(b, &kv) |
+		snap_push_val(b, c->expires) |
+		snap_push_val(b, c->expires_in) |
+		snap_push_val(b, c->expires_out) |
+		snap_push_val(b, c->last_modified) |
+		snap_push_val(b, c->q) |
+		snap_push_val(b, c->cseq) |
+		snap_push_val(b, c->flags) |
+		snap_push_val(b, c->cflags) |
+		snap_push_val(b, c->methods);
+
+	if (kv.s)
+		store_free_buffer(&kv);
+
+	return ret;
+}
+
+/* serialize the valid contacts of a slot; the slot lock must be held */
+static int snap_push_slot(struct snap_buf *b, udomain_t *d, int i,
+								struct ul_snapshot_hdr *hdr, time_t now)
+{
+	map_iterator_t it;
+	urecord_t *r;
+	ucontact_t *c;
+	void **p;
+	int r_pushed;
+
+	if (d->table[i].next_label &&
+		(snap_push_tag(b, 's') | snap_push_val(b, i) |
+		snap_push_val(b, d->table[i].next_label)) < 0)
+		return -1;
+
+	for (map_first(d->table[i].records, &it); iterator_is_valid(&it);
+		iterator_next(&it)) {
+		p = iterator_val(&it);
+		if (!p)
+			return -1;
+		r = (urecord_t *)*p;
+
+		r_pushed = 0;
+		for (c = r->contacts; c; c = c->next) {
+			if (!VALID_CONTACT(c, now))
+				continue;
+
+			if (!r_pushed) {
+				if ((snap_push_tag(b, 'r') | snap_push_str(b, &r->aor) |
+					snap_push_val(b, r->label) |
+					snap_push_val(b, r->next_clabel)) < 0)
+					return -1;
+				hdr->records++;
+				r_pushed = 1;
+			}
+
+			if (snap_push_contact(b, c) < 0)
+				return -1;
+			hdr->contacts++;
+		}
+	}
+
+	return 0;
+}
+
+static int snap_flush(FILE *f, struct snap_buf *b,
+											struct ul_snapshot_hdr *hdr)
+{
+	if (b->len && fwrite(b->s, 1, b->len, f) != b->len) {
+		LM_ERR("failed to write the snapshot: %s\n", strerror(errno));
+		return -1;
+	}
+
+	hdr->length += b->len;
+	b->len = 0;
+	return 0;
+}
+
+int ul_snapshot_write(int clean)
+{
+	struct ul_snapshot_hdr hdr;
+	struct snap_buf b = {NULL, 0, 0};
+	char tmp_path[MAX_PATH_SIZE];
+	dlist_t *dl;
+	udomain_t *d;
+	FILE *f;
+	time_t now;
+	int i;
+
+	if (!snapshot_ready || !*snapshot_ready || !have_mem_storage())
+		return 0;
+
+	if (snprintf(tmp_path, MAX_PATH_SIZE, "%.*s.%d", snapshot_file.len,
+		snapshot_file.s, (int)getpid()) >= MAX_PATH_SIZE) {
+		LM_ERR("snapshot file path too long\n");
+		return -1;
+	}
+
+	f = fopen(tmp_path, "w");
+	if (!f) {
+		LM_ERR("failed to open %s: %s\n", tmp_path, strerror(errno));
+		return -1;
+	}
+
+	memset(&hdr, 0, sizeof hdr);
+	hdr.magic = UL_SNAPSHOT_MAGIC;
+	hdr.version = UL_SNAPSHOT_VERSION;
+	hdr.clean = clean ? 1 : 0;
+	hdr.hash_size = ul_hash_size;
+	hdr.time_size = sizeof(time_t);
+	hdr.hdr_size = sizeof hdr;
+
+	/* a placeholder, rewritten once the counters are known */
+	if (fwrite(&hdr, sizeof hdr, 1, f) != 1)
+		goto error;
+
+	now = time(NULL);
+
+	for (dl = root; dl; dl = dl->next) {
+		d = dl->d;
+		if (snap_push_tag(&b, 'd') < 0 || snap_push_str(&b, &dl->name) < 0)
+			goto error;
+
+		/* only one slot is locked (and copied) at a time, so the workers
+		 * are never held back for more than a slot's worth of records */
+		for (i = 0; i < d->size; i++) {
+			lock_ulslot(d, i);
+			if (snap_push_slot(&b, d, i, &hdr, now) < 0) {
+				unlock_ulslot(d, i);
+				goto error;
+			}
+			unlock_ulslot(d, i);
+
+			if (b.len >= SNAP_BUF_INIT && snap_flush(f, &b, &hdr) < 0)
+				goto error;
+		}
+	}
+
+	if (snap_push_tag(&b, 'e') < 0 || snap_flush(f, &b, &hdr) < 0)
+		goto error;
+
+	hdr.written = time(NULL);
+	if (fseek(f, 0, SEEK_SET) != 0 || fwrite(&hdr, sizeof hdr, 1, f) != 1 ||
+		fflush(f) != 0 || fsync(fileno(f)) != 0)
+		goto error;
+
+	fclose(f);
+	f = NULL;
+
+	if (rename(tmp_path, snapshot_file.s) != 0) {
+		LM_ERR("failed to rename %s: %s\n", tmp_path, strerror(errno));
+		goto error;
+	}
+
+	if (b.s)
+		pkg_free(b.s);
+
+	LM_DBG("dumped %u records, %u contacts to %s\n", hdr.records,
+		hdr.contacts, snapshot_file.s);
+	return 0;
+
+error:
+	LM_ERR("failed to dump the usrloc snapshot\n");
+	if (f) {
+		fclose(f);
+		unlink(tmp_path);
+	}
+	if (b.s)
+		pkg_free(b.s);
+	return -1;
+}
+
+void ul_snapshot_timer(unsigned int ticks, void *param)
+{
+	ul_snapshot_write(0);
+}
+
+
+struct snap_reader {
+	char *p;
+	char *end;
+};
+
+static inline int snap_pop(struct snap_reader *r, void *data, unsigned int len)
+{
+	if (r->end - r->p < (long)len)
+		return -1;
+
+	memcpy(data, r->p, len);
+	r->p += len;
+	return 0;
+}
+
+/* the returned string points inside the mapping - not null terminated! */
+static inline int snap_pop_str(struct snap_reader *r, str *s)
+{
+	unsigned int len;
+
+	if (snap_pop(r, &len, sizeof len) < 0 || r->end - r->p < (long)len)
+		return -1;
+
+	s->s = len ? r->p : NULL;
+	s->len = len;
+	r->p += len;
+	return 0;
+}
+
+#define snap_pop_val(_r, _v) snap_pop(_r, &(_v), sizeof (_v))
+
+static int snap_pop_contact(struct snap_reader *r, ucontact_info_t *ci,
+									str *contact, str *sock, str *kv)
+{
+	static str path, callid, user_agent, attr;
+
+	memset(ci, 0, sizeof *ci);
+	ci->path = &path;
+	ci->callid = &callid;
+	ci->user_agent = &user_agent;
+	ci->attr = &attr;
+	ci->packed_kv_storage = kv;
+
+	return snap_pop_val(r, ci->contact_id) |
+		snap_pop_str(r, contact) |
+		snap_pop_str(r, &ci->received) |
+		snap_pop_str(r, &path) |
+		snap_pop_str(r, &callid) |
+		snap_pop_str(r, &user_agent) |
+		snap_pop_str(r, &attr) |
+		snap_pop_str(r, &ci->instance) |
+		snap_pop_str(r, sock) |
+		snap_pop_str(r, kv) |
+		snap_pop_val(r, ci->expires) |
+		snap_pop_val(r, ci->expires_in) |
+		snap_pop_val(r, ci->expires_out) |
+		snap_pop_val(r, ci->last_modified) |
+		snap_pop_val(r, ci->q) |
+		snap_pop_val(r, ci->cseq) |
+		snap_pop_val(r, ci->flags) |
+		snap_pop_val(r, ci->cflags) |
+		snap_pop_val(r, ci->methods);
+}
+
+static struct socket_info *snap_sock(str *sock)
+{
+	str host;
+	int port, proto;
+
+	if (!sock->s)
+		return NULL;
+
+	if (parse_phostport(sock->s, sock->len, &host.s, &host.len,
+		&port, &proto) != 0) {
+		LM_ERR("bad socket <%.*s>\n", sock->len, sock->s);
+		return NULL;
+	}
+
+	return grep_sock_info(&host, (unsigned short)port, (unsigned short)proto);
+}
+
+#define SNAP_CHECK     0
+#define SNAP_LOAD      1
+#define SNAP_ROLLBACK  2
+
+/*
+ * Walk all the entries of the file. SNAP_CHECK only checks that the file is
+ * complete and consistent, so a bad file is refused before it leaves
+ * anything behind in memory. SNAP_ROLLBACK undoes a SNAP_LOAD which failed
+ * half way, for the entries up to @rd->end.
+ */
+static int snap_walk(struct snap_reader *rd, struct ul_snapshot_hdr *hdr,
+																int mode)
+{
+	udomain_t *d = NULL;
+	urecord_t *r = NULL;
+	ucontact_t *c;
+	ucontact_info_t ci;
+	str name, aor, contact, kv;
+	str sock = STR_NULL;
+	unsigned int label, next_label;
+	unsigned short next_clabel;
+	unsigned int records = 0, contacts = 0;
+	int sl, ret;
+	int load = (mode == SNAP_LOAD);
+	char tag;
+
+	for (;;) {
+		if (mode == SNAP_ROLLBACK && rd->p == rd->end)
+			tag = 'e';
+		else if (snap_pop(rd, &tag, 1) < 0)
+			goto bad_file;
+
+		if (tag != 'c' && r) {
+			if (mode == SNAP_ROLLBACK && !r->contacts) {
+				mem_delete_urecord(d, r);
+				unlock_udomain(d, &aor);
+			} else {
+				unlock_udomain(d, &r->aor);
+			}
+			r = NULL;
+		}
+
+		switch (tag) {
+		case 'd':
+			if (snap_pop_str(rd, &name) < 0)
+				goto bad_file;
+			if (find_domain(&name, &d) != 0) {
+				LM_ERR("snapshot domain '%.*s' is not local\n",
+					name.len, name.s);
+				goto error;
+			}
+			break;
+		case 's':
+			if (!d || snap_pop_val(rd, sl) < 0 ||
+				snap_pop_val(rd, next_label) < 0 || sl < 0 || sl >= d->size)
+				goto bad_file;
+
+			if (load) {
+				lock_ulslot(d, sl);
+				if (d->table[sl].next_label < next_label)
+					d->table[sl].next_label = next_label;
+				unlock_ulslot(d, sl);
+			}
+			break;
+		case 'r':
+			if (!d || snap_pop_str(rd, &aor) < 0 || !aor.s ||
+				snap_pop_val(rd, label) < 0 || snap_pop_val(rd, next_clabel) < 0)
+				goto bad_file;
+			records++;
+
+			if (mode == SNAP_ROLLBACK) {
+				lock_udomain(d, &aor);
+				if (get_urecord(d, &aor, &r) != 0) {
+					unlock_udomain(d, &aor);
+					r = NULL;
+				}
+				break;
+			}
+
+			if (!load)
+				break;
+
+			lock_udomain(d, &aor);
+			if ((ret = get_urecord(d, &aor, &r)) > 0) {
+				if (mem_insert_urecord(d, &aor, &r) < 0) {
+					LM_ERR("failed to create a record\n");
+					unlock_udomain(d, &aor);
+					r = NULL;
+					goto error;
+				}
+				r->label = label;
+				r->next_clabel = next_clabel;
+			} else if (ret < 0) {
+				unlock_udomain(d, &aor);
+				r = NULL;
+				goto error;
+			}
+			break;
+		case 'c':
+			if (!records || (load && !r) || snap_pop_contact(rd, &ci, &contact,
+				&sock, &kv) < 0 || !contact.s)
+				goto bad_file;
+			contacts++;
+
+			/* only drop the contacts the load inserted */
+			if (mode == SNAP_ROLLBACK) {
+				if (r && get_simple_ucontact(r, &contact, &c) == 0 &&
+					c->contact_id == ci.contact_id)
+					mem_delete_ucontact(r, c);
+				break;
+			}
+
+			if (!load)
+				break;
+
+			ci.sock = snap_sock(&sock);
+			if ((c = mem_insert_ucontact(r, &contact, &ci)) == NULL) {
+				LM_ERR("failed to insert contact <%.*s> of <%.*s>\n",
+					contact.len, contact.s, r->aor.len, r->aor.s);
+				continue;
+			}
+			/* the contact is not new - it was flushed before the dump */
+			c->state = CS_SYNC;
+			break;
+		case 'e':
+			if (mode == SNAP_ROLLBACK)
+				return 0;
+			if (rd->p != rd->end || records != hdr->records ||
+				contacts != hdr->contacts)
+				goto bad_file;
+			if (load)
+				update_stat(preloaded_contacts, contacts);
+			return 0;
+		default:
+			goto bad_file;
+		}
+	}
+
+bad_file:
+	LM_ERR("truncated or corrupted snapshot file %s\n", snapshot_file.s);
+error:
+	if (r)
+		unlock_udomain(d, &r->aor);
+	return -1;
+}
+
+int ul_snapshot_load(void)
+{
+	struct ul_snapshot_hdr hdr;
+	struct snap_reader rd;
+	struct stat st;
+	dlist_t *dl;
+	char *map;
+	int fd, ret = -1;
+
+	fd = open(snapshot_file.s, O_RDONLY);
+	if (fd < 0) {
+		if (errno == ENOENT)
+			LM_INFO("no usrloc snapshot found at %s\n", snapshot_file.s);
+		else
+			LM_ERR("failed to open %s: %s\n", snapshot_file.s,
+				strerror(errno));
+		return -1;
+	}
+
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof hdr) {
+		LM_ERR("bad snapshot file %s\n", snapshot_file.s);
+		close(fd);
+		return -1;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		LM_ERR("failed to map %s: %s\n", snapshot_file.s, strerror(errno));
+		return -1;
+	}
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+	memcpy(&hdr, map, sizeof hdr);
+	if (hdr.magic != UL_SNAPSHOT_MAGIC || hdr.version != UL_SNAPSHOT_VERSION ||
+		hdr.hdr_size != sizeof hdr || hdr.time_size != sizeof(time_t)) {
+		LM_INFO("snapshot %s has a different format, ignoring it\n",
+			snapshot_file.s);
+		goto out;
+	}
+	if (hdr.hash_size != (unsigned int)ul_hash_size) {
+		LM_INFO("snapshot %s was taken with another hash_size, ignoring it\n",
+			snapshot_file.s);
+		goto out;
+	}
+	if (hdr.length != st.st_size - sizeof hdr) {
+		LM_ERR("truncated snapshot file %s\n", snapshot_file.s);
+		goto out;
+	}
+	/* contacts may have changed in the DB after a periodic dump */
+	if (!hdr.clean && rr_persist == RRP_LOAD_FROM_SQL) {
+		LM_INFO("snapshot %s was not written on shutdown, using the DB\n",
+			snapshot_file.s);
+		goto out;
+	}
+
+	rd.p = map + sizeof hdr;
+	rd.end = map + st.st_size;
+	if (snap_walk(&rd, &hdr, SNAP_CHECK) < 0)
+		goto out;
+
+	rd.p = map + sizeof hdr;
+	if (snap_walk(&rd, &hdr, SNAP_LOAD) < 0) {
+		/* the DB load comes next, so leave nothing half loaded behind */
+		LM_ERR("failed to load snapshot %s, discarding what was loaded\n",
+			snapshot_file.s);
+		rd.end = rd.p;
+		rd.p = map + sizeof hdr;
+		snap_walk(&rd, &hdr, SNAP_ROLLBACK);
+		goto out;
+	}
+
+	for (dl = root; dl; dl = dl->next)
+		preload_udomain_labels(dl->d);
+
+	LM_INFO("loaded %u records, %u contacts from snapshot %s (taken %ld "
+		"seconds ago)\n", hdr.records, hdr.contacts, snapshot_file.s,
+		(long)(time(NULL) - hdr.written));
+	ret = 0;
+
+out:
+	munmap(map, st.st_size);
+
+	/* consumed - a later restart must not go back to this state */
+	if (ret == 0 && unlink(snapshot_file.s) != 0)
+		LM_ERR("failed to remove %s: %s\n", snapshot_file.s, strerror(errno));
+
+	return ret;
+}
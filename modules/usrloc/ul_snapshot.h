@@ -0,0 +1,85 @@
+/*
+ * Usrloc snapshot file, for fast restarts
+ *
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+#ifndef _USRLOC_SNAPSHOT_H_
+#define _USRLOC_SNAPSHOT_H_
+
+#include <time.h>
+
+#include "../../str.h"
+
+#define UL_SNAPSHOT_MAGIC    0x4c55534f /* "OSUL" */
+#define UL_SNAPSHOT_VERSION  1
+
+/*
+ * The file holds a header followed by a stream of entries, each one
+ * starting with a one byte tag:
+ *   'd' - domain:  name
+ *   's' - slot:    index, next record label
+ *   'r' - record:  AoR, label, next contact label
+ *   'c' - contact: belongs to the last record
+ *   'e' - end of the file
+ * Integers are stored in host order, strings as a 32 bit length followed
+ * by the bytes - the file is only meant to be read back by the same box.
+ */
+struct ul_snapshot_hdr {
+	unsigned int magic;
+	unsigned short version;
+	/* written on shutdown, after the last DB flush */
+	unsigned short clean;
+	unsigned int hash_size;
+	/* guards against files written by a build with another ABI */
+	unsigned short time_size;
+	unsigned short hdr_size;
+	unsigned int records;
+	unsigned int contacts;
+	unsigned long long length;
+	time_t written;
+};
+
+extern str snapshot_file;
+extern int snapshot_interval;
+
+int ul_snapshot_init(void);
+void ul_snapshot_destroy(void);
+
+/*! \brief
+ * Dump all the in-memory domains to the snapshot file (atomically replaced)
+ */
+int ul_snapshot_write(int clean);
+
+/*! \brief
+ * Load the snapshot file, if any and if usable (the file is consumed)
+ *
+ * Return: 0 if loaded, -1 otherwise (the caller should fall back to
+ *         the regular preload)
+ */
+int ul_snapshot_load(void);
+
+/*! \brief
+ * Allow the periodic snapshots, once the startup load is over
+ */
+void ul_snapshot_set_ready(void);
+
+void ul_snapshot_timer(unsigned int ticks, void *param);
+
+#endif /* _USRLOC_SNAPSHOT_H_ */
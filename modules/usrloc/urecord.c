@@ -305,9 +305,12 @@ static inline int ALLOW_UNUSED wt_timer(urecord_t* _r)
 
 
 /*! \brief
- * Write-back timer
+ * Write-back timer; with an upd_list, the updates are queued as batched
+ * upserts. A contact refreshed several times between two runs is still
+ * written once, as the runs only look at its latest state.
  */
-static inline int wb_timer(urecord_t* _r,query_list_t **ins_list)
+static inline int wb_timer(urecord_t* _r,query_list_t **ins_list,
+													query_list_t **upd_list)
 {
 	ucontact_t* ptr, *t;
 	cstate_t old_state;
@@ -351,6 +354,7 @@ static inline int wb_timer(urecord_t* _r,query_list_t **ins_list)
 						 * be able to get inserted due to index collision */
 						continue;
 					}
+					update_stat( flushed_contacts, cid_len);
 					cid_len = 0;
 				}
 			}
@@ -369,15 +373,28 @@ static inline int wb_timer(urecord_t* _r,query_list_t **ins_list)
 				if (db_insert_ucontact(ptr,ins_list,0) < 0) {
 					LM_ERR("inserting contact into database failed\n");
 					ptr->state = old_state;
+				} else {
+					update_stat( flushed_contacts, 1);
 				}
 				if (ins_done == 0)
 					ins_done = 1;
 				break;
 
 			case 2: /* update */
-				if (db_update_ucontact(ptr) < 0) {
+				if (upd_list) {
+					if (db_insert_ucontact(ptr,upd_list,1) < 0) {
+						LM_ERR("updating contact in db failed\n");
+						ptr->state = old_state;
+					} else {
+						update_stat( flushed_contacts, 1);
+					}
+					if (ins_done == 0)
+						ins_done = 1;
+				} else if (db_update_ucontact(ptr) < 0) {
 					LM_ERR("updating contact in db failed\n");
 					ptr->state = old_state;
+				} else {
+					update_stat( flushed_contacts, 1);
 				}
 				break;
 			}
@@ -400,7 +417,7 @@ static inline int db_only_timer(urecord_t* _r) {
 		return -1;
 	}
 
-	if (wb_timer(_r, 0) < 0) {
+	if (wb_timer(_r, 0, 0) < 0) {
 		LM_ERR("failed to sync with db\n");
 		return -1;
 	}
@@ -419,7 +436,8 @@ static inline int db_only_timer(urecord_t* _r) {
 
 
 
-int timer_urecord(urecord_t* _r,query_list_t **ins_list)
+int timer_urecord(urecord_t* _r,query_list_t **ins_list,
+													query_list_t **upd_list)
 {
 	if (!have_mem_storage())
 		return 0;
@@ -431,7 +449,7 @@ int timer_urecord(urecord_t* _r,query_list_t **ins_list)
 	case RRP_LOAD_FROM_SQL:
 		/* use also the write_back timer routine to handle the failed
 		 * realtime inserts/updates */
-		return wb_timer(_r, ins_list); /* wt_timer(_r); */
+		return wb_timer(_r, ins_list, upd_list); /* wt_timer(_r); */
 	default:
 		return 0; /* Makes gcc happy */
 	}
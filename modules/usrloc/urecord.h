@@ -98,7 +98,8 @@ void mem_delete_ucontact(urecord_t* _r, ucontact_t* _c);
 /*
  * Timer handler
  */
-int timer_urecord(urecord_t* _r,query_list_t **ins_list);
+int timer_urecord(urecord_t* _r,query_list_t **ins_list,
+		query_list_t **upd_list);
 
 
 /*
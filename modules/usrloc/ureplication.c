@@ -700,6 +700,11 @@ static int receive_sync_request(int node_id)
 					goto error_unlock;
 				r = (urecord_t *)*p;
 
+				/* unlike the slot, the AoR hash does not depend on the
+				 * hash_size of each node */
+				if (!clusterer_api.sync_in_shard(r->aorhash))
+					continue;
+
 				sync_packet = clusterer_api.sync_chunk_start(&contact_repl_cap,
 											location_cluster, node_id);
 				if (!sync_packet)
@@ -59,6 +59,8 @@ int bind_usrloc(usrloc_api_t* api)
 	api->insert_urecord          = insert_urecord;
 	api->delete_urecord          = delete_urecord;
 	api->get_urecord             = get_urecord;
+	api->get_urecord_async       = get_urecord_async;
+	api->resume_urecord_async    = resume_urecord_async;
 	api->lock_udomain            = lock_udomain;
 	api->unlock_udomain          = unlock_udomain;
 	api->lock_ulslot             = lock_ulslot;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Project
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <unistd.h>
+#include <string.h>
+
+#include "mem/shm_mem.h"
+#include "locking.h"
+#include "timer.h"
+#include "dprint.h"
+#include "rcu.h"
+
+/* how long a writer sleeps (us) between two checks of a reader */
+#define RCU_WAIT 10
+
+struct rcu_deferred {
+	void *data;
+	rcu_free_f *free_f;
+	/* epoch in which the data was retired */
+	unsigned long epoch;
+	struct rcu_deferred *next;
+};
+
+struct rcu_deferred_list {
+	gen_lock_t lock;
+	struct rcu_deferred *first;
+	struct rcu_deferred *last;
+};
+
+struct rcu_slot *rcu_slots;
+volatile unsigned long *rcu_epoch;
+/* per-process nesting level of the read sections */
+int rcu_nesting;
+
+static unsigned int rcu_slots_no;
+static struct rcu_deferred_list *rcu_deferred;
+
+
+static void rcu_timer(unsigned int ticks, void *param);
+
+int init_rcu(void)
+{
+	rcu_slots_no = counted_processes;
+
+	rcu_epoch = shm_malloc(sizeof *rcu_epoch +
+		sizeof *rcu_deferred + rcu_slots_no * sizeof *rcu_slots);
+	if (!rcu_epoch) {
+		LM_ERR("oom\n");
+		return -1;
+	}
+	*rcu_epoch = 1;
+
+	rcu_deferred = (struct rcu_deferred_list *)(rcu_epoch + 1);
+	memset(rcu_deferred, 0, sizeof *rcu_deferred);
+	if (!lock_init(&rcu_deferred->lock)) {
+		LM_ERR("failed to init lock\n");
+		goto error;
+	}
+
+	if (register_timer("rcu-reclaim", rcu_timer, NULL, 1,
+	TIMER_FLAG_DELAY_ON_DELAY) < 0) {
+		LM_ERR("failed to register the reclaim timer\n");
+		goto error;
+	}
+
+	/* the slots are set last - having them enables the read sections */
+	rcu_slots = (struct rcu_slot *)(rcu_deferred + 1);
+	memset(rcu_slots, 0, rcu_slots_no * sizeof *rcu_slots);
+
+	return 0;
+
+error:
+	shm_free((void *)rcu_epoch);
+	rcu_epoch = NULL;
+	rcu_deferred = NULL;
+	return -1;
+}
+
+
+/* returns the oldest epoch a reader is still running in, or 0 if idle */
+static unsigned long rcu_oldest_reader(void)
+{
+	unsigned long e, oldest = 0;
+	unsigned int i;
+
+	__sync_synchronize();
+
+	for (i = 0; i < rcu_slots_no; i++) {
+		e = rcu_slots[i].epoch;
+		if (e && (!oldest || e < oldest))
+			oldest = e;
+	}
+
+	return oldest;
+}
+
+
+void rcu_synchronize(void)
+{
+	unsigned long target;
+	unsigned int i;
+
+	/* not initialized yet - nobody else may be reading */
+	if (!rcu_slots)
+		return;
+
+	target = __sync_add_and_fetch(rcu_epoch, 1);
+
+	for (i = 0; i < rcu_slots_no; i++) {
+		/* we may be inside a read section ourselves */
+		if (i == process_no)
+			continue;
+
+		while (rcu_slots[i].epoch && rcu_slots[i].epoch < target)
+			usleep(RCU_WAIT);
+	}
+
+	__sync_synchronize();
+}
+
+
+int rcu_defer_free(void *data, rcu_free_f *free_f)
+{
+	struct rcu_deferred *d;
+
+	if (!rcu_slots) {
+		free_f(data);
+		return 0;
+	}
+
+	d = shm_malloc(sizeof *d);
+	if (!d) {
+		LM_ERR("oom, releasing the data synchronously\n");
+		rcu_synchronize();
+		free_f(data);
+		return -1;
+	}
+
+	d->data = data;
+	d->free_f = free_f;
+	d->next = NULL;
+
+	lock_get(&rcu_deferred->lock);
+
+	d->epoch = __sync_add_and_fetch(rcu_epoch, 1);
+	if (rcu_deferred->last)
+		rcu_deferred->last->next = d;
+	else
+		rcu_deferred->first = d;
+	rcu_deferred->last = d;
+
+	lock_release(&rcu_deferred->lock);
+
+	return 0;
+}
+
+
+static void rcu_timer(unsigned int ticks, void *param)
+{
+	struct rcu_deferred *d, *first, *last;
+	unsigned long oldest, limit;
+
+	if (!rcu_deferred->first)
+		return;
+
+	/* the entries retired after this point may be seen by readers which
+	 * enter after the scan below, so they must be left for the next run */
+	limit = *rcu_epoch;
+	__sync_synchronize();
+
+	oldest = rcu_oldest_reader();
+	if (oldest && oldest < limit)
+		limit = oldest;
+
+	lock_get(&rcu_deferred->lock);
+
+	/* the list is sorted by epoch - detach all the entries
+	 * which are no longer visible to any reader */
+	first = last = NULL;
+	for (d = rcu_deferred->first; d; d = d->next) {
+		if (d->epoch > limit)
+			break;
+		last = d;
+	}
+
+	if (last) {
+		first = rcu_deferred->first;
+		rcu_deferred->first = last->next;
+		if (!rcu_deferred->first)
+			rcu_deferred->last = NULL;
+		last->next = NULL;
+	}
+
+	lock_release(&rcu_deferred->lock);
+
+	while (first) {
+		d = first;
+		first = first->next;
+
+		d->free_f(d->data);
+		shm_free(d);
+	}
+}
+
+
+void destroy_rcu(void)
+{
+	struct rcu_deferred *d;
+
+	if (!rcu_epoch)
+		return;
+
+	rcu_slots = NULL;
+
+	while ((d = rcu_deferred->first)) {
+		rcu_deferred->first = d->next;
+		d->free_f(d->data);
+		shm_free(d);
+	}
+
+	lock_destroy(&rcu_deferred->lock);
+	shm_free((void *)rcu_epoch);
+	rcu_epoch = NULL;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Project
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Epoch based reclamation (RCU-like) for data kept in shared memory.
+ *
+ * Meant for data which is read on every request, but only replaced as a
+ * whole once in a while (e.g. on a reload). Readers take no lock at all:
+ * they only publish, in their own (cache line sized) slot, the epoch they
+ * entered the read section in. A writer builds the new version, swaps the
+ * pointer and then either waits for all the older readers to go away via
+ * rcu_synchronize() or hands the old version to rcu_defer_free() and
+ * carries on.
+ *
+ * Writers still have to serialize among themselves (with a lock of their
+ * own), RCU only removes the readers from the picture.
+ */
+
+#ifndef _CORE_RCU_H
+#define _CORE_RCU_H
+
+#include "pt.h"
+
+#define RCU_CACHE_LINE 64
+
+struct rcu_slot {
+	/* epoch in which the process entered the read section, 0 if idle */
+	volatile unsigned long epoch;
+	char _pad[RCU_CACHE_LINE - sizeof(unsigned long)];
+};
+
+extern struct rcu_slot *rcu_slots;
+extern volatile unsigned long *rcu_epoch;
+extern int rcu_nesting;
+
+typedef void (rcu_free_f)(void *data);
+
+/* must be called after the multi-process support is initialized */
+int init_rcu(void);
+void destroy_rcu(void);
+
+/*
+ * Enter / leave a read section. They nest and they never block - the data
+ * accessed in between is guaranteed not to be freed under our feet. They
+ * do nothing only before init_rcu() (rcu_slots not available), while the
+ * startup runs in a single process.
+ */
+static inline void rcu_read_lock(void)
+{
+	if (rcu_nesting++ == 0 && rcu_slots) {
+		rcu_slots[process_no].epoch = *rcu_epoch;
+		/* the slot must be visible before touching the protected data */
+		__sync_synchronize();
+	}
+}
+
+static inline void rcu_read_unlock(void)
+{
+	if (--rcu_nesting == 0 && rcu_slots) {
+		/* all reads must complete before we announce we are done */
+		__sync_synchronize();
+		rcu_slots[process_no].epoch = 0;
+	}
+}
+
+/*
+ * Wait until all the readers which may still see the data unlinked
+ * before this call have left their read sections. It blocks, so call
+ * it only from reload/timer/MI context, never from a SIP worker.
+ */
+void rcu_synchronize(void);
+
+/*
+ * Queue some data (already unlinked) to be released by "free_f" once all
+ * the readers which may still see it are gone. Does not block.
+ *
+ * Return: 0 on success, -1 on failure (the data is freed on the spot,
+ * after a rcu_synchronize())
+ */
+int rcu_defer_free(void *data, rcu_free_f *free_f);
+
+#endif /* _CORE_RCU_H */
@@ -27,6 +27,29 @@
 
 #define LOCK_WAIT 10
 
+#if defined(USE_FUTEX) && defined(SHARDED_RW_LOCKS)
+
+#include "brw_locking.h"
+
+typedef brw_lock_t rw_lock_t;
+
+#define lock_init_rw() lock_init_brw()
+#define lock_destroy_rw(_lock) lock_destroy_brw(_lock)
+
+#define lock_start_write(_lock) brw_start_write(_lock)
+#define lock_stop_write(_lock) brw_stop_write(_lock)
+#define lock_start_read(_lock) brw_start_read(_lock)
+#define lock_stop_read(_lock) brw_stop_read(_lock)
+#define lock_start_sw_read(_lock) brw_start_sw_read(_lock)
+#define lock_stop_sw_read(_lock) brw_stop_sw_read(_lock)
+#define lock_switch_write(_lock, __old) \
+	do { \
+		__old = brw_switch_write(_lock); \
+	} while (0)
+#define lock_switch_read(_lock, __old) brw_switch_read(_lock, __old)
+
+#else
+
 typedef struct rw_lock_t {
 	gen_lock_t *lock;
 	int w_flag;
@@ -158,4 +181,6 @@ inline static void lock_destroy_rw(rw_lock_t *_lock)
 		lock_release((_lock)->lock); \
 	} while (0)
 
+#endif /* SHARDED_RW_LOCKS */
+
 #endif
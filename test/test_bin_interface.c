@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <time.h>
+#include <sys/uio.h>
+
+#include "../str.h"
+#include "../bin_interface.h"
+
+#include "test_bin_interface.h"
+
+#define BENCH_PACKETS	200000
+
+static str cap = str_init("test-cap");
+static str callid = str_init("a84b4c76e66710@pc33.example.com");
+static str from_tag = str_init("1928301774");
+static str to_tag = str_init("a6c85cf");
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int build_packet(bin_packet_t *packet, int length)
+{
+	if (bin_init(packet, &cap, 7, 1, length) < 0)
+		return -1;
+
+	if (bin_push_str(packet, &callid) < 0 ||
+	        bin_push_str(packet, &from_tag) < 0 ||
+	        bin_push_str(packet, &to_tag) < 0 ||
+	        bin_push_int(packet, 4) < 0 ||
+	        bin_push_int(packet, 3600) < 0) {
+		bin_free_packet(packet);
+		return -1;
+	}
+
+	return 0;
+}
+
+/* the receiving side works on its own copy of the buffer */
+static void recv_packet(bin_packet_t *sent, bin_packet_t *rcv, char *buf)
+{
+	str b;
+
+	bin_get_buffer(sent, &b);
+	memcpy(buf, b.s, b.len);
+	bin_init_buffer(rcv, buf, b.len);
+}
+
+static void test_bin_fields(void)
+{
+	static char buf[BIN_MAX_BUF_LEN];
+	bin_packet_t packet, rcv;
+	bin_field_t f[6];
+	struct iovec iov[3];
+	str s;
+	int i, len;
+
+	if (!ok(build_packet(&packet, 0) == 0, "bin: build a pooled packet"))
+		return;
+
+	iov[0].iov_base = "sip:";
+	iov[0].iov_len = 4;
+	iov[1].iov_base = "alice";
+	iov[1].iov_len = 5;
+	iov[2].iov_base = "@example.com";
+	iov[2].iov_len = 12;
+	ok(bin_push_iov(&packet, iov, 3) > 0, "bin: push a gathered str");
+
+	recv_packet(&packet, &rcv, buf);
+	bin_free_packet(&packet);
+	len = rcv.buffer.len;
+
+	ok(rcv.type == 7, "bin: packet type");
+	ok(bin_pop_fields(&rcv, "sssiiss", f) == 6,
+		"bin: the missing trailing fields are not returned");
+	ok(f[0].s.len == callid.len && !memcmp(f[0].s.s, callid.s, callid.len),
+		"bin: str field");
+	ok(f[3].i == 4 && f[4].i == 3600, "bin: int fields");
+	ok(f[5].s.len == 21 && !memcmp(f[5].s.s, "sip:alice@example.com", 21),
+		"bin: gathered str field");
+
+	/* a schema not matching the packet must not consume anything */
+	bin_init_buffer(&rcv, buf, len - 2);
+	ok(bin_pop_fields(&rcv, "sss", f) == 3, "bin: pop the first fields");
+	i = bin_pop_fields(&rcv, "iis", f);
+	ok(i < 0, "bin: a truncated str fails");
+	ok(bin_pop_int(&rcv, &i) == 0 && i == 4,
+		"bin: nothing consumed after a failure");
+
+	ok(build_packet(&packet, MIN_BIN_PACKET_SIZE + cap.len) == 0,
+		"bin: build a packet from a small size hint");
+	recv_packet(&packet, &rcv, buf);
+	bin_free_packet(&packet);
+	ok(bin_pop_str(&rcv, &s) == 0 && s.len == callid.len,
+		"bin: the hinted packet grew as needed");
+}
+
+static void bench_bin(void)
+{
+	static char buf[BIN_MAX_BUF_LEN];
+	bin_packet_t packet, rcv;
+	bin_field_t f[5];
+	unsigned long long start, pooled, hinted, by_one, by_schema;
+	str s;
+	int i, v, bad = 0;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PACKETS; i++) {
+		if (build_packet(&packet, 0) < 0)
+			bad++;
+		else
+			bin_free_packet(&packet);
+	}
+	pooled = now_ns() - start;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PACKETS; i++) {
+		if (build_packet(&packet, 128) < 0)
+			bad++;
+		else
+			bin_free_packet(&packet);
+	}
+	hinted = now_ns() - start;
+
+	build_packet(&packet, 0);
+	recv_packet(&packet, &rcv, buf);
+	bin_free_packet(&packet);
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PACKETS; i++) {
+		bin_init_buffer(&rcv, buf, rcv.buffer.len);
+		if (bin_pop_str(&rcv, &s) != 0 || bin_pop_str(&rcv, &s) != 0 ||
+		        bin_pop_str(&rcv, &s) != 0 || bin_pop_int(&rcv, &v) != 0 ||
+		        bin_pop_int(&rcv, &v) != 0)
+			bad++;
+	}
+	by_one = now_ns() - start;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_PACKETS; i++) {
+		bin_init_buffer(&rcv, buf, rcv.buffer.len);
+		if (bin_pop_fields(&rcv, "sssii", f) != 5)
+			bad++;
+	}
+	by_schema = now_ns() - start;
+
+	ok(bad == 0, "bin: %d packets - encode %llu ns pooled, %llu ns "
+		"size hinted; decode %llu ns popping each field, %llu ns by schema",
+		BENCH_PACKETS, pooled / BENCH_PACKETS, hinted / BENCH_PACKETS,
+		by_one / BENCH_PACKETS, by_schema / BENCH_PACKETS);
+}
+
+void test_bin_interface(void)
+{
+	test_bin_fields();
+	bench_bin();
+}
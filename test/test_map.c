@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../str.h"
+#include "../map.h"
+#include "../hash_func.h"
+#include "../mem/shm_mem.h"
+
+#include "test_map.h"
+
+#define BENCH_KEYS		50000
+#define SLOT_KEYS		2000
+#define SLOT_MASK		511		/* 512 slots, the usrloc default */
+
+static char key_buf[BENCH_KEYS][32];
+static str keys[BENCH_KEYS];
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void gen_keys(void)
+{
+	int i;
+
+	for (i = 0; i < BENCH_KEYS; i++) {
+		keys[i].s = key_buf[i];
+		keys[i].len = snprintf(key_buf[i], sizeof key_buf[i],
+			"sip:%d@example.com", i);
+	}
+}
+
+static int check_map(enum map_flags flags, int n)
+{
+	map_t map;
+	void **val;
+	int i, found = 0, size;
+
+	map = map_create(AVLMAP_SHARED | flags);
+	if (!map)
+		return -1;
+
+	for (i = 0; i < n; i++) {
+		val = map_get(map, keys[i]);
+		if (!val)
+			goto error;
+		*val = (void *)(long)(i + 1);
+	}
+
+	for (i = 0; i < n; i += 2)
+		if (map_remove(map, keys[i]) != (void *)(long)(i + 1))
+			goto error;
+
+	for (i = 0; i < n; i++) {
+		val = map_find(map, keys[i]);
+		if ((i % 2 == 0) != (val == NULL) ||
+		        (val && *val != (void *)(long)(i + 1)))
+			goto error;
+		if (val)
+			found++;
+	}
+
+	size = map_size(map);
+	map_destroy(map, NULL);
+	return found == n / 2 && size == n / 2 ? 0 : -1;
+
+error:
+	map_destroy(map, NULL);
+	return -1;
+}
+
+/* all the keys of a map picked by the low bits of core_hash(), as usrloc
+ * does for its slots, must not end up in a few probing clusters (starting
+ * from the low bits, 2000 such keys make clusters of ~280 slots); as
+ * core_hash() gives the same value to many of these numbered keys, the
+ * clusters can not get as short as for random hashes, though */
+static void test_slot_collisions(void)
+{
+	static char slot_buf[SLOT_KEYS][32];
+	str slot_keys[SLOT_KEYS], k;
+	map_t map;
+	unsigned int i, n, run, max_run;
+	int bad = 0;
+
+	for (i = 0, n = 0; n < SLOT_KEYS; i++) {
+		k.s = slot_buf[n];
+		k.len = snprintf(slot_buf[n], sizeof slot_buf[n],
+			"sip:%u@example.com", i);
+		if ((core_hash(&k, NULL, 0) & SLOT_MASK) == 7)
+			slot_keys[n++] = k;
+	}
+
+	map = map_create(AVLMAP_SHARED | MAP_HASHED);
+	if (!ok(map != NULL, "map: create the slot map"))
+		return;
+
+	for (i = 0; i < SLOT_KEYS; i++)
+		if (!map_get(map, slot_keys[i]))
+			bad++;
+	ok(bad == 0, "map: insert %d keys of the same slot", SLOT_KEYS);
+
+	for (i = 0, bad = 0; i < SLOT_KEYS; i++)
+		if (!map_find(map, slot_keys[i]))
+			bad++;
+	ok(bad == 0, "map: find all the keys of the same slot");
+
+	for (i = 0, run = 0, max_run = 0; i < map->ht_size; i++) {
+		if (map->ht[i].node)
+			run++;
+		else
+			run = 0;
+		if (run > max_run)
+			max_run = run;
+	}
+	ok(max_run < 128, "map: longest probing cluster is %u slots (of %u)",
+		max_run, map->ht_size);
+
+	map_destroy(map, NULL);
+}
+
+static void bench_map(char *name, enum map_flags flags)
+{
+	map_t map;
+	unsigned long long start, ins, look;
+	int i, bad = 0;
+
+	map = map_create(AVLMAP_SHARED | flags);
+	if (!ok(map != NULL, "map: create the %s map", name))
+		return;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_KEYS; i++)
+		if (!map_get(map, keys[i]))
+			bad++;
+	ins = now_ns() - start;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_KEYS; i++)
+		if (!map_find(map, keys[(i * 7919) % BENCH_KEYS]))
+			bad++;
+	look = now_ns() - start;
+
+	ok(bad == 0, "map: %s - %d keys, insert %llu ns, lookup %llu ns", name,
+		BENCH_KEYS, ins / BENCH_KEYS, look / BENCH_KEYS);
+
+	map_destroy(map, NULL);
+}
+
+void test_map(void)
+{
+	gen_keys();
+
+	ok(check_map(0, 1000) == 0, "map: avl insert/remove/find");
+	ok(check_map(MAP_HASHED, 1000) == 0, "map: hashed insert/remove/find");
+
+	test_slot_collisions();
+
+	bench_map("avl", 0);
+	bench_map("hashed", MAP_HASHED);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2018 OpenSIPS Solutions
+ *
+ * This file is part of opensips, a free SIP server.
+ *
+ * opensips is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * opensips is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,USA
+ */
+
+#include <tap.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "../mem/shm_mem.h"
+#include "../rw_locking.h"
+#ifdef USE_FUTEX
+#include "../brw_locking.h"
+#endif
+
+#include "test_rw_lock.h"
+
+#define BENCH_OPS		1000000	/* split between the processes */
+#define WRITE_EVERY		100
+
+extern int process_no;
+
+struct rw_bench {
+	volatile int go;
+	volatile int errors;
+	/* always updated together, under the write lock */
+	volatile long a;
+	volatile long b;
+};
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#define rw_bench_child(_sh, _ops, _start_read, _stop_read, \
+		_start_write, _stop_write) \
+	do { \
+		int _i; \
+		while (!(_sh)->go) ; \
+		for (_i = 0; _i < (_ops); _i++) { \
+			if (_i % WRITE_EVERY == 0) { \
+				_start_write; \
+				(_sh)->a++; \
+				(_sh)->b++; \
+				_stop_write; \
+			} else { \
+				_start_read; \
+				if ((_sh)->a != (_sh)->b) \
+					__sync_fetch_and_add(&(_sh)->errors, 1); \
+				_stop_read; \
+			} \
+		} \
+	} while (0)
+
+/* forks @procs processes running @ops lock operations each, with one
+ * write every WRITE_EVERY ops, and returns the elapsed time in ns */
+static long long rw_bench(struct rw_bench *sh, int procs, int ops,
+		void (*child)(struct rw_bench *, int))
+{
+	unsigned long long start;
+	pid_t pid;
+	int i, status, failed = 0;
+
+	sh->go = sh->errors = 0;
+	sh->a = sh->b = 0;
+
+	for (i = 0; i < procs; i++) {
+		pid = fork();
+		if (pid < 0)
+			return -1;
+		if (pid == 0) {
+			process_no = i + 1;
+			child(sh, ops);
+			_exit(0);
+		}
+	}
+
+	start = now_ns();
+	sh->go = 1;
+
+	for (i = 0; i < procs; i++)
+		if (wait(&status) < 0 || !WIFEXITED(status))
+			failed = 1;
+
+	return failed ? -1 : (long long)(now_ns() - start);
+}
+
+static rw_lock_t *rw;
+
+static void rw_child(struct rw_bench *sh, int ops)
+{
+	rw_bench_child(sh, ops, lock_start_read(rw), lock_stop_read(rw),
+		lock_start_write(rw), lock_stop_write(rw));
+}
+
+#ifdef USE_FUTEX
+static brw_lock_t *brw;
+
+static void brw_child(struct rw_bench *sh, int ops)
+{
+	rw_bench_child(sh, ops, brw_start_read(brw), brw_stop_read(brw),
+		brw_start_write(brw), brw_stop_write(brw));
+}
+#endif
+
+static void bench_lock(char *name, struct rw_bench *sh,
+		void (*child)(struct rw_bench *, int))
+{
+	long long ns;
+	int procs, ops;
+
+	for (procs = 1; procs <= 64; procs *= 2) {
+		ops = BENCH_OPS / procs;
+		ns = rw_bench(sh, procs, ops, child);
+		ok(ns > 0 && sh->errors == 0 &&
+			sh->a == procs * ((ops + WRITE_EVERY - 1) / WRITE_EVERY),
+			"rw_lock: %s, %2d processes - %lld ns per op (wall time)", name, procs,
+			ns > 0 ? ns / (procs * ops) : 0);
+	}
+}
+
+void test_rw_lock(void)
+{
+	struct rw_bench *sh;
+
+	sh = shm_malloc(sizeof *sh);
+	if (!ok(sh != NULL, "rw_lock: alloc the shared state"))
+		return;
+
+	rw = lock_init_rw();
+	if (ok(rw != NULL, "rw_lock: init the rw_lock_t")) {
+		bench_lock("rw_lock_t", sh, rw_child);
+		lock_destroy_rw(rw);
+	}
+
+#ifdef USE_FUTEX
+	brw = lock_init_brw();
+	if (ok(brw != NULL, "rw_lock: init the brw_lock_t")) {
+		bench_lock("brw_lock_t", sh, brw_child);
+		lock_destroy_brw(brw);
+	}
+#endif
+
+	shm_free(sh);
+}
@@ -21,18 +21,74 @@
  */
 
 #include <tap.h>
+#include <stdio.h>
+#include <dlfcn.h>
 
 #include "../cachedb/test/test_backends.h"
+#include "../db/test/test_ps_cache.h"
+#include "test_map.h"
+#include "test_bin_interface.h"
+#include "test_rw_lock.h"
 #include "../lib/list.h"
 #include "../dprint.h"
 #include "../sr_module.h"
 
+#ifndef DLSYM_PREFIX
+/* define it to null */
+#define DLSYM_PREFIX
+#endif
+
+/* modules with tests of their own (modules/<name>/test/, built in when
+ * UNIT_TESTS is on), run through their "mod_tests" symbol; the modules are
+ * only opened, they are neither registered nor initialized */
+static char *test_modules[] = {
+	"dialplan",
+	"permissions",
+	"drouting",
+	"dispatcher",
+	"usrloc",
+	"ratelimit",
+	"dialog",
+	NULL
+};
+
+static void run_mod_tests(char *name)
+{
+	char path[256];
+	void *handle;
+	void (*mod_tests)(void);
+
+	snprintf(path, sizeof path, "modules/%s/%s.so", name, name);
+
+	handle = dlopen(path, OPENSIPS_DLFLAGS);
+	if (!ok(handle != NULL, "%s: open the module", name)) {
+		diag("%s", dlerror());
+		return;
+	}
+
+	mod_tests = (void (*)(void))dlsym(handle, DLSYM_PREFIX "mod_tests");
+	if (ok(mod_tests != NULL, "%s: find the module tests", name))
+		mod_tests();
+
+	dlclose(handle);
+}
+
 void init_unit_tests(void) {
 	set_mpath("modules/");
 	init_cachedb_tests();
 }
 
 int run_unit_tests(void) {
+	int i;
+
 	test_cachedb_backends();
+	test_map();
+	test_db_ps_cache();
+	test_bin_interface();
+	test_rw_lock();
+
+	for (i = 0; test_modules[i]; i++)
+		run_mod_tests(test_modules[i]);
+
 	done_testing();
 }